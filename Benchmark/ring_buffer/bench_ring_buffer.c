@@ -0,0 +1,413 @@
+/******************************************************************************
+ * @file      bench_ring_buffer.c
+ * @brief     Ring buffer benchmarks, measures average time per operation
+ *            of ring buffer functions on the host.
+ *
+ * @details   Build the benchmark with different configuration macros to
+ *            compare them, for example:
+ *              make bench build=Release
+ *              make bench build=Release defines=-DRING_BUFFER_POWER_OF_TWO
+ *              make bench build=Release defines="-DRING_BUFFER_ATOMIC -DRING_BUFFER_CACHE_LINE_SIZE=64"
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ring_buffer/ring_buffer.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_mpsc.h"
+#include "bench_ring_buffer_mpmc.h"
+#include "bench_ring_buffer_wait.h"
+#include "bench_ring_buffer_find.h"
+#include "bench_ring_buffer_checksum.h"
+#include "bench_ring_buffer_inline.h"
+#include "bench_ring_buffer_define.h"
+#include "bench_ring_buffer_copy.h"
+
+
+#define BENCH_RING_BUFFER_SIZE          1024
+#define BENCH_ITERATIONS                20000000UL
+#define BENCH_BLOCK_LEN                 61
+
+
+/**
+ * @brief Benchmark function type, runs @p iterations operations on @p ring_buffer
+ */
+typedef void (*Bench_Function_t)(RingBuffer_t * ring_buffer, unsigned long iterations);
+
+/**
+ * @brief Used to keep the compiler from optimizing away results of benchmarked functions
+ */
+static volatile RingBuffer_Counter_t bench_sink;
+
+/**
+ * @brief Argument of producer threads of SPSC benchmarks
+ */
+typedef struct Bench_Producer_t {
+    RingBuffer_t * ring_buffer;             /**<  ring buffer shared with consumer  */
+    size_t iterations;                      /**<  number of blocks of items to put  */
+} Bench_Producer_t;
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_put_get_item(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        RingBuffer_enPutItem(ring_buffer, &item);
+        RingBuffer_enGetItem(ring_buffer, &item);
+        item++;
+    }
+
+    bench_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_put_get_items(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t items [BENCH_BLOCK_LEN] = {0};
+    RingBuffer_Counter_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        RingBuffer_enPutItems(ring_buffer, items, BENCH_BLOCK_LEN, &count);
+        RingBuffer_enGetItems(ring_buffer, items, BENCH_BLOCK_LEN, &count);
+    }
+
+    bench_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_advance_skip(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Counter_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        RingBuffer_enAdvance(ring_buffer, BENCH_BLOCK_LEN, &count);
+        RingBuffer_enSkipItems(ring_buffer, BENCH_BLOCK_LEN, &count);
+    }
+
+    bench_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_put_get_item_unchecked(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        RingBuffer_uPutItem(ring_buffer, &item);
+        RingBuffer_uGetItem(ring_buffer, &item);
+        item++;
+    }
+
+    bench_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_put_get_items_unchecked(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t items [BENCH_BLOCK_LEN] = {0};
+    RingBuffer_Counter_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        count += RingBuffer_uPutItems(ring_buffer, items, BENCH_BLOCK_LEN);
+        count += RingBuffer_uGetItems(ring_buffer, items, BENCH_BLOCK_LEN);
+    }
+
+    bench_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_advance_skip_unchecked(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Counter_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        count += RingBuffer_uAdvance(ring_buffer, BENCH_BLOCK_LEN);
+        count += RingBuffer_uSkipItems(ring_buffer, BENCH_BLOCK_LEN);
+    }
+
+    bench_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_item_free_count(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Counter_t item_count = 0;
+    RingBuffer_Counter_t free_count = 0;
+    RingBuffer_Counter_t sum = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        /*  move pointers so that count functions see all head/tail orders  */
+        RingBuffer_enPutItem(ring_buffer, &item);
+        RingBuffer_enPutItem(ring_buffer, &item);
+        RingBuffer_enGetItem(ring_buffer, &item);
+
+        RingBuffer_enItemCount(ring_buffer, &item_count);
+        RingBuffer_enFreeCount(ring_buffer, &free_count);
+        sum += item_count + free_count;
+
+        if(item_count > (BENCH_RING_BUFFER_SIZE / 2))
+        {
+            RingBuffer_enReset(ring_buffer);
+        }
+    }
+
+    bench_sink = sum;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Producer thread of SPSC benchmark, puts `iterations` blocks of items into the ring buffer
+ */
+static void * bench_spsc_producer(void * arg)
+{
+    Bench_Producer_t * producer = (Bench_Producer_t *)arg;
+    RingBuffer_t * ring_buffer = producer->ring_buffer;
+    RingBuffer_Item_t items [BENCH_BLOCK_LEN] = {0};
+    RingBuffer_Counter_t count = 0;
+    size_t total = producer->iterations * BENCH_BLOCK_LEN;
+
+    while(total)
+    {
+        RingBuffer_enPutItems(ring_buffer, items, (RingBuffer_Counter_t)MIN(total, BENCH_BLOCK_LEN), &count);
+        total -= count;
+
+        if(count == 0)
+        {
+            /*  let the other thread run, when both share a core  */
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_spsc_threads(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t items [BENCH_BLOCK_LEN] = {0};
+    RingBuffer_Counter_t count = 0;
+    size_t total = (size_t)iterations * BENCH_BLOCK_LEN;
+    Bench_Producer_t arg = {ring_buffer, iterations};
+    pthread_t producer;
+
+    pthread_create(&producer, NULL, bench_spsc_producer, &arg);
+
+    while(total)
+    {
+        RingBuffer_enGetItems(ring_buffer, items, (RingBuffer_Counter_t)MIN(total, BENCH_BLOCK_LEN), &count);
+        total -= count;
+
+        if(count == 0)
+        {
+            /*  let the other thread run, when both share a core  */
+            sched_yield();
+        }
+    }
+
+    pthread_join(producer, NULL);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Producer thread of SPSC per item benchmark, puts `iterations` blocks of items one item at a time,
+ *        publishing tail once per item, baseline of the batch benchmark
+ */
+static void * bench_spsc_item_producer(void * arg)
+{
+    Bench_Producer_t * producer = (Bench_Producer_t *)arg;
+    RingBuffer_t * ring_buffer = producer->ring_buffer;
+    RingBuffer_Item_t item = 0;
+    size_t total = producer->iterations * BENCH_BLOCK_LEN;
+
+    while(total)
+    {
+        if(RingBuffer_enPutItem(ring_buffer, &item) != RING_BUFFER_ERROR_NONE)
+        {
+            /*  let the other thread run, when both share a core  */
+            sched_yield();
+            continue;
+        }
+
+        total--;
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_spsc_item_threads(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+    size_t total = (size_t)iterations * BENCH_BLOCK_LEN;
+    Bench_Producer_t arg = {ring_buffer, iterations};
+    pthread_t producer;
+
+    pthread_create(&producer, NULL, bench_spsc_item_producer, &arg);
+
+    while(total)
+    {
+        if(RingBuffer_enGetItem(ring_buffer, &item) != RING_BUFFER_ERROR_NONE)
+        {
+            /*  let the other thread run, when both share a core  */
+            sched_yield();
+            continue;
+        }
+
+        total--;
+    }
+
+    pthread_join(producer, NULL);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Producer thread of SPSC batch benchmark, puts `iterations` batches of items, publishing tail once per batch
+ */
+static void * bench_spsc_batch_producer(void * arg)
+{
+    Bench_Producer_t * producer = (Bench_Producer_t *)arg;
+    RingBuffer_t * ring_buffer = producer->ring_buffer;
+    RingBuffer_Batch_t batch;
+    RingBuffer_Item_t item = 0;
+    size_t total = producer->iterations * BENCH_BLOCK_LEN;
+
+    while(total)
+    {
+        RingBuffer_enPutBatchBegin(ring_buffer, &batch, 0);
+
+        for(RingBuffer_Counter_t i = 0; (i < BENCH_BLOCK_LEN) && total; i++)
+        {
+            if(RingBuffer_enPutBatchItem(&batch, &item) != RING_BUFFER_ERROR_NONE)
+            {
+                /*  let the other thread run, when both share a core  */
+                sched_yield();
+                break;
+            }
+
+            total--;
+        }
+
+        RingBuffer_enPutBatchEnd(&batch);
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_spsc_batch_threads(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Batch_t batch;
+    RingBuffer_Item_t item = 0;
+    size_t total = (size_t)iterations * BENCH_BLOCK_LEN;
+    Bench_Producer_t arg = {ring_buffer, iterations};
+    pthread_t producer;
+
+    pthread_create(&producer, NULL, bench_spsc_batch_producer, &arg);
+
+    while(total)
+    {
+        RingBuffer_enGetBatchBegin(ring_buffer, &batch, 0);
+
+        for(RingBuffer_Counter_t i = 0; (i < BENCH_BLOCK_LEN) && total; i++)
+        {
+            if(RingBuffer_enGetBatchItem(&batch, &item) != RING_BUFFER_ERROR_NONE)
+            {
+                /*  let the other thread run, when both share a core  */
+                sched_yield();
+                break;
+            }
+
+            total--;
+        }
+
+        RingBuffer_enGetBatchEnd(&batch);
+    }
+
+    pthread_join(producer, NULL);
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_run(const char * name, Bench_Function_t function, unsigned long iterations)
+{
+    static RingBuffer_Item_t ring_buffer_data [BENCH_RING_BUFFER_SIZE];
+    static RingBuffer_t ring_buffer;
+    struct timespec start;
+    struct timespec end;
+    double elapsed;
+
+    RingBuffer_enInit(&ring_buffer, ring_buffer_data, BENCH_RING_BUFFER_SIZE);
+
+    /*  wall clock time, as some benchmarks run on multiple threads  */
+    timespec_get(&start, TIME_UTC);
+    function(&ring_buffer, iterations);
+    timespec_get(&end, TIME_UTC);
+
+    elapsed = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+
+    printf("%-24s: %10lu iterations, %8.3f s, %8.2f ns/iteration\n",
+            name, iterations, elapsed, (elapsed * 1e9) / (double)iterations);
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    printf("ring buffer size %u, item size %u, counter size %u\n",
+            (unsigned)BENCH_RING_BUFFER_SIZE, (unsigned)sizeof(RingBuffer_Item_t), (unsigned)sizeof(RingBuffer_Counter_t));
+    printf("RING_BUFFER_POWER_OF_TWO: %d\n", RING_BUFFER_POWER_OF_TWO);
+    printf("RING_BUFFER_FREE_RUNNING: %d\n", RING_BUFFER_FREE_RUNNING);
+    printf("RING_BUFFER_CACHE_LINE_SIZE: %d\n", RING_BUFFER_CACHE_LINE_SIZE);
+    printf("RING_BUFFER_ATOMIC: %d\n", RING_BUFFER_ATOMIC);
+
+    bench_run("put/get item", bench_put_get_item, BENCH_ITERATIONS);
+    bench_run("put/get items", bench_put_get_items, BENCH_ITERATIONS / 4);
+    bench_run("advance/skip", bench_advance_skip, BENCH_ITERATIONS);
+    bench_run("put/get item unchecked", bench_put_get_item_unchecked, BENCH_ITERATIONS);
+    bench_run("put/get items unchecked", bench_put_get_items_unchecked, BENCH_ITERATIONS / 4);
+    bench_run("advance/skip unchecked", bench_advance_skip_unchecked, BENCH_ITERATIONS);
+    bench_run("item/free count", bench_item_free_count, BENCH_ITERATIONS);
+    /*  same number of items per iteration, batch sessions compare against both per item and bulk calls  */
+    bench_run("spsc threads (item)", bench_spsc_item_threads, BENCH_ITERATIONS / 16);
+    bench_run("spsc threads (items)", bench_spsc_threads, BENCH_ITERATIONS / 16);
+    bench_run("spsc threads (batch)", bench_spsc_batch_threads, BENCH_ITERATIONS / 16);
+
+    bench_ring_buffer_mpsc();
+    bench_ring_buffer_mpmc();
+    bench_ring_buffer_wait();
+    bench_ring_buffer_find();
+    bench_ring_buffer_checksum();
+    bench_ring_buffer_inline();
+    bench_ring_buffer_define();
+    bench_ring_buffer_copy();
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_checksum.c
+ * @brief     Ring buffer checksum benchmark, measures the time to checksum wrapping readable items:
+ *              - peek and checksum: items peeked into a scratch array, then a bitwise CRC32C over it
+ *              - RingBuffer_enCrc32c(), RingBuffer_enCrc16Ccitt() and RingBuffer_enAdler32(), in place
+ *
+ * @details   CRC32C instructions depend on compiler flags, for example:
+ *              make bench build=Release
+ *              make bench build=Release defines=-msse4.2
+ *              make bench build=Release defines=-DRING_BUFFER_CRC32C_HARDWARE=0
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_checksum/ring_buffer_checksum.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_checksum.h"
+
+
+#define BENCH_CHECKSUM_RING_BUFFER_SIZE     4096
+#define BENCH_CHECKSUM_ITEMS                4000
+#define BENCH_CHECKSUM_RUNS                 5000UL
+
+/**
+ * @brief Checksum function type, returns checksum of all @p ring_buffer items
+ */
+typedef uint32_t (*Bench_Checksum_Function_t)(RingBuffer_t * ring_buffer);
+
+/**
+ * @brief Used to keep the compiler from optimizing away checksums
+ */
+static volatile uint32_t bench_checksum_sink;
+
+/* ------------------------------------------------------------------------- */
+
+static uint32_t bench_checksum_peek_crc32c(RingBuffer_t * ring_buffer)
+{
+    static RingBuffer_Item_t scratch [BENCH_CHECKSUM_RING_BUFFER_SIZE];
+    RingBuffer_Counter_t count = 0;
+    uint8_t const * data = (uint8_t const *)scratch;
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    RingBuffer_enPeekItems(ring_buffer, scratch, BENCH_CHECKSUM_RING_BUFFER_SIZE, 0, &count);
+
+    for(size_t i = 0; i < (size_t)count * sizeof(RingBuffer_Item_t); i++)
+    {
+        crc ^= data[i];
+
+        for(uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0x82F63B78UL & (0UL - (crc & 1UL)));
+        }
+    }
+
+    return ~crc;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static uint32_t bench_checksum_crc32c(RingBuffer_t * ring_buffer)
+{
+    uint32_t crc = RING_BUFFER_CRC32C_INIT;
+
+    RingBuffer_enCrc32c(ring_buffer, 0, BENCH_CHECKSUM_ITEMS, &crc);
+
+    return crc;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static uint32_t bench_checksum_crc16_ccitt(RingBuffer_t * ring_buffer)
+{
+    uint16_t crc = RING_BUFFER_CRC16_CCITT_INIT;
+
+    RingBuffer_enCrc16Ccitt(ring_buffer, 0, BENCH_CHECKSUM_ITEMS, &crc);
+
+    return crc;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static uint32_t bench_checksum_adler32(RingBuffer_t * ring_buffer)
+{
+    uint32_t adler = RING_BUFFER_ADLER32_INIT;
+
+    RingBuffer_enAdler32(ring_buffer, 0, BENCH_CHECKSUM_ITEMS, &adler);
+
+    return adler;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_checksum_run(const char * name, Bench_Checksum_Function_t function, RingBuffer_t * ring_buffer)
+{
+    struct timespec start;
+    struct timespec end;
+    double elapsed;
+
+    timespec_get(&start, TIME_UTC);
+
+    for(unsigned long i = 0; i < BENCH_CHECKSUM_RUNS; i++)
+    {
+        bench_checksum_sink = function(ring_buffer);
+    }
+
+    timespec_get(&end, TIME_UTC);
+
+    elapsed = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+
+    printf("%-24s: result %08lX, %8.1f ns/run, %6.2f bytes/ns\n", name, (unsigned long)bench_checksum_sink,
+            (elapsed * 1e9) / (double)BENCH_CHECKSUM_RUNS,
+            ((double)BENCH_CHECKSUM_ITEMS * sizeof(RingBuffer_Item_t) * (double)BENCH_CHECKSUM_RUNS) / (elapsed * 1e9));
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_checksum(void)
+{
+    static RingBuffer_Item_t ring_buffer_data [BENCH_CHECKSUM_RING_BUFFER_SIZE];
+    static RingBuffer_Item_t items [BENCH_CHECKSUM_ITEMS];
+    static RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+
+    for(uint32_t i = 0; i < BENCH_CHECKSUM_ITEMS; i++)
+    {
+        items[i] = (RingBuffer_Item_t)(i * 7U + 3U);
+    }
+
+    /*  readable items wrap around the end of ring buffer data, in the middle  */
+    RingBuffer_enInit(&ring_buffer, ring_buffer_data, BENCH_CHECKSUM_RING_BUFFER_SIZE);
+    RingBuffer_enAdvance(&ring_buffer, BENCH_CHECKSUM_RING_BUFFER_SIZE / 2, &count);
+    RingBuffer_enSkipItems(&ring_buffer, BENCH_CHECKSUM_RING_BUFFER_SIZE / 2, &count);
+    RingBuffer_enPutItems(&ring_buffer, items, BENCH_CHECKSUM_ITEMS, &count);
+
+    printf("\nRing buffer checksums, %u items, CRC32C hardware %u\n", (unsigned)BENCH_CHECKSUM_ITEMS, (unsigned)RING_BUFFER_CRC32C_HARDWARE);
+
+    bench_checksum_run("peek and CRC32C bitwise", bench_checksum_peek_crc32c, &ring_buffer);
+    bench_checksum_run("CRC32C", bench_checksum_crc32c, &ring_buffer);
+    bench_checksum_run("CRC16-CCITT", bench_checksum_crc16_ccitt, &ring_buffer);
+    bench_checksum_run("Adler32", bench_checksum_adler32, &ring_buffer);
+}
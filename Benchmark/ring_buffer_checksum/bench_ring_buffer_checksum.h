@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_checksum_H_
+#define _bench_ring_buffer_checksum_H_
+
+void bench_ring_buffer_checksum(void);
+
+#endif /* _bench_ring_buffer_checksum_H_    */
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_copy.c
+ * @brief     Ring buffer item copy benchmark, measures put/get of blocks of items for items of
+ *            1, 2, 4, 8, 16 and 64 bytes (generated ring buffers of 4096 bytes), and for
+ *            #RingBuffer_t items (#RING_BUFFER_ITEM_DATA_TYPE):
+ *              - put/get 64 B: put then get blocks of 64 bytes of items
+ *              - put/get 1 KB: put then get blocks of 1024 bytes of items
+ *
+ * @details   Throughput is given per byte moved, so rings of wide items can be compared to rings of bytes.
+ *            The copy kernel is compared to `memcpy` by building with `-DRING_BUFFER_COPY_INLINE_MAX=0`, for example:
+ *              make bench build=Release
+ *              make bench build=Release defines=-DRING_BUFFER_COPY_INLINE_MAX=0
+ *              make bench build=Release defines=-DRING_BUFFER_ITEM_DATA_TYPE=uint32_t
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_define/ring_buffer_define.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_copy.h"
+
+
+#define BENCH_COPY_RING_BUFFER_BYTES    4096
+#define BENCH_COPY_BYTES                (512UL * 1024UL * 1024UL)
+
+/**
+ * @brief 16 bytes item
+ */
+typedef struct Bench_Copy_Item16_t {
+    uint8_t bytes [16];
+} Bench_Copy_Item16_t;
+
+/**
+ * @brief 64 bytes item
+ */
+typedef struct Bench_Copy_Item64_t {
+    uint8_t bytes [64];
+} Bench_Copy_Item64_t;
+
+RING_BUFFER_DEFINE(BenchCopy1, uint8_t, uint32_t, BENCH_COPY_RING_BUFFER_BYTES / 1)
+RING_BUFFER_DEFINE(BenchCopy2, uint16_t, uint32_t, BENCH_COPY_RING_BUFFER_BYTES / 2)
+RING_BUFFER_DEFINE(BenchCopy4, uint32_t, uint32_t, BENCH_COPY_RING_BUFFER_BYTES / 4)
+RING_BUFFER_DEFINE(BenchCopy8, uint64_t, uint32_t, BENCH_COPY_RING_BUFFER_BYTES / 8)
+RING_BUFFER_DEFINE(BenchCopy16, Bench_Copy_Item16_t, uint32_t, BENCH_COPY_RING_BUFFER_BYTES / 16)
+RING_BUFFER_DEFINE(BenchCopy64, Bench_Copy_Item64_t, uint32_t, BENCH_COPY_RING_BUFFER_BYTES / 64)
+
+/**
+ * @brief Benchmark function type, puts then gets blocks of @p block_bytes bytes of items, @p iterations times
+ */
+typedef void (*Bench_Copy_Function_t)(unsigned long iterations, size_t block_bytes);
+
+/**
+ * @brief Used to keep the compiler from optimizing away results of benchmarked functions
+ */
+static volatile uint32_t bench_copy_sink;
+
+/**
+ * @brief Items put and got, as bytes (aligned for every item type)
+ */
+static union {
+    uint64_t align;
+    uint8_t bytes [1024];
+} bench_copy_block;
+
+static RingBuffer_Item_t bench_copy_core_data [BENCH_COPY_RING_BUFFER_BYTES / sizeof(RingBuffer_Item_t)];
+static RingBuffer_t bench_copy_core;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Define benchmark function `bench_copy_##name` for generated ring buffer `name`
+ */
+#define BENCH_COPY_GENERATED(name)                                                                          \
+    static name##_t bench_copy_ring_buffer_##name;                                                          \
+                                                                                                            \
+    static void bench_copy_##name(unsigned long iterations, size_t block_bytes)                             \
+    {                                                                                                       \
+        name##_Item_t * items = (name##_Item_t *)(void *)bench_copy_block.bytes;                            \
+        name##_Counter_t len = (name##_Counter_t)(block_bytes / sizeof(name##_Item_t));                     \
+        uint32_t count = 0;                                                                                 \
+                                                                                                            \
+        name##_enInit(&bench_copy_ring_buffer_##name);                                                      \
+                                                                                                            \
+        for(unsigned long i = 0; i < iterations; i++)                                                       \
+        {                                                                                                   \
+            count += name##_uPutItems(&bench_copy_ring_buffer_##name, items, len);                          \
+            count += name##_uGetItems(&bench_copy_ring_buffer_##name, items, len);                          \
+        }                                                                                                   \
+                                                                                                            \
+        bench_copy_sink = count;                                                                            \
+    }
+
+BENCH_COPY_GENERATED(BenchCopy1)
+BENCH_COPY_GENERATED(BenchCopy2)
+BENCH_COPY_GENERATED(BenchCopy4)
+BENCH_COPY_GENERATED(BenchCopy8)
+BENCH_COPY_GENERATED(BenchCopy16)
+BENCH_COPY_GENERATED(BenchCopy64)
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_copy_core_items(unsigned long iterations, size_t block_bytes)
+{
+    RingBuffer_Item_t * items = (RingBuffer_Item_t *)(void *)bench_copy_block.bytes;
+    RingBuffer_Counter_t len = (RingBuffer_Counter_t)(block_bytes / sizeof(RingBuffer_Item_t));
+    uint32_t count = 0;
+
+    RingBuffer_enReset(&bench_copy_core);
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        count += RingBuffer_uPutItems(&bench_copy_core, items, len);
+        count += RingBuffer_uGetItems(&bench_copy_core, items, len);
+    }
+
+    bench_copy_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static double bench_copy_xRun(Bench_Copy_Function_t function, size_t block_bytes)
+{
+    struct timespec start;
+    struct timespec end;
+    double elapsed;
+    unsigned long iterations = BENCH_COPY_BYTES / block_bytes;
+
+    timespec_get(&start, TIME_UTC);
+
+    function(iterations, block_bytes);
+
+    timespec_get(&end, TIME_UTC);
+
+    elapsed = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+
+    /*  bytes are moved twice: put, then get  */
+    return (2.0 * (double)(iterations * block_bytes)) / (elapsed * 1e9);
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_copy_run(const char * name, Bench_Copy_Function_t function)
+{
+    double small_blocks = bench_copy_xRun(function, 64);
+    double large_blocks = bench_copy_xRun(function, 1024);
+
+    printf("%-24s: %8.2f GB/s (64 B), %8.2f GB/s (1 KB)\n", name, small_blocks, large_blocks);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_copy(void)
+{
+    RingBuffer_enInit(&bench_copy_core, bench_copy_core_data, (RingBuffer_Counter_t)(sizeof(bench_copy_core_data) / sizeof(bench_copy_core_data[0])));
+
+    printf("\nRing buffer item copy, %lu MB, inline copies up to %u bytes\n", BENCH_COPY_BYTES / (1024UL * 1024UL), (unsigned)RING_BUFFER_COPY_INLINE_MAX);
+
+    bench_copy_run("put/get 1 byte items", bench_copy_BenchCopy1);
+    bench_copy_run("put/get 2 bytes items", bench_copy_BenchCopy2);
+    bench_copy_run("put/get 4 bytes items", bench_copy_BenchCopy4);
+    bench_copy_run("put/get 8 bytes items", bench_copy_BenchCopy8);
+    bench_copy_run("put/get 16 bytes items", bench_copy_BenchCopy16);
+    bench_copy_run("put/get 64 bytes items", bench_copy_BenchCopy64);
+    bench_copy_run("put/get RingBuffer_t", bench_copy_core_items);
+}
@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_copy_H_
+#define _bench_ring_buffer_copy_H_
+
+void bench_ring_buffer_copy(void);
+
+#endif /* _bench_ring_buffer_copy_H_    */
@@ -0,0 +1,211 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_define.c
+ * @brief     Generated ring buffer benchmark, measures ring buffers of RING_BUFFER_DEFINE()
+ *            (constant capacity and item size) against #RingBuffer_t (capacity set at run time):
+ *              - put/get item: put an item, then get it
+ *              - put/get items: put a block of items, then get it
+ *
+ * @details   Capacities 100 (pointers wrap at a constant) and 128 (free running pointers, masked),
+ *            with bytes and 64 bytes records for generated ring buffers, for example:
+ *              make bench build=Release
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_define/ring_buffer_define.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_define.h"
+
+
+#define BENCH_DEFINE_CORE_SIZE          100
+#define BENCH_DEFINE_ITERATIONS         20000000UL
+#define BENCH_DEFINE_BLOCK_LEN          16
+
+/**
+ * @brief 64 bytes record, copied as a whole
+ */
+typedef struct Bench_Define_Record_t {
+    uint8_t bytes [64];
+} Bench_Define_Record_t;
+
+RING_BUFFER_DEFINE(BenchBytes100, uint8_t, uint32_t, 100)
+RING_BUFFER_DEFINE(BenchBytes128, uint8_t, uint32_t, 128)
+RING_BUFFER_DEFINE(BenchRecords128, Bench_Define_Record_t, uint32_t, 128)
+
+/**
+ * @brief Benchmark function type, runs @p iterations item operations
+ */
+typedef void (*Bench_Define_Function_t)(unsigned long iterations);
+
+/**
+ * @brief Used to keep the compiler from optimizing away results of benchmarked functions
+ */
+static volatile uint32_t bench_define_sink;
+
+static RingBuffer_Item_t bench_define_core_data [BENCH_DEFINE_CORE_SIZE];
+static RingBuffer_t bench_define_core;
+static BenchBytes100_t bench_define_bytes100;
+static BenchBytes128_t bench_define_bytes128;
+static BenchRecords128_t bench_define_records128;
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_put_get_core(unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        RingBuffer_uPutItem(&bench_define_core, &item);
+        RingBuffer_uGetItem(&bench_define_core, &item);
+        item++;
+    }
+
+    bench_define_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_put_get_bytes100(unsigned long iterations)
+{
+    uint8_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        BenchBytes100_uPutItem(&bench_define_bytes100, &item);
+        BenchBytes100_uGetItem(&bench_define_bytes100, &item);
+        item++;
+    }
+
+    bench_define_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_put_get_bytes128(unsigned long iterations)
+{
+    uint8_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        BenchBytes128_uPutItem(&bench_define_bytes128, &item);
+        BenchBytes128_uGetItem(&bench_define_bytes128, &item);
+        item++;
+    }
+
+    bench_define_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_blocks_core(unsigned long iterations)
+{
+    RingBuffer_Item_t items [BENCH_DEFINE_BLOCK_LEN] = {0};
+    uint32_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i += BENCH_DEFINE_BLOCK_LEN)
+    {
+        count += RingBuffer_uPutItems(&bench_define_core, items, BENCH_DEFINE_BLOCK_LEN);
+        count += RingBuffer_uGetItems(&bench_define_core, items, BENCH_DEFINE_BLOCK_LEN);
+        items[0]++;
+    }
+
+    bench_define_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_blocks_bytes100(unsigned long iterations)
+{
+    uint8_t items [BENCH_DEFINE_BLOCK_LEN] = {0};
+    uint32_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i += BENCH_DEFINE_BLOCK_LEN)
+    {
+        count += BenchBytes100_uPutItems(&bench_define_bytes100, items, BENCH_DEFINE_BLOCK_LEN);
+        count += BenchBytes100_uGetItems(&bench_define_bytes100, items, BENCH_DEFINE_BLOCK_LEN);
+        items[0]++;
+    }
+
+    bench_define_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_blocks_bytes128(unsigned long iterations)
+{
+    uint8_t items [BENCH_DEFINE_BLOCK_LEN] = {0};
+    uint32_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i += BENCH_DEFINE_BLOCK_LEN)
+    {
+        count += BenchBytes128_uPutItems(&bench_define_bytes128, items, BENCH_DEFINE_BLOCK_LEN);
+        count += BenchBytes128_uGetItems(&bench_define_bytes128, items, BENCH_DEFINE_BLOCK_LEN);
+        items[0]++;
+    }
+
+    bench_define_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_blocks_records128(unsigned long iterations)
+{
+    Bench_Define_Record_t items [BENCH_DEFINE_BLOCK_LEN] = {0};
+    uint32_t count = 0;
+
+    for(unsigned long i = 0; i < iterations; i += BENCH_DEFINE_BLOCK_LEN)
+    {
+        count += BenchRecords128_uPutItems(&bench_define_records128, items, BENCH_DEFINE_BLOCK_LEN);
+        count += BenchRecords128_uGetItems(&bench_define_records128, items, BENCH_DEFINE_BLOCK_LEN);
+        items[0].bytes[0]++;
+    }
+
+    bench_define_sink = count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_define_run(const char * name, Bench_Define_Function_t function)
+{
+    struct timespec start;
+    struct timespec end;
+    double elapsed;
+
+    RingBuffer_enReset(&bench_define_core);
+    BenchBytes100_enInit(&bench_define_bytes100);
+    BenchBytes128_enInit(&bench_define_bytes128);
+    BenchRecords128_enInit(&bench_define_records128);
+
+    timespec_get(&start, TIME_UTC);
+
+    function(BENCH_DEFINE_ITERATIONS);
+
+    timespec_get(&end, TIME_UTC);
+
+    elapsed = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+
+    printf("%-24s: %8.2f ns/item\n", name, (elapsed * 1e9) / (double)BENCH_DEFINE_ITERATIONS);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_define(void)
+{
+    RingBuffer_enInit(&bench_define_core, bench_define_core_data, BENCH_DEFINE_CORE_SIZE);
+
+    printf("\nGenerated ring buffer, %lu items\n", (unsigned long)BENCH_DEFINE_ITERATIONS);
+
+    bench_define_run("put/get item (core)", bench_define_put_get_core);
+    bench_define_run("put/get item (100)", bench_define_put_get_bytes100);
+    bench_define_run("put/get item (128)", bench_define_put_get_bytes128);
+    bench_define_run("put/get items (core)", bench_define_blocks_core);
+    bench_define_run("put/get items (100)", bench_define_blocks_bytes100);
+    bench_define_run("put/get items (128)", bench_define_blocks_bytes128);
+    bench_define_run("put/get records (128)", bench_define_blocks_records128);
+}
@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_define_H_
+#define _bench_ring_buffer_define_H_
+
+void bench_ring_buffer_define(void);
+
+#endif /* _bench_ring_buffer_define_H_    */
@@ -0,0 +1,219 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_find.c
+ * @brief     Ring buffer search benchmark, measures the time to find a delimiter
+ *            or a pattern at the end of wrapping readable items:
+ *              - peek and scan: items peeked into a scratch array, then compared one by one
+ *              - RingBuffer_enFindItem() and RingBuffer_enFindPattern(), in place
+ *
+ *            And the time to read the lines of wrapping readable items:
+ *              - get and assemble: items copied out of the ring buffer, then into a line buffer
+ *              - RingBufferReader_enNext(), lines in place
+ *
+ * @details   Vector compares depend on compiler flags, for example:
+ *              make bench build=Release
+ *              make bench build=Release defines=-mavx2
+ *              make bench build=Release defines=-DRING_BUFFER_FIND_VECTOR_SIZE=0
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_find/ring_buffer_find.h"
+#include "ring_buffer_reader/ring_buffer_reader.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_find.h"
+
+
+#define BENCH_FIND_RING_BUFFER_SIZE     4096
+#define BENCH_FIND_ITEMS                4000
+#define BENCH_FIND_SEARCHES             20000UL
+#define BENCH_FIND_PATTERN_LEN          4
+#define BENCH_FIND_LINE_LEN             40
+#define BENCH_FIND_BLOCK_LEN            64
+
+/**
+ * @brief Search function type, returns position of the delimiter or pattern at the end of @p ring_buffer items,
+ *        or number of lines read
+ */
+typedef RingBuffer_Counter_t (*Bench_Find_Function_t)(RingBuffer_t * ring_buffer);
+
+static const RingBuffer_Item_t bench_find_pattern [BENCH_FIND_PATTERN_LEN] = { 0x0D, 0x0A, 0x0D, 0x0A };
+
+/**
+ * @brief Items put into the ring buffer, text with the pattern at the end, then text lines
+ */
+static RingBuffer_Item_t bench_find_items [BENCH_FIND_ITEMS];
+
+/**
+ * @brief Used to keep the compiler from optimizing away results of searches
+ */
+static volatile RingBuffer_Counter_t bench_find_sink;
+
+/* ------------------------------------------------------------------------- */
+
+static RingBuffer_Counter_t bench_find_peek_scan(RingBuffer_t * ring_buffer)
+{
+    static RingBuffer_Item_t scratch [BENCH_FIND_RING_BUFFER_SIZE];
+    RingBuffer_Counter_t count = 0;
+
+    RingBuffer_enPeekItems(ring_buffer, scratch, BENCH_FIND_RING_BUFFER_SIZE, 0, &count);
+
+    for(RingBuffer_Counter_t i = 0; i < count; i++)
+    {
+        if(scratch[i] == bench_find_pattern[0])
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static RingBuffer_Counter_t bench_find_item(RingBuffer_t * ring_buffer)
+{
+    RingBuffer_Counter_t position = 0;
+
+    RingBuffer_enFindItem(ring_buffer, &bench_find_pattern[0], 0, &position);
+
+    return position;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static RingBuffer_Counter_t bench_find_pattern_items(RingBuffer_t * ring_buffer)
+{
+    RingBuffer_Counter_t position = 0;
+
+    RingBuffer_enFindPattern(ring_buffer, bench_find_pattern, BENCH_FIND_PATTERN_LEN, 0, &position);
+
+    return position;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static RingBuffer_Counter_t bench_find_lines_copy(RingBuffer_t * ring_buffer)
+{
+    static RingBuffer_Item_t line [BENCH_FIND_RING_BUFFER_SIZE];
+    RingBuffer_Item_t block [BENCH_FIND_BLOCK_LEN];
+    RingBuffer_Counter_t line_len = 0;
+    RingBuffer_Counter_t lines = 0;
+    RingBuffer_Counter_t count = 0;
+
+    RingBuffer_enPutItems(ring_buffer, bench_find_items, BENCH_FIND_ITEMS, &count);
+
+    while(RingBuffer_enGetItems(ring_buffer, block, BENCH_FIND_BLOCK_LEN, &count) != RING_BUFFER_ERROR_EMPTY)
+    {
+        for(RingBuffer_Counter_t i = 0; i < count; i++)
+        {
+            line[line_len++] = block[i];
+
+            if(block[i] == '\n')
+            {
+                /*  line handler reads the line  */
+                bench_find_sink = line[lines % line_len];
+                lines++;
+                line_len = 0;
+            }
+        }
+    }
+
+    return lines;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static RingBuffer_Counter_t bench_find_lines_reader(RingBuffer_t * ring_buffer)
+{
+    static const RingBuffer_Item_t delimiter = '\n';
+    RingBufferReader_t reader;
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t frame_len;
+    RingBuffer_Counter_t lines = 0;
+    RingBuffer_Counter_t count = 0;
+
+    RingBuffer_enPutItems(ring_buffer, bench_find_items, BENCH_FIND_ITEMS, &count);
+    RingBufferReader_enInit(&reader, ring_buffer, &delimiter, 1);
+
+    while(RingBufferReader_enNext(&reader, &first, &second, &frame_len) == RING_BUFFER_ERROR_NONE)
+    {
+        /*  line handler reads the line  */
+        bench_find_sink = first.count ? first.data[lines % first.count] : second.data[0];
+        lines++;
+        RingBufferReader_enConsume(&reader, frame_len);
+    }
+
+    return lines;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_find_run(const char * name, Bench_Find_Function_t function, RingBuffer_t * ring_buffer)
+{
+    struct timespec start;
+    struct timespec end;
+    double elapsed;
+
+    timespec_get(&start, TIME_UTC);
+
+    for(unsigned long i = 0; i < BENCH_FIND_SEARCHES; i++)
+    {
+        bench_find_sink = function(ring_buffer);
+    }
+
+    timespec_get(&end, TIME_UTC);
+
+    elapsed = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+
+    printf("%-24s: result %5u, %8.1f ns/run, %6.2f items/ns\n", name, (unsigned)bench_find_sink,
+            (elapsed * 1e9) / (double)BENCH_FIND_SEARCHES, ((double)BENCH_FIND_ITEMS * (double)BENCH_FIND_SEARCHES) / (elapsed * 1e9));
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_find(void)
+{
+    static RingBuffer_Item_t ring_buffer_data [BENCH_FIND_RING_BUFFER_SIZE];
+    static RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+
+    /*  text like items, the pattern is at the end  */
+    for(uint32_t i = 0; i < BENCH_FIND_ITEMS; i++)
+    {
+        bench_find_items[i] = (RingBuffer_Item_t)('a' + (i % 26));
+    }
+
+    memcpy(&bench_find_items[BENCH_FIND_ITEMS - BENCH_FIND_PATTERN_LEN], bench_find_pattern, sizeof(bench_find_pattern));
+
+    /*  readable items wrap around the end of ring buffer data, in the middle  */
+    RingBuffer_enInit(&ring_buffer, ring_buffer_data, BENCH_FIND_RING_BUFFER_SIZE);
+    RingBuffer_enAdvance(&ring_buffer, BENCH_FIND_RING_BUFFER_SIZE / 2, &count);
+    RingBuffer_enSkipItems(&ring_buffer, BENCH_FIND_RING_BUFFER_SIZE / 2, &count);
+    RingBuffer_enPutItems(&ring_buffer, bench_find_items, BENCH_FIND_ITEMS, &count);
+
+    printf("\nRing buffer search, %u items, vector size %u\n", (unsigned)BENCH_FIND_ITEMS, (unsigned)RING_BUFFER_FIND_VECTOR_SIZE);
+
+    bench_find_run("peek and scan", bench_find_peek_scan, &ring_buffer);
+    bench_find_run("find item", bench_find_item, &ring_buffer);
+    bench_find_run("find pattern (4 items)", bench_find_pattern_items, &ring_buffer);
+
+    /*  text lines  */
+    for(uint32_t i = BENCH_FIND_LINE_LEN - 1; i < BENCH_FIND_ITEMS; i += BENCH_FIND_LINE_LEN)
+    {
+        bench_find_items[i] = (RingBuffer_Item_t)'\n';
+    }
+
+    /*  each run puts the lines, then reads them all, so lines wrap at different places  */
+    RingBuffer_enReset(&ring_buffer);
+
+    printf("\nRing buffer lines, %u items, %u items per line\n", (unsigned)BENCH_FIND_ITEMS, (unsigned)BENCH_FIND_LINE_LEN);
+
+    bench_find_run("get and assemble", bench_find_lines_copy, &ring_buffer);
+    bench_find_run("reader", bench_find_lines_reader, &ring_buffer);
+}
@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_find_H_
+#define _bench_ring_buffer_find_H_
+
+void bench_ring_buffer_find(void);
+
+#endif /* _bench_ring_buffer_find_H_    */
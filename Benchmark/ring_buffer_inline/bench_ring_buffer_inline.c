@@ -0,0 +1,161 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_inline.c
+ * @brief     Ring buffer call overhead benchmark, measures single item and count functions
+ *            called from ring_buffer.c, and inlined (`ring_buffer_inline.h`, #RING_BUFFER_INLINE):
+ *              - put/get item: put an item, then get it
+ *              - fill/drain: put items while free count isn't 0, then get items while not empty
+ *
+ * @details   The difference is the call overhead, and the loads and stores of results written
+ *            through pointers, for example:
+ *              make bench build=Release
+ *              make bench build=Release defines=-DRING_BUFFER_POWER_OF_TWO
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_inline.h"
+
+
+#define BENCH_INLINE_RING_BUFFER_SIZE   64
+#define BENCH_INLINE_ITERATIONS         20000000UL
+
+/**
+ * @brief Benchmark function type, runs @p iterations item operations on @p ring_buffer
+ */
+typedef void (*Bench_Inline_Function_t)(RingBuffer_t * ring_buffer, unsigned long iterations);
+
+/**
+ * @brief Used to keep the compiler from optimizing away results of benchmarked functions
+ */
+static volatile RingBuffer_Counter_t bench_inline_sink;
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_inline_put_get_call(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        (RingBuffer_enPutItem)(ring_buffer, &item);
+        (RingBuffer_enGetItem)(ring_buffer, &item);
+        item++;
+    }
+
+    bench_inline_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_inline_put_get_inline(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+
+    for(unsigned long i = 0; i < iterations; i++)
+    {
+        RingBuffer_enPutItemInline(ring_buffer, &item);
+        RingBuffer_enGetItemInline(ring_buffer, &item);
+        item++;
+    }
+
+    bench_inline_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_inline_fill_drain_call(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Counter_t free_count = 0;
+    uint8_t is_empty = FALSE;
+    unsigned long count = 0;
+
+    while(count < iterations)
+    {
+        while(((RingBuffer_enFreeCount)(ring_buffer, &free_count) == RING_BUFFER_ERROR_NONE) && free_count)
+        {
+            (RingBuffer_enPutItem)(ring_buffer, &item);
+            item++;
+        }
+
+        while(((RingBuffer_enIsEmpty)(ring_buffer, &is_empty) == RING_BUFFER_ERROR_NONE) && !is_empty)
+        {
+            (RingBuffer_enGetItem)(ring_buffer, &item);
+            count++;
+        }
+    }
+
+    bench_inline_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_inline_fill_drain_inline(RingBuffer_t * ring_buffer, unsigned long iterations)
+{
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Counter_t free_count = 0;
+    uint8_t is_empty = FALSE;
+    unsigned long count = 0;
+
+    while(count < iterations)
+    {
+        while((RingBuffer_enFreeCountInline(ring_buffer, &free_count) == RING_BUFFER_ERROR_NONE) && free_count)
+        {
+            RingBuffer_enPutItemInline(ring_buffer, &item);
+            item++;
+        }
+
+        while((RingBuffer_enIsEmptyInline(ring_buffer, &is_empty) == RING_BUFFER_ERROR_NONE) && !is_empty)
+        {
+            RingBuffer_enGetItemInline(ring_buffer, &item);
+            count++;
+        }
+    }
+
+    bench_inline_sink = item;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_inline_run(const char * name, Bench_Inline_Function_t function, RingBuffer_t * ring_buffer)
+{
+    struct timespec start;
+    struct timespec end;
+    double elapsed;
+
+    RingBuffer_enReset(ring_buffer);
+
+    timespec_get(&start, TIME_UTC);
+
+    function(ring_buffer, BENCH_INLINE_ITERATIONS);
+
+    timespec_get(&end, TIME_UTC);
+
+    elapsed = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+
+    printf("%-24s: %8.2f ns/item\n", name, (elapsed * 1e9) / (double)BENCH_INLINE_ITERATIONS);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_inline(void)
+{
+    static RingBuffer_Item_t ring_buffer_data [BENCH_INLINE_RING_BUFFER_SIZE];
+    static RingBuffer_t ring_buffer;
+
+    RingBuffer_enInit(&ring_buffer, ring_buffer_data, BENCH_INLINE_RING_BUFFER_SIZE);
+
+    printf("\nRing buffer call overhead, %lu items\n", (unsigned long)BENCH_INLINE_ITERATIONS);
+
+    bench_inline_run("put/get item (call)", bench_inline_put_get_call, &ring_buffer);
+    bench_inline_run("put/get item (inline)", bench_inline_put_get_inline, &ring_buffer);
+    bench_inline_run("fill/drain (call)", bench_inline_fill_drain_call, &ring_buffer);
+    bench_inline_run("fill/drain (inline)", bench_inline_fill_drain_inline, &ring_buffer);
+}
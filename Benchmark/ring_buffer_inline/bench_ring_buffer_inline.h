@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_inline_H_
+#define _bench_ring_buffer_inline_H_
+
+void bench_ring_buffer_inline(void);
+
+#endif /* _bench_ring_buffer_inline_H_    */
@@ -0,0 +1,176 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_mpmc.c
+ * @brief     MPMC ring buffer throughput benchmark, with 2, 4, 8 and 16 threads
+ *            (half producers, half consumers), compared to an SPSC ring buffer
+ *            with a mutex around RingBuffer_enPutItem() & RingBuffer_enGetItem().
+ *
+ * @details   MPMC ring buffer needs atomic ring buffer counters:
+ *              make bench build=Release defines="-DRING_BUFFER_ATOMIC -DRING_BUFFER_CACHE_LINE_SIZE=64"
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mpmc/ring_buffer_mpmc.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_mpmc.h"
+
+
+#define BENCH_MPMC_RING_BUFFER_SIZE     1024
+#define BENCH_MPMC_ITEMS                2000000UL
+#define BENCH_MPMC_MAX_THREADS          16
+
+#if RING_BUFFER_MPMC
+
+/**
+ * @brief Benchmark thread, puts or gets @p items items
+ */
+typedef struct Bench_Thread_t {
+    RingBufferMPMC_t * mpmc;                /**<  MPMC ring buffer, NULL when benchmarking the mutex  */
+    RingBuffer_t * ring_buffer;             /**<  SPSC ring buffer, protected by mutex  */
+    pthread_mutex_t * mutex;                /**<  mutex serializing all threads of SPSC ring buffer  */
+    unsigned long items;                    /**<  number of items to put or get  */
+} Bench_Thread_t;
+
+/* ------------------------------------------------------------------------- */
+
+static void * bench_mpmc_producer(void * arg)
+{
+    Bench_Thread_t * thread = (Bench_Thread_t *)arg;
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Error_t error;
+
+    for(unsigned long i = 0; i < thread->items; )
+    {
+        if(thread->mpmc)
+        {
+            error = RingBufferMPMC_enPutItem(thread->mpmc, &item);
+        }
+        else
+        {
+            pthread_mutex_lock(thread->mutex);
+            error = RingBuffer_enPutItem(thread->ring_buffer, &item);
+            pthread_mutex_unlock(thread->mutex);
+        }
+
+        if(error == RING_BUFFER_ERROR_NONE)
+        {
+            item++;
+            i++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void * bench_mpmc_consumer(void * arg)
+{
+    Bench_Thread_t * thread = (Bench_Thread_t *)arg;
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Error_t error;
+
+    for(unsigned long i = 0; i < thread->items; )
+    {
+        if(thread->mpmc)
+        {
+            error = RingBufferMPMC_enGetItem(thread->mpmc, &item);
+        }
+        else
+        {
+            pthread_mutex_lock(thread->mutex);
+            error = RingBuffer_enGetItem(thread->ring_buffer, &item);
+            pthread_mutex_unlock(thread->mutex);
+        }
+
+        if(error == RING_BUFFER_ERROR_NONE)
+        {
+            i++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Run @p threads threads, half producers & half consumers, return elapsed wall clock time in seconds
+ *
+ * @param [in] use_mpmc : TRUE to use MPMC ring buffer, FALSE to use SPSC ring buffer with a mutex
+ */
+static double bench_mpmc_run(uint8_t use_mpmc, unsigned threads)
+{
+    static RingBufferMPMC_Slot_t slots [BENCH_MPMC_RING_BUFFER_SIZE];
+    static RingBuffer_Item_t ring_buffer_data [BENCH_MPMC_RING_BUFFER_SIZE];
+    static RingBufferMPMC_t mpmc_ring_buffer;
+    static RingBuffer_t spsc_ring_buffer;
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    Bench_Thread_t thread [BENCH_MPMC_MAX_THREADS];
+    pthread_t thread_ids [BENCH_MPMC_MAX_THREADS];
+    struct timespec start;
+    struct timespec end;
+
+    RingBufferMPMC_enInit(&mpmc_ring_buffer, slots, BENCH_MPMC_RING_BUFFER_SIZE);
+    RingBuffer_enInit(&spsc_ring_buffer, ring_buffer_data, BENCH_MPMC_RING_BUFFER_SIZE);
+
+    timespec_get(&start, TIME_UTC);
+
+    for(unsigned i = 0; i < threads; i++)
+    {
+        thread[i].mpmc = use_mpmc ? &mpmc_ring_buffer : NULL;
+        thread[i].ring_buffer = &spsc_ring_buffer;
+        thread[i].mutex = &mutex;
+        thread[i].items = BENCH_MPMC_ITEMS / (threads / 2);
+        pthread_create(&thread_ids[i], NULL, (i & 1) ? bench_mpmc_consumer : bench_mpmc_producer, &thread[i]);
+    }
+
+    for(unsigned i = 0; i < threads; i++)
+    {
+        pthread_join(thread_ids[i], NULL);
+    }
+
+    timespec_get(&end, TIME_UTC);
+
+    return (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_mpmc(void)
+{
+    printf("\nMPMC ring buffer size %u, slot size %u, %lu items\n",
+            (unsigned)BENCH_MPMC_RING_BUFFER_SIZE, (unsigned)sizeof(RingBufferMPMC_Slot_t), BENCH_MPMC_ITEMS);
+
+    for(unsigned threads = 2; threads <= BENCH_MPMC_MAX_THREADS; threads *= 2)
+    {
+        double mpmc_elapsed = bench_mpmc_run(TRUE, threads);
+        double mutex_elapsed = bench_mpmc_run(FALSE, threads);
+
+        printf("%2u threads: mpmc %8.2f Mitems/s, mutex spsc %8.2f Mitems/s\n", threads,
+                (double)BENCH_MPMC_ITEMS / (mpmc_elapsed * 1e6), (double)BENCH_MPMC_ITEMS / (mutex_elapsed * 1e6));
+    }
+}
+
+#else
+
+void bench_ring_buffer_mpmc(void)
+{
+    printf("\nMPMC ring buffer benchmark skipped, needs -DRING_BUFFER_ATOMIC\n");
+}
+
+#endif /*  RING_BUFFER_MPMC  */
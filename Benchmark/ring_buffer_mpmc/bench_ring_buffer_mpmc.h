@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_mpmc_H_
+#define _bench_ring_buffer_mpmc_H_
+
+void bench_ring_buffer_mpmc(void);
+
+#endif /* _bench_ring_buffer_mpmc_H_    */
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_mpsc.c
+ * @brief     MPSC ring buffer scalability benchmark, measures throughput of
+ *            1 to #BENCH_MPSC_MAX_PRODUCERS producer threads feeding one consumer,
+ *            compared to an SPSC ring buffer with a mutex around RingBuffer_enPutItems().
+ *
+ * @details   MPSC ring buffer needs atomic free running pointers:
+ *              make bench build=Release defines="-DRING_BUFFER_ATOMIC -DRING_BUFFER_FREE_RUNNING"
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mpsc/ring_buffer_mpsc.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_mpsc.h"
+
+
+#define BENCH_MPSC_RING_BUFFER_SIZE     1024
+#define BENCH_MPSC_ITEMS                4000000UL
+#define BENCH_MPSC_BATCH_LEN            8
+#define BENCH_MPSC_MAX_PRODUCERS        8
+
+#if RING_BUFFER_MPSC
+
+/**
+ * @brief Benchmark producer, puts @p items items into the ring buffer in batches of #BENCH_MPSC_BATCH_LEN
+ */
+typedef struct Bench_Producer_t {
+    RingBufferMPSC_t * mpsc;                /**<  MPSC ring buffer, NULL when benchmarking the mutex  */
+    RingBuffer_t * ring_buffer;             /**<  SPSC ring buffer, protected by mutex  */
+    pthread_mutex_t * mutex;                /**<  mutex serializing producers of SPSC ring buffer  */
+    unsigned long items;                    /**<  number of items to put  */
+} Bench_Producer_t;
+
+/* ------------------------------------------------------------------------- */
+
+static void * bench_mpsc_producer(void * arg)
+{
+    Bench_Producer_t * producer = (Bench_Producer_t *)arg;
+    RingBuffer_Item_t items [BENCH_MPSC_BATCH_LEN] = {0};
+    RingBuffer_Counter_t count = 0;
+    unsigned long total = producer->items;
+
+    while(total)
+    {
+        RingBuffer_Counter_t len = (RingBuffer_Counter_t)MIN(total, BENCH_MPSC_BATCH_LEN);
+
+        if(producer->mpsc)
+        {
+            RingBufferMPSC_enPutItems(producer->mpsc, items, len, &count);
+        }
+        else
+        {
+            pthread_mutex_lock(producer->mutex);
+            RingBuffer_enPutItems(producer->ring_buffer, items, len, &count);
+            pthread_mutex_unlock(producer->mutex);
+        }
+
+        total -= count;
+
+        if(count == 0)
+        {
+            /*  ring buffer is full, let the consumer run  */
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Run @p producers producer threads and consume their items, return elapsed wall clock time in seconds
+ *
+ * @param [in] use_mpsc : TRUE to use MPSC ring buffer, FALSE to use SPSC ring buffer with a mutex
+ */
+static double bench_mpsc_run(uint8_t use_mpsc, unsigned producers)
+{
+    static RingBuffer_Item_t ring_buffer_data [BENCH_MPSC_RING_BUFFER_SIZE];
+    static RingBuffer_SharedCounter_t commit [BENCH_MPSC_RING_BUFFER_SIZE];
+    static RingBufferMPSC_t mpsc_ring_buffer;
+    static RingBuffer_t spsc_ring_buffer;
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    Bench_Producer_t producer [BENCH_MPSC_MAX_PRODUCERS];
+    pthread_t threads [BENCH_MPSC_MAX_PRODUCERS];
+    RingBuffer_Item_t items [BENCH_MPSC_RING_BUFFER_SIZE];
+    RingBuffer_Counter_t count = 0;
+    RingBuffer_t * ring_buffer;
+    unsigned long total = BENCH_MPSC_ITEMS - (BENCH_MPSC_ITEMS % producers);
+    struct timespec start;
+    struct timespec end;
+
+    if(use_mpsc)
+    {
+        RingBufferMPSC_enInit(&mpsc_ring_buffer, ring_buffer_data, commit, BENCH_MPSC_RING_BUFFER_SIZE);
+        ring_buffer = &mpsc_ring_buffer.ring_buffer;
+    }
+    else
+    {
+        RingBuffer_enInit(&spsc_ring_buffer, ring_buffer_data, BENCH_MPSC_RING_BUFFER_SIZE);
+        ring_buffer = &spsc_ring_buffer;
+    }
+
+    timespec_get(&start, TIME_UTC);
+
+    for(unsigned i = 0; i < producers; i++)
+    {
+        producer[i].mpsc = use_mpsc ? &mpsc_ring_buffer : NULL;
+        producer[i].ring_buffer = &spsc_ring_buffer;
+        producer[i].mutex = &mutex;
+        producer[i].items = total / producers;
+        pthread_create(&threads[i], NULL, bench_mpsc_producer, &producer[i]);
+    }
+
+    /*  single consumer, uses ring buffer functions  */
+    while(total)
+    {
+        RingBuffer_enGetItems(ring_buffer, items, BENCH_MPSC_RING_BUFFER_SIZE, &count);
+        total -= count;
+
+        if(count == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    for(unsigned i = 0; i < producers; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    timespec_get(&end, TIME_UTC);
+
+    return (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_mpsc(void)
+{
+    printf("\nMPSC ring buffer size %u, batch length %u, %lu items\n",
+            (unsigned)BENCH_MPSC_RING_BUFFER_SIZE, (unsigned)BENCH_MPSC_BATCH_LEN, BENCH_MPSC_ITEMS);
+
+    for(unsigned producers = 1; producers <= BENCH_MPSC_MAX_PRODUCERS; producers *= 2)
+    {
+        double mpsc_elapsed = bench_mpsc_run(TRUE, producers);
+        double mutex_elapsed = bench_mpsc_run(FALSE, producers);
+
+        printf("%u producers: mpsc %8.2f Mitems/s, mutex spsc %8.2f Mitems/s\n", producers,
+                (double)BENCH_MPSC_ITEMS / (mpsc_elapsed * 1e6), (double)BENCH_MPSC_ITEMS / (mutex_elapsed * 1e6));
+    }
+}
+
+#else
+
+void bench_ring_buffer_mpsc(void)
+{
+    printf("\nMPSC ring buffer benchmark skipped, needs -DRING_BUFFER_ATOMIC -DRING_BUFFER_FREE_RUNNING\n");
+}
+
+#endif /*  RING_BUFFER_MPSC  */
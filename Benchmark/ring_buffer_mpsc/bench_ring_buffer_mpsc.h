@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_mpsc_H_
+#define _bench_ring_buffer_mpsc_H_
+
+void bench_ring_buffer_mpsc(void);
+
+#endif /* _bench_ring_buffer_mpsc_H_    */
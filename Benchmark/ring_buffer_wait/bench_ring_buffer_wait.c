@@ -0,0 +1,192 @@
+/******************************************************************************
+ * @file      bench_ring_buffer_wait.c
+ * @brief     Wait ring buffer strategies benchmark, measures for each wait strategy:
+ *              - latency: round trip time of an item sent back and forth between
+ *              two threads through two wait ring buffers (ping pong)
+ *              - CPU cost: CPU time used by a consumer thread waiting for items
+ *              put every #BENCH_WAIT_PERIOD_NS, relative to wall clock time
+ *
+ * @details   Wait ring buffer needs atomic ring buffer pointers, on Linux:
+ *              make bench build=Release defines=-DRING_BUFFER_ATOMIC
+ *
+ *            Spin strategy numbers are only meaningful when both threads have their own core.
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_wait/ring_buffer_wait.h"
+#include "utils/utils.h"
+#include "bench_ring_buffer_wait.h"
+
+
+#define BENCH_WAIT_RING_BUFFER_SIZE     64
+#define BENCH_WAIT_ROUND_TRIPS          200000UL
+#define BENCH_WAIT_ITEMS                2000UL
+#define BENCH_WAIT_PERIOD_NS            50000L
+
+#if RING_BUFFER_WAIT
+
+/**
+ * @brief Wait ring buffers of ping pong benchmark, and consumer CPU time of CPU cost benchmark
+ */
+typedef struct Bench_Wait_t {
+    RingBufferWait_t ping;                  /**<  ring buffer from the main thread to the echo thread  */
+    RingBufferWait_t pong;                  /**<  ring buffer from the echo thread to the main thread  */
+    double cpu_time;                        /**<  consumer thread CPU time, in seconds  */
+} Bench_Wait_t;
+
+static const char * const bench_wait_names [] = { "spin", "spin then yield", "spin then park" };
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get elapsed time between @p start and @p end, in seconds
+ */
+static double bench_wait_elapsed(struct timespec const * start, struct timespec const * end)
+{
+    return (double)(end->tv_sec - start->tv_sec) + ((double)(end->tv_nsec - start->tv_nsec) / 1e9);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Echo thread of ping pong benchmark, sends back every item it gets
+ */
+static void * bench_wait_echo(void * arg)
+{
+    Bench_Wait_t * bench = (Bench_Wait_t *)arg;
+    RingBuffer_Item_t item;
+
+    for(unsigned long i = 0; i < BENCH_WAIT_ROUND_TRIPS; i++)
+    {
+        RingBufferWait_enGetItem(&bench->ping, &item, RING_BUFFER_WAIT_FOREVER);
+        RingBufferWait_enPutItem(&bench->pong, &item, RING_BUFFER_WAIT_FOREVER);
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Consumer thread of CPU cost benchmark, gets #BENCH_WAIT_ITEMS items and measures its CPU time
+ */
+static void * bench_wait_consumer(void * arg)
+{
+    Bench_Wait_t * bench = (Bench_Wait_t *)arg;
+    RingBuffer_Item_t item;
+    struct timespec start;
+    struct timespec end;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+
+    for(unsigned long i = 0; i < BENCH_WAIT_ITEMS; i++)
+    {
+        RingBufferWait_enGetItem(&bench->ping, &item, RING_BUFFER_WAIT_FOREVER);
+    }
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+    bench->cpu_time = bench_wait_elapsed(&start, &end);
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Run ping pong benchmark using @p strategy, return average round trip time in nanoseconds
+ */
+static double bench_wait_latency(Bench_Wait_t * bench, RingBufferWait_Strategy_t strategy)
+{
+    static RingBuffer_Item_t ping_data [BENCH_WAIT_RING_BUFFER_SIZE];
+    static RingBuffer_Item_t pong_data [BENCH_WAIT_RING_BUFFER_SIZE];
+    RingBuffer_Item_t item = 0;
+    struct timespec start;
+    struct timespec end;
+    pthread_t echo;
+
+    RingBufferWait_enInit(&bench->ping, ping_data, BENCH_WAIT_RING_BUFFER_SIZE, strategy, RING_BUFFER_WAIT_SPIN_COUNT);
+    RingBufferWait_enInit(&bench->pong, pong_data, BENCH_WAIT_RING_BUFFER_SIZE, strategy, RING_BUFFER_WAIT_SPIN_COUNT);
+
+    pthread_create(&echo, NULL, bench_wait_echo, bench);
+
+    timespec_get(&start, TIME_UTC);
+
+    for(unsigned long i = 0; i < BENCH_WAIT_ROUND_TRIPS; i++)
+    {
+        RingBufferWait_enPutItem(&bench->ping, &item, RING_BUFFER_WAIT_FOREVER);
+        RingBufferWait_enGetItem(&bench->pong, &item, RING_BUFFER_WAIT_FOREVER);
+    }
+
+    timespec_get(&end, TIME_UTC);
+
+    pthread_join(echo, NULL);
+
+    return (bench_wait_elapsed(&start, &end) * 1e9) / (double)BENCH_WAIT_ROUND_TRIPS;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Run CPU cost benchmark using @p strategy, return consumer CPU time relative to wall clock time, in percent
+ */
+static double bench_wait_cpu_cost(Bench_Wait_t * bench, RingBufferWait_Strategy_t strategy)
+{
+    static RingBuffer_Item_t ping_data [BENCH_WAIT_RING_BUFFER_SIZE];
+    struct timespec period = { 0, BENCH_WAIT_PERIOD_NS };
+    RingBuffer_Item_t item = 0;
+    struct timespec start;
+    struct timespec end;
+    pthread_t consumer;
+
+    RingBufferWait_enInit(&bench->ping, ping_data, BENCH_WAIT_RING_BUFFER_SIZE, strategy, RING_BUFFER_WAIT_SPIN_COUNT);
+
+    timespec_get(&start, TIME_UTC);
+
+    pthread_create(&consumer, NULL, bench_wait_consumer, bench);
+
+    /*  slow producer, the consumer waits most of the time  */
+    for(unsigned long i = 0; i < BENCH_WAIT_ITEMS; i++)
+    {
+        nanosleep(&period, NULL);
+        RingBufferWait_enPutItem(&bench->ping, &item, RING_BUFFER_WAIT_FOREVER);
+    }
+
+    pthread_join(consumer, NULL);
+
+    timespec_get(&end, TIME_UTC);
+
+    return (bench->cpu_time * 100.0) / bench_wait_elapsed(&start, &end);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void bench_ring_buffer_wait(void)
+{
+    static Bench_Wait_t bench;
+
+    printf("\nWait ring buffer size %u, %lu round trips, %lu items every %ld ns, spin count %u\n",
+            (unsigned)BENCH_WAIT_RING_BUFFER_SIZE, BENCH_WAIT_ROUND_TRIPS, BENCH_WAIT_ITEMS, BENCH_WAIT_PERIOD_NS, (unsigned)RING_BUFFER_WAIT_SPIN_COUNT);
+
+    for(RingBufferWait_Strategy_t strategy = RING_BUFFER_WAIT_SPIN; strategy <= RING_BUFFER_WAIT_PARK; strategy++)
+    {
+        double latency = bench_wait_latency(&bench, strategy);
+        double cpu_cost = bench_wait_cpu_cost(&bench, strategy);
+
+        printf("%-16s: round trip %10.1f ns, waiting consumer CPU %6.1f %%\n", bench_wait_names[strategy], latency, cpu_cost);
+    }
+}
+
+#else
+
+void bench_ring_buffer_wait(void)
+{
+    printf("\nWait ring buffer benchmark skipped, needs -DRING_BUFFER_ATOMIC on Linux\n");
+}
+
+#endif /*  RING_BUFFER_WAIT  */
@@ -0,0 +1,6 @@
+#ifndef _bench_ring_buffer_wait_H_
+#define _bench_ring_buffer_wait_H_
+
+void bench_ring_buffer_wait(void);
+
+#endif /* _bench_ring_buffer_wait_H_    */
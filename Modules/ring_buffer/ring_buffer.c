@@ -15,6 +15,7 @@
 
 #include "utils/utils.h"
 #include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
 
 
 /* ---------------------------------------------------------------------------
@@ -30,6 +31,33 @@
  *
  * ------------------------------------------------------------------------- */
 
+/* ---------------------------------------------------------------------------
+ *
+ * When RING_BUFFER_FREE_RUNNING is enabled, head & tail are free running counters:
+ * - tail : number of items written to the ring_buffer
+ * - head : number of items read from the ring_buffer
+ * - tail - head : number of items in the ring_buffer (0 <= tail - head <= size)
+ * - Items are stored in ring_buffer->data[counter & (size - 1)]
+ *
+ * ------------------------------------------------------------------------- */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Empty @p ring_buffer: read, write pointers and their cached copies are reset to 0,
+ *        data and mirrored data (#RING_BUFFER_MIRROR) are kept.
+ */
+static inline void RingBuffer_xResetPointers(RingBuffer_t * const ring_buffer)
+{
+    RingBuffer_xStoreRelease(&ring_buffer->head, 0);
+    RingBuffer_xStoreRelease(&ring_buffer->tail, 0);
+
+#if RING_BUFFER_CACHE_LINE_SIZE
+    ring_buffer->head_cache = 0;
+    ring_buffer->tail_cache = 0;
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+}
+
 /* ------------------------------------------------------------------------- */
 
 RingBuffer_Error_t RingBuffer_enInit(RingBuffer_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size)
@@ -47,12 +75,23 @@ RingBuffer_Error_t RingBuffer_enInit(RingBuffer_t * ring_buffer, RingBuffer_Item
         return RING_BUFFER_ERROR_INVALID_PARAM;
     }
 
+#if RING_BUFFER_POWER_OF_TWO
+
+    if(size & (size - 1))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+
 #endif /*  DEBUG_RING_BUFFER  */
 
     ring_buffer->data = (RingBuffer_Item_t * const)data;
     ring_buffer->size = size;
-    ring_buffer->head = 0;
-    ring_buffer->tail = 0;
+#if RING_BUFFER_MIRROR
+    ring_buffer->mirror = 0;
+#endif /*  RING_BUFFER_MIRROR  */
+    RingBuffer_xResetPointers(ring_buffer);
 
     return RING_BUFFER_ERROR_NONE;
 }
@@ -63,14 +102,16 @@ RingBuffer_Error_t RingBuffer_enReset(RingBuffer_t * const ring_buffer)
 {
 #ifdef DEBUG_RING_BUFFER
 
-    if(IS_NULLPTR(ring_buffer))
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
     {
         return RING_BUFFER_ERROR_NULLPTR;
     }
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    return RingBuffer_enInit(ring_buffer, ring_buffer->data, ring_buffer->size);
+    RingBuffer_xResetPointers(ring_buffer);
+
+    return RING_BUFFER_ERROR_NONE;
 }
 
 /* ------------------------------------------------------------------------- */
@@ -94,51 +135,16 @@ RingBuffer_Error_t RingBuffer_enFree(RingBuffer_t * const ring_buffer)
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enPutItem(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
+/*  function names are in parentheses, so they aren't expanded when #RING_BUFFER_INLINE maps them to inline functions  */
+RingBuffer_Error_t (RingBuffer_enPutItem)(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
 {
-    RingBuffer_Counter_t RingBuffer_tail;
-
-#ifdef DEBUG_RING_BUFFER
-
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item))
-    {
-        return RING_BUFFER_ERROR_NULLPTR;
-    }
-
-#endif /*  DEBUG_RING_BUFFER  */
-
-    /*  calculate new ring_buffer tail value  */
-
-    RingBuffer_tail = ring_buffer->tail + 1;
-    if(RingBuffer_tail == ring_buffer->size)
-    {
-        RingBuffer_tail = 0;
-    }
-
-    /*  check if ring_buffer is full  */
-    if(RingBuffer_tail == ring_buffer->head)
-    {
-        return RING_BUFFER_ERROR_FULL;
-    }
-
-    /*  put item into ring_buffer  */
-    memcpy(&ring_buffer->data[ring_buffer->tail], item, sizeof(RingBuffer_Item_t));
-
-    /*  update ring_buffer tail pointer  */
-    ring_buffer->tail = RingBuffer_tail;
-
-    return RING_BUFFER_ERROR_NONE;
+    return RingBuffer_enPutItemInline(ring_buffer, item);
 }
 
 /* ------------------------------------------------------------------------- */
 
 RingBuffer_Error_t RingBuffer_enPutItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
 {
-    RingBuffer_Counter_t tail;
-    RingBuffer_Counter_t free_count;
-    RingBuffer_Counter_t write_count;
-    RingBuffer_Counter_t truncated_len;
-
 #ifdef DEBUG_RING_BUFFER
 
     if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
@@ -153,69 +159,12 @@ RingBuffer_Error_t RingBuffer_enPutItems(RingBuffer_t * const ring_buffer, RingB
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    /*  Get number of free items in ring buffer */
-    RingBuffer_enFreeCount(ring_buffer, &free_count);
-
-    /*  if ring buffer is full  */
-    if(free_count == 0)
-    {
-        (*item_count) = 0;
-        return RING_BUFFER_ERROR_FULL;
-    }
-
-    /*  maximum number of free items in the ring buffer  */
-    truncated_len = MIN(len, free_count);
-
-    /*  Get ring_buffer's current tail  */
-    tail = ring_buffer->tail;
-
-    /*
-     * maximum number of items that can added to queue after tail pointer
-     * either:
-     *  - between tail & head (tail < head), or
-     *  - between head & ring_buffer->size (tail > head)
-     * */
-    write_count = MIN((RingBuffer_Counter_t)(ring_buffer->size - tail), truncated_len);
-
-    /*  copy items to ring buffer  */
-    memcpy(
-            &ring_buffer->data[tail],
-            items,
-            write_count
-    );
-
-    tail += write_count;
-    truncated_len -= write_count;
-
-    /*
-     * check if there are still more items to write
-     * in case (tail > head) && (head > 0)
-     * there are some free items @ start of the ring buffer
-     * */
-    if(truncated_len)
-    {
-        memcpy(
-                ring_buffer->data,
-                &items[write_count],
-                truncated_len
-        );
-
-        tail = truncated_len;
-    }
-
-    if(tail >= ring_buffer->size)
-    {
-        tail = 0;
-    }
-
-    /*  update ring_buffer's tail  */
-    ring_buffer->tail = tail;
-
-    (*item_count) = (truncated_len + write_count);
+    (*item_count) = RingBuffer_uPutItems(ring_buffer, items, len);
 
-    if(free_count < len)
+    /*  no free locations, or less than len  */
+    if((*item_count) < len)
     {
-        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+        return (*item_count) ? RING_BUFFER_ERROR_INSUFFICIENT_ITEMS : RING_BUFFER_ERROR_FULL;
     }
 
     return RING_BUFFER_ERROR_NONE;
@@ -223,52 +172,15 @@ RingBuffer_Error_t RingBuffer_enPutItems(RingBuffer_t * const ring_buffer, RingB
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enGetItem(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
+RingBuffer_Error_t (RingBuffer_enGetItem)(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
 {
-    RingBuffer_Counter_t RingBuffer_head;
-
-#ifdef DEBUG_RING_BUFFER
-
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item))
-    {
-        return RING_BUFFER_ERROR_NULLPTR;
-    }
-
-#endif /*  DEBUG_RING_BUFFER  */
-
-    RingBuffer_head = ring_buffer->head;
-
-    /*  check if ring_buffer is empty  */
-    if(RingBuffer_head == ring_buffer->tail)
-    {
-        return RING_BUFFER_ERROR_EMPTY;
-    }
-
-    /*  get item from ring_buffer  */
-    memcpy(item, &ring_buffer->data[RingBuffer_head], sizeof(RingBuffer_Item_t));
-
-    /*  calculate new ring_buffer head  */
-    RingBuffer_head++;
-    if(RingBuffer_head == ring_buffer->size)
-    {
-        RingBuffer_head = 0;
-    }
-
-    /*  update ring_buffer head pointer  */
-    ring_buffer->head = RingBuffer_head;
-
-    return RING_BUFFER_ERROR_NONE;
+    return RingBuffer_enGetItemInline(ring_buffer, item);
 }
 
 /* ------------------------------------------------------------------------- */
 
 RingBuffer_Error_t RingBuffer_enGetItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
 {
-    RingBuffer_Counter_t head;
-    RingBuffer_Counter_t available_items;
-    RingBuffer_Counter_t truncated_len;
-    RingBuffer_Counter_t read_count;
-
 #ifdef DEBUG_RING_BUFFER
 
     if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
@@ -283,68 +195,12 @@ RingBuffer_Error_t RingBuffer_enGetItems(RingBuffer_t * const ring_buffer, RingB
 
 #endif /*  DEBUG_RING_BUFFER  */
 
+    (*item_count) = RingBuffer_uGetItems(ring_buffer, items, len);
 
-    /*  get number of available items in ring buffer  */
-    RingBuffer_enItemCount(ring_buffer, &available_items);
-
-
-    if(available_items == 0)
-    {
-        (*item_count) = 0;
-        return RING_BUFFER_ERROR_EMPTY;
-    }
-
-    /*  maximum number of items available to read from ring buffer  */
-    truncated_len = MIN(len, available_items);
-
-    /*  Get ring_buffer head  */
-    head = ring_buffer->head;
-
-    /*
-     * maximum number of items to read from ring buffer after head pointer
-     * either:
-     * - between head & tail (head < tail)
-     * - between head & ring_buffer->size (head > tail)
-     * */
-    read_count = MIN((RingBuffer_Counter_t)(ring_buffer->size - head), truncated_len);
-
-    /*  copy items from ring buffer  */
-    memcpy(
-            items,
-            &ring_buffer->data[head],
-            read_count
-    );
-
-    head += read_count;
-    truncated_len -= read_count;
-
-    /*
-     * check if there are more items to read
-     * (head > tail) && (tail >= 0)
-     * */
-    if(truncated_len)
-    {
-        memcpy(
-                &items[read_count],
-                ring_buffer->data,
-                truncated_len
-        );
-
-        head = truncated_len;
-    }
-
-    if(head >= ring_buffer->size)
-    {
-        head = 0;
-    }
-
-    ring_buffer->head = head;
-
-    (*item_count) = (truncated_len + read_count);
-
-    if(available_items < len)
+    /*  no items, or less than len  */
+    if((*item_count) < len)
     {
-        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+        return (*item_count) ? RING_BUFFER_ERROR_INSUFFICIENT_ITEMS : RING_BUFFER_ERROR_EMPTY;
     }
 
     return RING_BUFFER_ERROR_NONE;
@@ -352,37 +208,35 @@ RingBuffer_Error_t RingBuffer_enGetItems(RingBuffer_t * const ring_buffer, RingB
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enPeekItems(RingBuffer_t * ring_buffer, RingBuffer_Item_t * items, RingBuffer_Counter_t len, RingBuffer_Counter_t offset, RingBuffer_Counter_t * item_count)
+/**
+ * @brief Peek up to @p len items @p offset items after the oldest item, and store number of items in the ring buffer in @p available.
+ *
+ * @return number of items peeked
+ */
+static inline RingBuffer_Counter_t RingBuffer_xPeekItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len,
+                                                         RingBuffer_Counter_t offset, RingBuffer_Counter_t * const available)
 {
     RingBuffer_Counter_t head;
     RingBuffer_Counter_t tail;
     RingBuffer_Counter_t available_items;
     RingBuffer_Counter_t items_to_peek;
     RingBuffer_Counter_t read_count;
+    RingBuffer_Counter_t capacity;
+    RingBuffer_Counter_t needed;
 
-#ifdef DEBUG_RING_BUFFER
-
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
-    {
-        return RING_BUFFER_ERROR_NULLPTR;
-    }
-
-    if(IS_ZERO(len))
-    {
-        return RING_BUFFER_ERROR_INVALID_PARAM;
-    }
-
-#endif /*  DEBUG_RING_BUFFER  */
+    /*  number of items needed to peek @ offset, (offset + len) limited to ring buffer capacity  */
+    capacity = RingBuffer_xCapacity(ring_buffer);
+    needed = (offset < capacity) ? (RingBuffer_Counter_t)(offset + MIN(len, (RingBuffer_Counter_t)(capacity - offset))) : capacity;
 
     /*  Get copy of ring_buffer head & tail */
-    head = ring_buffer->head;
-    tail = ring_buffer->tail;
+    head = RingBuffer_xLoadOwn(&ring_buffer->head);
+    tail = RingBuffer_xConsumerTail(ring_buffer, head, needed);
 
     /*  Check if ring_buffer is empty  */
     if(head == tail)
     {
-        (*item_count) = 0;
-        return RING_BUFFER_ERROR_EMPTY;
+        (*available) = 0;
+        return 0;
     }
 
     /**
@@ -390,124 +244,71 @@ RingBuffer_Error_t RingBuffer_enPeekItems(RingBuffer_t * ring_buffer, RingBuffer
      *
      * 2 - get total number of items to peek from ring buffer, according to offset :
      *
-     *   - if offset < available_items, items_to_peek = available_items - offset. Else items_to_peek = 0 (return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS)
+     *   - if offset < available_items, items_to_peek = available_items - offset. Else items_to_peek = 0 (nothing to peek)
      *   -
      *
      * */
 
     /*  Get number of available items in the ring_buffer  */
-    RingBuffer_enItemCount(ring_buffer, &available_items);
+    available_items = RingBuffer_xItemCount(ring_buffer, head, tail);
+    (*available) = available_items;
 
     /*  if offset >= number of items  */
     if(offset >= available_items)
     {
-        (*item_count) = 0;
-        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+        return 0;
     }
 
     items_to_peek = MIN((RingBuffer_Counter_t)(available_items - offset), len);
 
-    head += offset;
-    if(head >= ring_buffer->size)
-    {
-        head = head - ring_buffer->size;
-    }
+    head = RingBuffer_xIndex(ring_buffer, RingBuffer_xWrap(ring_buffer, head, offset));
 
     /*  Peek items from ring_buffer into data buffer  */
-    read_count = MIN((RingBuffer_Counter_t)(ring_buffer->size - head), items_to_peek);
+    read_count = MIN(RingBuffer_xLinearCount(ring_buffer, head), items_to_peek);
 
-    memcpy(
-            items,
-            &ring_buffer->data[head],
-            read_count * sizeof(RingBuffer_Item_t)
-    );
+    RingBuffer_xCopyItems(items, &ring_buffer->data[head], read_count);
 
     items_to_peek -= read_count;
 
     if(items_to_peek)
     {
-        memcpy(
-                &items[read_count],
-                ring_buffer->data,
-                items_to_peek * sizeof(RingBuffer_Item_t)
-        );
-    }
-
-    (*item_count) = (items_to_peek + read_count);
-
-    if((available_items - offset) < len)
-    {
-        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+        RingBuffer_xCopyItems(&items[read_count], ring_buffer->data, items_to_peek);
     }
 
-    return RING_BUFFER_ERROR_NONE;
+    return (RingBuffer_Counter_t)(items_to_peek + read_count);
 }
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enItemCount(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * item_count)
+RingBuffer_Error_t RingBuffer_enPeekItems(RingBuffer_t * ring_buffer, RingBuffer_Item_t * items, RingBuffer_Counter_t len, RingBuffer_Counter_t offset, RingBuffer_Counter_t * item_count)
 {
-    RingBuffer_Counter_t tail;
-    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t available;
 
 #ifdef DEBUG_RING_BUFFER
 
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item_count))
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
     {
         return RING_BUFFER_ERROR_NULLPTR;
     }
 
-#endif /*  DEBUG_RING_BUFFER  */
-
-    tail = ring_buffer->tail;
-    head = ring_buffer->head;
-
-    if(tail > head)
-    {
-        (*item_count) = tail - head;
-    }
-    else if(tail < head)
-    {
-        (*item_count) = (RingBuffer_Counter_t)(tail + ring_buffer->size - head);
-    }
-    else
-    {
-        (*item_count) = 0;
-    }
-
-    return RING_BUFFER_ERROR_NONE;
-}
-
-/* ------------------------------------------------------------------------- */
-
-RingBuffer_Error_t RingBuffer_enFreeCount(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * free_count)
-{
-    RingBuffer_Counter_t tail;
-    RingBuffer_Counter_t head;
-
-#ifdef DEBUG_RING_BUFFER
-
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(free_count))
+    if(IS_ZERO(len))
     {
-        return RING_BUFFER_ERROR_NULLPTR;
+        return RING_BUFFER_ERROR_INVALID_PARAM;
     }
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    tail = ring_buffer->tail;
-    head = ring_buffer->head;
+    (*item_count) = RingBuffer_xPeekItems(ring_buffer, items, len, offset, &available);
 
-    if(tail > head)
-    {
-        (*free_count) = (RingBuffer_Counter_t)(ring_buffer->size - (tail - head) - 1);
-    }
-    else if(head > tail)
+    if(available == 0)
     {
-        (*free_count) = (RingBuffer_Counter_t)((head - tail) - 1);
+        return RING_BUFFER_ERROR_EMPTY;
     }
-    else
+
+    /*  offset past the items, or less than len items after offset  */
+    if((*item_count) < len)
     {
-        (*free_count) = ring_buffer->size - 1;
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
     }
 
     return RING_BUFFER_ERROR_NONE;
@@ -515,42 +316,30 @@ RingBuffer_Error_t RingBuffer_enFreeCount(RingBuffer_t * ring_buffer, RingBuffer
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enIsEmpty(RingBuffer_t * ring_buffer, uint8_t * is_empty)
+RingBuffer_Error_t (RingBuffer_enItemCount)(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * item_count)
 {
-#ifdef DEBUG_RING_BUFFER
-
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(is_empty))
-    {
-        return RING_BUFFER_ERROR_NULLPTR;
-    }
-
-#endif /*  DEBUG_RING_BUFFER  */
-
-    (*is_empty) = (ring_buffer->head == ring_buffer->tail);
-
-    return RING_BUFFER_ERROR_NONE;
+    return RingBuffer_enItemCountInline(ring_buffer, item_count);
 }
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enIsFull(RingBuffer_t * ring_buffer, uint8_t * is_full)
+RingBuffer_Error_t (RingBuffer_enFreeCount)(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * free_count)
 {
-    RingBuffer_Counter_t count = 0;
-
-#ifdef DEBUG_RING_BUFFER
-
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(is_full))
-    {
-        return RING_BUFFER_ERROR_NULLPTR;
-    }
+    return RingBuffer_enFreeCountInline(ring_buffer, free_count);
+}
 
-#endif /*  DEBUG_RING_BUFFER  */
+/* ------------------------------------------------------------------------- */
 
-    RingBuffer_enItemCount(ring_buffer, &count);
+RingBuffer_Error_t (RingBuffer_enIsEmpty)(RingBuffer_t * ring_buffer, uint8_t * is_empty)
+{
+    return RingBuffer_enIsEmptyInline(ring_buffer, is_empty);
+}
 
-    (*is_full) = (count == (ring_buffer->size - 1));
+/* ------------------------------------------------------------------------- */
 
-    return RING_BUFFER_ERROR_NONE;
+RingBuffer_Error_t (RingBuffer_enIsFull)(RingBuffer_t * ring_buffer, uint8_t * is_full)
+{
+    return RingBuffer_enIsFullInline(ring_buffer, is_full);
 }
 
 /* ------------------------------------------------------------------------- */
@@ -598,6 +387,12 @@ const char * RingBuffer_pcError(RingBuffer_Error_t error)
         }
         break;
 
+        case RING_BUFFER_ERROR_SYSTEM:
+        {
+            error_string = "RING_BUFFER_ERROR_SYSTEM";
+        }
+        break;
+
         default:
         {
             error_string = "UNKNOWN";
@@ -615,10 +410,6 @@ const char * RingBuffer_pcError(RingBuffer_Error_t error)
 
 RingBuffer_Error_t RingBuffer_enSkipItems(RingBuffer_t * ring_buffer, RingBuffer_Counter_t skip_count, RingBuffer_Counter_t * skipped)
 {
-    RingBuffer_Counter_t head;
-    RingBuffer_Counter_t item_count;
-    RingBuffer_Counter_t skipped_items;
-
 #ifdef DEBUG_RING_BUFFER
 
     if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(skipped))
@@ -633,30 +424,11 @@ RingBuffer_Error_t RingBuffer_enSkipItems(RingBuffer_t * ring_buffer, RingBuffer
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    RingBuffer_enItemCount(ring_buffer, &item_count);
-
-    if(item_count == 0)
-    {
-        (*skipped) = 0;
-        return RING_BUFFER_ERROR_EMPTY;
-    }
-
-    skipped_items = MIN(item_count, skip_count);
-
-    head = ring_buffer->head;
-    head += skipped_items;
+    (*skipped) = RingBuffer_uSkipItems(ring_buffer, skip_count);
 
-    if(head >= ring_buffer->size)
+    if((*skipped) < skip_count)
     {
-        head -= ring_buffer->size;
-    }
-
-    ring_buffer->head = head;
-    (*skipped) = skipped_items;
-
-    if(skipped_items != skip_count)
-    {
-        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+        return (*skipped) ? RING_BUFFER_ERROR_INSUFFICIENT_ITEMS : RING_BUFFER_ERROR_EMPTY;
     }
 
     return RING_BUFFER_ERROR_NONE;
@@ -666,10 +438,6 @@ RingBuffer_Error_t RingBuffer_enSkipItems(RingBuffer_t * ring_buffer, RingBuffer
 
 RingBuffer_Error_t RingBuffer_enAdvance(RingBuffer_t * ring_buffer, RingBuffer_Counter_t advance_count, RingBuffer_Counter_t * advanced)
 {
-    RingBuffer_Counter_t tail;
-    RingBuffer_Counter_t free_count;
-    RingBuffer_Counter_t advanced_items;
-
 #ifdef DEBUG_RING_BUFFER
 
     if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(advanced))
@@ -684,56 +452,81 @@ RingBuffer_Error_t RingBuffer_enAdvance(RingBuffer_t * ring_buffer, RingBuffer_C
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    RingBuffer_enFreeCount(ring_buffer, &free_count);
+    (*advanced) = RingBuffer_uAdvance(ring_buffer, advance_count);
 
-    if(free_count == 0)
+    if((*advanced) < advance_count)
     {
-        (*advanced) = 0;
-        return RING_BUFFER_ERROR_FULL;
+        return (*advanced) ? RING_BUFFER_ERROR_INSUFFICIENT_ITEMS : RING_BUFFER_ERROR_FULL;
     }
 
-    advanced_items = MIN(free_count, advance_count);
-
-    tail = ring_buffer->tail;
-    tail += advance_count;
+    return RING_BUFFER_ERROR_NONE;
+}
 
-    if(tail >= ring_buffer->size)
-    {
-        tail -= ring_buffer->size;
-    }
+/* ------------------------------------------------------------------------- */
 
-    ring_buffer->tail = tail;
-    (*advanced) = advanced_items;
+RingBuffer_Error_t RingBuffer_enBlockReadAddress(RingBuffer_t * const ring_buffer, RingBuffer_Item_t ** const read_address)
+{
+#ifdef DEBUG_RING_BUFFER
 
-    if(advanced_items != advance_count)
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(read_address))
     {
-        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+        return RING_BUFFER_ERROR_NULLPTR;
     }
 
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*read_address) = &ring_buffer->data[RingBuffer_xIndex(ring_buffer, RingBuffer_xLoadOwn(&ring_buffer->head))];
+
     return RING_BUFFER_ERROR_NONE;
 }
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enBlockReadAddress(RingBuffer_t * const ring_buffer, RingBuffer_Item_t ** const read_address)
+RingBuffer_Error_t RingBuffer_enBlockReadCount(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * count)
 {
+    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t tail;
+
 #ifdef DEBUG_RING_BUFFER
 
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(read_address))
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(count))
     {
         return RING_BUFFER_ERROR_NULLPTR;
     }
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    (*read_address) = &ring_buffer->data[ring_buffer->head];
+    /*  block read count is the maximum number of readable items, tail is always refreshed  */
+    head = RingBuffer_xLoadOwn(&ring_buffer->head);
+    tail = RingBuffer_xConsumerTail(ring_buffer, head, ring_buffer->size);
+
+    /*  items in ring buffer, up to the end of ring buffer data  */
+    (*count) = MIN(RingBuffer_xItemCount(ring_buffer, head, tail), RingBuffer_xLinearCount(ring_buffer, RingBuffer_xIndex(ring_buffer, head)));
 
     return RING_BUFFER_ERROR_NONE;
 }
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enBlockReadCount(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * count)
+RingBuffer_Error_t RingBuffer_enBlockWriteAddress(RingBuffer_t * ring_buffer, RingBuffer_Item_t ** write_address)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(write_address))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*write_address) = &ring_buffer->data[RingBuffer_xIndex(ring_buffer, RingBuffer_xLoadOwn(&ring_buffer->tail))];
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enBlockWriteCount(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * count)
 {
     RingBuffer_Counter_t head;
     RingBuffer_Counter_t tail;
@@ -747,20 +540,54 @@ RingBuffer_Error_t RingBuffer_enBlockReadCount(RingBuffer_t * ring_buffer, RingB
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    head = ring_buffer->head;
-    tail = ring_buffer->tail;
+    /*  block write count is the maximum number of writable items, head is always refreshed  */
+    tail = RingBuffer_xLoadOwn(&ring_buffer->tail);
+    head = RingBuffer_xProducerHead(ring_buffer, tail, ring_buffer->size);
+
+    /*  free locations in ring buffer, up to the end of ring buffer data  */
+    (*count) = MIN(RingBuffer_xFreeCount(ring_buffer, head, tail), RingBuffer_xLinearCount(ring_buffer, RingBuffer_xIndex(ring_buffer, tail)));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enReserve(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Span_t * const first, RingBuffer_Span_t * const second, RingBuffer_Counter_t * const reserved)
+{
+    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t reserved_items;
+
+#ifdef DEBUG_RING_BUFFER
 
-    if(head < tail)
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(first) || IS_NULLPTR(second) || IS_NULLPTR(reserved))
     {
-        (*count) = tail - head;
+        return RING_BUFFER_ERROR_NULLPTR;
     }
-    else if(head > tail)
+
+    if(IS_ZERO(len))
     {
-        (*count) = ring_buffer->size - head;
+        return RING_BUFFER_ERROR_INVALID_PARAM;
     }
-    else
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    tail = RingBuffer_xLoadOwn(&ring_buffer->tail);
+    free_count = RingBuffer_xFreeCount(ring_buffer, RingBuffer_xProducerHead(ring_buffer, tail, MIN(len, RingBuffer_xCapacity(ring_buffer))), tail);
+
+    reserved_items = MIN(free_count, len);
+
+    RingBuffer_xSpans(ring_buffer, tail, reserved_items, first, second);
+    (*reserved) = reserved_items;
+
+    if(reserved_items == 0)
+    {
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    if(reserved_items != len)
     {
-        (*count) = 0;
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
     }
 
     return RING_BUFFER_ERROR_NONE;
@@ -768,56 +595,463 @@ RingBuffer_Error_t RingBuffer_enBlockReadCount(RingBuffer_t * ring_buffer, RingB
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enBlockWriteAddress(RingBuffer_t * ring_buffer, RingBuffer_Item_t ** write_address)
+RingBuffer_Error_t RingBuffer_enCommit(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t count)
 {
+    RingBuffer_Counter_t tail;
+
 #ifdef DEBUG_RING_BUFFER
 
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(write_address))
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
     {
         return RING_BUFFER_ERROR_NULLPTR;
     }
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    (*write_address) = &ring_buffer->data[ring_buffer->tail];
+    tail = RingBuffer_xLoadOwn(&ring_buffer->tail);
+
+#ifdef DEBUG_RING_BUFFER
+
+    /*  reserved locations are free, free space can only grow after reserving  */
+    if(count > RingBuffer_xFreeCount(ring_buffer, RingBuffer_xProducerHead(ring_buffer, tail, count), tail))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    if(count != 0)
+    {
+        RingBuffer_xStoreRelease(&ring_buffer->tail, RingBuffer_xWrap(ring_buffer, tail, count));
+    }
 
     return RING_BUFFER_ERROR_NONE;
 }
 
 /* ------------------------------------------------------------------------- */
 
-RingBuffer_Error_t RingBuffer_enBlockWriteCount(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * count)
+RingBuffer_Error_t RingBuffer_enAcquire(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Span_t * const first, RingBuffer_Span_t * const second, RingBuffer_Counter_t * const acquired)
 {
     RingBuffer_Counter_t head;
-    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Counter_t acquired_items;
 
 #ifdef DEBUG_RING_BUFFER
 
-    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(count))
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(first) || IS_NULLPTR(second) || IS_NULLPTR(acquired))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    head = RingBuffer_xLoadOwn(&ring_buffer->head);
+    item_count = RingBuffer_xItemCount(ring_buffer, head, RingBuffer_xConsumerTail(ring_buffer, head, MIN(len, RingBuffer_xCapacity(ring_buffer))));
+
+    acquired_items = MIN(item_count, len);
+
+    RingBuffer_xSpans(ring_buffer, head, acquired_items, first, second);
+    (*acquired) = acquired_items;
+
+    if(acquired_items == 0)
+    {
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    if(acquired_items != len)
+    {
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enRelease(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t count)
+{
+    RingBuffer_Counter_t head;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    head = RingBuffer_xLoadOwn(&ring_buffer->head);
+
+#ifdef DEBUG_RING_BUFFER
+
+    /*  acquired items are in the ring buffer, item count can only grow after acquiring  */
+    if(count > RingBuffer_xItemCount(ring_buffer, head, RingBuffer_xConsumerTail(ring_buffer, head, count)))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    if(count != 0)
+    {
+        RingBuffer_xStoreRelease(&ring_buffer->head, RingBuffer_xWrap(ring_buffer, head, count));
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enPutBatchBegin(RingBuffer_t * const ring_buffer, RingBuffer_Batch_t * const batch, RingBuffer_Counter_t publish_count)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(batch))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    batch->ring_buffer = ring_buffer;
+    batch->index = RingBuffer_xLoadOwn(&ring_buffer->tail);
+    batch->available = 0;
+    batch->pending = 0;
+    batch->publish_count = publish_count;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enPutBatchItem(RingBuffer_Batch_t * const batch, RingBuffer_Item_t const * const item)
+{
+    RingBuffer_t * ring_buffer;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(batch) || IS_NULLPTR(batch->ring_buffer) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    ring_buffer = batch->ring_buffer;
+
+    if(batch->available == 0)
+    {
+        /*  only read consumer's head when known free locations are used  */
+        batch->available = RingBuffer_xFreeCount(ring_buffer, RingBuffer_xProducerHead(ring_buffer, batch->index, RingBuffer_xCapacity(ring_buffer)), batch->index);
+
+        if(batch->available == 0)
+        {
+            (void)RingBuffer_enPutBatchEnd(batch);
+            return RING_BUFFER_ERROR_FULL;
+        }
+    }
+
+    ring_buffer->data[RingBuffer_xIndex(ring_buffer, batch->index)] = (*item);
+    batch->index = RingBuffer_xWrap(ring_buffer, batch->index, 1);
+    batch->available--;
+    batch->pending++;
+
+    if(batch->pending == batch->publish_count)
+    {
+        (void)RingBuffer_enPutBatchEnd(batch);
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enPutBatchEnd(RingBuffer_Batch_t * const batch)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(batch) || IS_NULLPTR(batch->ring_buffer))
     {
         return RING_BUFFER_ERROR_NULLPTR;
     }
 
 #endif /*  DEBUG_RING_BUFFER  */
 
-    head = ring_buffer->head;
-    tail = ring_buffer->tail;
+    if(batch->pending != 0)
+    {
+        RingBuffer_xStoreRelease(&batch->ring_buffer->tail, batch->index);
+        batch->pending = 0;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enGetBatchBegin(RingBuffer_t * const ring_buffer, RingBuffer_Batch_t * const batch, RingBuffer_Counter_t publish_count)
+{
+#ifdef DEBUG_RING_BUFFER
 
-    if(head <= tail)
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(batch))
     {
-        (*count) = ring_buffer->size - tail;
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    batch->ring_buffer = ring_buffer;
+    batch->index = RingBuffer_xLoadOwn(&ring_buffer->head);
+    batch->available = 0;
+    batch->pending = 0;
+    batch->publish_count = publish_count;
 
-        if(head == 0)
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enGetBatchItem(RingBuffer_Batch_t * const batch, RingBuffer_Item_t * const item)
+{
+    RingBuffer_t * ring_buffer;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(batch) || IS_NULLPTR(batch->ring_buffer) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    ring_buffer = batch->ring_buffer;
+
+    if(batch->available == 0)
+    {
+        /*  only read producer's tail when known items are used  */
+        batch->available = RingBuffer_xItemCount(ring_buffer, batch->index, RingBuffer_xConsumerTail(ring_buffer, batch->index, RingBuffer_xCapacity(ring_buffer)));
+
+        if(batch->available == 0)
         {
-            (*count)--;
+            (void)RingBuffer_enGetBatchEnd(batch);
+            return RING_BUFFER_ERROR_EMPTY;
         }
     }
-    else /* if(head > tail)  */
+
+    (*item) = ring_buffer->data[RingBuffer_xIndex(ring_buffer, batch->index)];
+    batch->index = RingBuffer_xWrap(ring_buffer, batch->index, 1);
+    batch->available--;
+    batch->pending++;
+
+    if(batch->pending == batch->publish_count)
+    {
+        (void)RingBuffer_enGetBatchEnd(batch);
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enGetBatchEnd(RingBuffer_Batch_t * const batch)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(batch) || IS_NULLPTR(batch->ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    if(batch->pending != 0)
     {
-        (*count) = (RingBuffer_Counter_t)(head - tail - 1);
+        RingBuffer_xStoreRelease(&batch->ring_buffer->head, batch->index);
+        batch->pending = 0;
     }
 
     return RING_BUFFER_ERROR_NONE;
 }
 
 /* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t (RingBuffer_uPutItem)(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const item)
+{
+    return RingBuffer_uPutItemInline(ring_buffer, item);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t RingBuffer_uPutItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len)
+{
+    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t index;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t write_count;
+    RingBuffer_Counter_t truncated_len;
+
+    /*  Get ring_buffer's current tail, and number of free items in ring buffer */
+    tail = RingBuffer_xLoadOwn(&ring_buffer->tail);
+    free_count = RingBuffer_xFreeCount(ring_buffer, RingBuffer_xProducerHead(ring_buffer, tail, len), tail);
+
+    /*  if ring buffer is full  */
+    if(free_count == 0)
+    {
+        return 0;
+    }
+
+    /*  maximum number of free items in the ring buffer  */
+    truncated_len = MIN(len, free_count);
+
+    /*  Get tail's location in ring_buffer's data  */
+    index = RingBuffer_xIndex(ring_buffer, tail);
+
+    /*
+     * maximum number of items that can added to queue after tail pointer
+     * either:
+     *  - between tail & head (tail < head), or
+     *  - between head & ring_buffer->size (tail > head)
+     * */
+    write_count = MIN(RingBuffer_xLinearCount(ring_buffer, index), truncated_len);
+
+    /*  copy items to ring buffer  */
+    RingBuffer_xCopyItems(&ring_buffer->data[index], items, write_count);
+
+    truncated_len -= write_count;
+
+    /*
+     * check if there are still more items to write
+     * in case (tail > head) && (head > 0)
+     * there are some free items @ start of the ring buffer
+     * */
+    if(truncated_len)
+    {
+        RingBuffer_xCopyItems(ring_buffer->data, &items[write_count], truncated_len);
+    }
+
+    /*  update ring_buffer's tail  */
+    RingBuffer_xStoreRelease(&ring_buffer->tail, RingBuffer_xWrap(ring_buffer, tail, (RingBuffer_Counter_t)(truncated_len + write_count)));
+
+    return (RingBuffer_Counter_t)(truncated_len + write_count);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t (RingBuffer_uGetItem)(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
+{
+    return RingBuffer_uGetItemInline(ring_buffer, item);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t RingBuffer_uGetItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len)
+{
+    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t index;
+    RingBuffer_Counter_t available_items;
+    RingBuffer_Counter_t truncated_len;
+    RingBuffer_Counter_t read_count;
+
+    /*  Get ring_buffer head, and number of available items in ring buffer  */
+    head = RingBuffer_xLoadOwn(&ring_buffer->head);
+    available_items = RingBuffer_xItemCount(ring_buffer, head, RingBuffer_xConsumerTail(ring_buffer, head, len));
+
+    if(available_items == 0)
+    {
+        return 0;
+    }
+
+    /*  maximum number of items available to read from ring buffer  */
+    truncated_len = MIN(len, available_items);
+
+    /*  Get head's location in ring_buffer's data  */
+    index = RingBuffer_xIndex(ring_buffer, head);
+
+    /*
+     * maximum number of items to read from ring buffer after head pointer
+     * either:
+     * - between head & tail (head < tail)
+     * - between head & ring_buffer->size (head > tail)
+     * */
+    read_count = MIN(RingBuffer_xLinearCount(ring_buffer, index), truncated_len);
+
+    /*  copy items from ring buffer  */
+    RingBuffer_xCopyItems(items, &ring_buffer->data[index], read_count);
+
+    truncated_len -= read_count;
+
+    /*
+     * check if there are more items to read
+     * (head > tail) && (tail >= 0)
+     * */
+    if(truncated_len)
+    {
+        RingBuffer_xCopyItems(&items[read_count], ring_buffer->data, truncated_len);
+    }
+
+    RingBuffer_xStoreRelease(&ring_buffer->head, RingBuffer_xWrap(ring_buffer, head, (RingBuffer_Counter_t)(truncated_len + read_count)));
+
+    return (RingBuffer_Counter_t)(truncated_len + read_count);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t RingBuffer_uPeekItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t offset)
+{
+    RingBuffer_Counter_t available;
+
+    return RingBuffer_xPeekItems(ring_buffer, items, len, offset, &available);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t RingBuffer_uSkipItems(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t skip_count)
+{
+    RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer->head);
+    RingBuffer_Counter_t item_count = RingBuffer_xItemCount(ring_buffer, head, RingBuffer_xConsumerTail(ring_buffer, head, skip_count));
+    RingBuffer_Counter_t skipped_items = MIN(item_count, skip_count);
+
+    if(skipped_items)
+    {
+        RingBuffer_xStoreRelease(&ring_buffer->head, RingBuffer_xWrap(ring_buffer, head, skipped_items));
+    }
+
+    return skipped_items;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t RingBuffer_uAdvance(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t advance_count)
+{
+    RingBuffer_Counter_t tail = RingBuffer_xLoadOwn(&ring_buffer->tail);
+    RingBuffer_Counter_t free_count = RingBuffer_xFreeCount(ring_buffer, RingBuffer_xProducerHead(ring_buffer, tail, advance_count), tail);
+    RingBuffer_Counter_t advanced_items = MIN(free_count, advance_count);
+
+    if(advanced_items)
+    {
+        RingBuffer_xStoreRelease(&ring_buffer->tail, RingBuffer_xWrap(ring_buffer, tail, advanced_items));
+    }
+
+    return advanced_items;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t (RingBuffer_uItemCount)(RingBuffer_t * const ring_buffer)
+{
+    return RingBuffer_uItemCountInline(ring_buffer);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Counter_t (RingBuffer_uFreeCount)(RingBuffer_t * const ring_buffer)
+{
+    return RingBuffer_uFreeCountInline(ring_buffer);
+}
+
+/* ------------------------------------------------------------------------- */
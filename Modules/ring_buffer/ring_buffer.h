@@ -9,6 +9,8 @@
  *              read/write (for atomic read/write)
  *              - Only 1 thread is writing to the ring_buffer
  *              - Only 1 thread is reading from the ring_buffer
+ *              - On multi-core processors, #RING_BUFFER_ATOMIC is enabled
+ *              (acquire/release ordering of ring buffer pointers)
  *
  *            The ring buffer implementation provides functions for single item,
  *            multiple items and block of items read/write.
@@ -48,6 +50,14 @@
 #define DEBUG_RING_BUFFER
 #endif /*  DEBUG  */
 
+#if defined(RING_BUFFER_ATOMIC) && RING_BUFFER_ATOMIC
+#ifdef __cplusplus
+#include <atomic>
+#else
+#include <stdatomic.h>
+#endif /* __cplusplus */
+#endif /*  RING_BUFFER_ATOMIC  */
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -94,6 +104,143 @@ extern "C" {
 #define RING_BUFFER_COUNTER_DATA_TYPE   uint32_t
 #endif /*  RING_BUFFER_COUNTER_DATA_TYPE  */
 
+/**
+ * @brief Power of two ring buffer size.
+ *
+ * When enabled, ring buffer size must be a power of two (RingBuffer_enInit() fails otherwise),
+ * and read/write pointers are wrapped using a mask (`size - 1`) instead of compare & reset.
+ * Removes the wrapping branches from put/get/skip/advance and item/free count functions.
+ *
+ * @note Disabled (0) by default, can be enabled during build: `-DRING_BUFFER_POWER_OF_TWO`
+ *
+ * */
+#ifndef RING_BUFFER_POWER_OF_TWO
+#define RING_BUFFER_POWER_OF_TWO        0
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+
+/**
+ * @brief Free running ring buffer read/write pointers.
+ *
+ * When enabled, ring buffer's head & tail are free running counters, they're only incremented
+ * and wrap around naturally when they overflow #RingBuffer_Counter_t. The location of an item in
+ * ring buffer data is `counter & (size - 1)`, and the number of items in the ring buffer is `tail - head`.
+ * So, the ring buffer can hold `size` items instead of `size - 1`.
+ *
+ * @note Requires a power of 2 ring buffer size, so it enables #RING_BUFFER_POWER_OF_TWO
+ *
+ * @note Disabled (0) by default, can be enabled during build: `-DRING_BUFFER_FREE_RUNNING`
+ *
+ * */
+#ifndef RING_BUFFER_FREE_RUNNING
+#define RING_BUFFER_FREE_RUNNING        0
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+
+#if RING_BUFFER_FREE_RUNNING && (RING_BUFFER_POWER_OF_TWO == 0)
+#undef RING_BUFFER_POWER_OF_TWO
+#define RING_BUFFER_POWER_OF_TWO        1
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+
+/**
+ * @brief Cache line size, used to separate producer & consumer ring buffer pointers.
+ *
+ * When set to a non zero value (cache line size in bytes, for example 64 for x86),
+ * ring buffer's consumer state (head) and producer state (tail) are placed on separate cache lines,
+ * so the producer and the consumer don't invalidate each other's cache line on every put/get (false sharing).
+ * The producer keeps a private cached copy of head, and the consumer keeps a private cached copy of tail.
+ * A cached copy is only refreshed when it says the ring buffer is full (producer) or empty (consumer).
+ *
+ * @note Disabled (0) by default, intended for multi-core processors with data caches.
+ *       Can be enabled during build: `-DRING_BUFFER_CACHE_LINE_SIZE=64`
+ *
+ * @note Ring buffer pointers must only be modified using ring buffer functions, as cached copies
+ *       are assumed to lag behind the real pointers.
+ *
+ * */
+#ifndef RING_BUFFER_CACHE_LINE_SIZE
+#define RING_BUFFER_CACHE_LINE_SIZE     0
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+
+#if RING_BUFFER_CACHE_LINE_SIZE
+
+#if defined(__cplusplus)
+#define RING_BUFFER_CACHE_ALIGNED       alignas(RING_BUFFER_CACHE_LINE_SIZE)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define RING_BUFFER_CACHE_ALIGNED       _Alignas(RING_BUFFER_CACHE_LINE_SIZE)
+#else
+#define RING_BUFFER_CACHE_ALIGNED       __attribute__((aligned(RING_BUFFER_CACHE_LINE_SIZE)))
+#endif /*  __cplusplus  */
+
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+
+/**
+ * @brief Atomic ring buffer read/write pointers.
+ *
+ * When enabled, ring buffer's head & tail are C11 `_Atomic` (`std::atomic` in C++) counters instead of `volatile` counters.
+ * Each side loads its own pointer with relaxed ordering, loads the other side's pointer with acquire ordering,
+ * and publishes its own pointer with release ordering. So, items copied into ring buffer data are visible to
+ * the consumer before the tail that covers them, and the producer can't overwrite items before the consumer
+ * is done reading them, on weakly ordered multi-core processors (ARM) and regardless of compiler reordering.
+ *
+ * @note Requires C11 `<stdatomic.h>` (or C++11 `<atomic>`), and a counter type that is lock free on the target.
+ *
+ * @note Disabled (0) by default, can be enabled during build: `-DRING_BUFFER_ATOMIC`
+ *
+ * */
+#ifndef RING_BUFFER_ATOMIC
+#define RING_BUFFER_ATOMIC              0
+#endif /*  RING_BUFFER_ATOMIC  */
+
+/**
+ * @brief Mirrored ring buffer data support.
+ *
+ * When enabled, a ring buffer can use mirrored data: ring buffer data mapped twice, back to back, in virtual memory
+ * (`./Modules/ring_buffer_mirror`, Linux only). Location `size + i` is location `i`, so any block of items in a mirrored
+ * ring buffer is contiguous: block read/write counts don't stop at the end of ring buffer data, and multiple items
+ * functions copy items using a single `memcpy`.
+ *
+ * @note Ring buffers initialized using RingBuffer_enInit() are not mirrored, and behave as usual.
+ *
+ * @note Disabled (0) by default, can be enabled during build: `-DRING_BUFFER_MIRROR`
+ *
+ * */
+#ifndef RING_BUFFER_MIRROR
+#define RING_BUFFER_MIRROR              0
+#endif /*  RING_BUFFER_MIRROR  */
+
+/**
+ * @brief Header-only fast path of the single item and count functions.
+ *
+ * When enabled, calls to RingBuffer_enPutItem(), RingBuffer_enGetItem(), RingBuffer_enItemCount(), RingBuffer_enFreeCount(),
+ * RingBuffer_enIsEmpty(), RingBuffer_enIsFull(), and of the unchecked RingBuffer_uPutItem(), RingBuffer_uGetItem(), RingBuffer_uItemCount()
+ * and RingBuffer_uFreeCount(), are calls to their `static inline` versions (`ring_buffer_inline.h`),
+ * so they're inlined into the caller's loops: no function call, and results written through pointers stay in registers.
+ * ring_buffer.c still provides the functions, for code built without it and for function pointers.
+ *
+ * @note Disabled (0) by default, can be enabled during build: `-DRING_BUFFER_INLINE`
+ *
+ * */
+#ifndef RING_BUFFER_INLINE
+#define RING_BUFFER_INLINE              0
+#endif /*  RING_BUFFER_INLINE  */
+
+/**
+ * @brief Largest copy (in bytes) done by the inline item copy kernel.
+ *
+ * Multiple items functions copy blocks of items using a kernel specialized for the item size (`sizeof(RingBuffer_Item_t)`):
+ * 16 bytes blocks the compiler moves using vector registers, then the remaining bytes by the widest word the
+ * item size allows (8, 4, 2 bytes, and single bytes only for odd item sizes). Copies larger than this size call `memcpy`.
+ *
+ * Inline copies save the `memcpy` call, most when the number of items is a constant (generated ring buffers,
+ * `./Modules/ring_buffer_define`). Library `memcpy` using wider vector registers (AVX) than the build
+ * is faster for larger copies, targets with a simpler `memcpy` (microcontrollers) can raise it.
+ *
+ * @note 32 bytes by default, can be set during build: `-DRING_BUFFER_COPY_INLINE_MAX=256`, `-DRING_BUFFER_COPY_INLINE_MAX=0` always calls `memcpy`
+ *
+ * */
+#ifndef RING_BUFFER_COPY_INLINE_MAX
+#define RING_BUFFER_COPY_INLINE_MAX     32
+#endif /*  RING_BUFFER_COPY_INLINE_MAX  */
+
 /* ------------------------------------------------------------------------- */
 /* --------------------------- Type Definitions ---------------------------- */
 /* ------------------------------------------------------------------------- */
@@ -108,16 +255,60 @@ typedef RING_BUFFER_ITEM_DATA_TYPE RingBuffer_Item_t;
  * */
 typedef RING_BUFFER_COUNTER_DATA_TYPE RingBuffer_Counter_t;
 
+/**
+ * @brief Ring buffer read/write pointer type, shared between the producer and the consumer
+ * */
+#if RING_BUFFER_ATOMIC && defined(__cplusplus)
+typedef std::atomic<RingBuffer_Counter_t> RingBuffer_SharedCounter_t;
+#elif RING_BUFFER_ATOMIC
+typedef _Atomic RingBuffer_Counter_t RingBuffer_SharedCounter_t;
+#else
+typedef volatile RingBuffer_Counter_t RingBuffer_SharedCounter_t;
+#endif /*  RING_BUFFER_ATOMIC  */
+
 /**
  * @brief Ring buffer structure
  */
 typedef struct RingBuffer_t {
     RingBuffer_Item_t * data;               /**<  pointer to ring buffer data  */
-    RingBuffer_Counter_t size;              /**<  size of ring buffer, maximum number of items ring buffer can hold is `size - 1`  */
-    volatile RingBuffer_Counter_t head;     /**<  ring buffer head pointer, used to read items from the buffer   */
-    volatile RingBuffer_Counter_t tail;     /**<  ring buffer tail pointer, used to write items to the buffer  */
+    RingBuffer_Counter_t size;              /**<  size of ring buffer, maximum number of items ring buffer can hold is `size - 1` (`size` when #RING_BUFFER_FREE_RUNNING is enabled)  */
+#if RING_BUFFER_MIRROR
+    uint8_t mirror;                         /**<  ring buffer data is mirrored (mapped twice, back to back), see #RING_BUFFER_MIRROR  */
+#endif /*  RING_BUFFER_MIRROR  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  consumer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+    RingBuffer_SharedCounter_t head;        /**<  ring buffer head pointer, used to read items from the buffer   */
+    RingBuffer_Counter_t tail_cache;        /**<  consumer's cached copy of tail  */
+    /*  producer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+    RingBuffer_SharedCounter_t tail;        /**<  ring buffer tail pointer, used to write items to the buffer  */
+    RingBuffer_Counter_t head_cache;        /**<  producer's cached copy of head  */
+#else
+    RingBuffer_SharedCounter_t head;        /**<  ring buffer head pointer, used to read items from the buffer   */
+    RingBuffer_SharedCounter_t tail;        /**<  ring buffer tail pointer, used to write items to the buffer  */
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
 } RingBuffer_t;
 
+/**
+ * @brief Ring buffer span, a contiguous block of items in ring buffer data
+ */
+typedef struct RingBuffer_Span_t {
+    RingBuffer_Item_t * data;               /**<  pointer to the first item of the span, in ring buffer data  */
+    RingBuffer_Counter_t count;             /**<  number of items in the span  */
+} RingBuffer_Span_t;
+
+/**
+ * @brief Ring buffer batch session, puts or gets many items and publishes ring buffer pointer once
+ */
+typedef struct RingBuffer_Batch_t {
+    RingBuffer_t * ring_buffer;             /**<  ring buffer of the batch  */
+    RingBuffer_Counter_t index;             /**<  private tail (put batch) or head (get batch), ahead of the published pointer  */
+    RingBuffer_Counter_t available;         /**<  free locations (put batch) or items (get batch) known to be available at index  */
+    RingBuffer_Counter_t pending;           /**<  number of items put or got since the pointer was published  */
+    RingBuffer_Counter_t publish_count;     /**<  number of pending items that publishes the pointer, 0 publishes only at the end  */
+} RingBuffer_Batch_t;
+
 /**
  * @brief Ring buffer error codes
  */
@@ -128,6 +319,7 @@ typedef enum RingBuffer_error_t {
     RING_BUFFER_ERROR_EMPTY,                /**<  Execution failed because ring buffer is empty  */
     RING_BUFFER_ERROR_FULL,                 /**<  Execution failed because ring buffer is full  */
     RING_BUFFER_ERROR_INSUFFICIENT_ITEMS,   /**<  Requested operation was done on some of the requested data, because ring buffer has insufficient items  */
+    RING_BUFFER_ERROR_SYSTEM,               /**<  Execution failed because of an operating system call error, `errno` holds the reason  */
 } RingBuffer_Error_t;
 
 /* ------------------------------------------------------------------------- */
@@ -141,7 +333,9 @@ typedef enum RingBuffer_error_t {
  * @param [in] data       : pointer to an array of bytes used for ring buffer's data storage
  * @param [in] size       : size of ring buffer data, must be > 1
  *
- * @note Ring buffer can hold at most `size - 1` items.
+ * @note Ring buffer can hold at most `size - 1` items, or `size` items when #RING_BUFFER_FREE_RUNNING is enabled.
+ *
+ * @note When #RING_BUFFER_POWER_OF_TWO is enabled, @p size must be a power of 2.
  *
  * @pre @p ring_buffer instance pointer is not null
  *
@@ -154,7 +348,7 @@ typedef enum RingBuffer_error_t {
  * @return RingBuffer_Error_t :
  *         - #RING_BUFFER_ERROR_NONE            : no error
  *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p data pointers is NULL
- *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1, or @p size is not a power of 2 (#RING_BUFFER_POWER_OF_TWO)
  *
  */
 
@@ -167,7 +361,7 @@ RingBuffer_Error_t RingBuffer_enInit(RingBuffer_t * ring_buffer, RingBuffer_Item
  *
  * @pre @p ring_buffer instance is initialized
  *
- * @post @p ring_buffer instance is reset (read, write pointers are reset to 0).
+ * @post @p ring_buffer instance is reset (read, write pointers are reset to 0), its data is kept (mirrored data too).
  *       the instance can still be used with ring buffer functions
  *
  * @return RingBuffer_Error_t
@@ -332,6 +526,9 @@ RingBuffer_Error_t RingBuffer_enBlockReadAddress(RingBuffer_t * const ring_buffe
  *
  * @post @p item_count contains number of items available to read as a contiguous block
  *
+ * @note A block in a mirrored ring buffer (#RING_BUFFER_MIRROR) doesn't stop at the end of ring buffer data,
+ *       so it's all items in the ring buffer
+ *
  * @return RingBuffer_Error_t
  *         - #RING_BUFFER_ERROR_NONE                : no error
  *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
@@ -368,6 +565,9 @@ RingBuffer_Error_t RingBuffer_enBlockWriteAddress(RingBuffer_t * ring_buffer, Ri
  *
  * @post @p item_count contains number of locations available to write as a contiguous block
  *
+ * @note A block in a mirrored ring buffer (#RING_BUFFER_MIRROR) doesn't stop at the end of ring buffer data,
+ *       so it's all free locations in the ring buffer
+ *
  * @return RingBuffer_Error_t
  *         - #RING_BUFFER_ERROR_NONE                : no error
  *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
@@ -522,7 +722,8 @@ RingBuffer_Error_t RingBuffer_enIsEmpty(RingBuffer_t * ring_buffer, uint8_t * is
  *
  * @pre @p ring_buffer instance is initialized
  *
- * @post @p is_full is #TRUE (1) if @p ring_buffer is full (contains `size - 1` items). Otherwise, @p is_full is #FALSE (0)
+ * @post @p is_full is #TRUE (1) if @p ring_buffer is full (contains `size - 1` items, or `size` items when #RING_BUFFER_FREE_RUNNING is enabled).
+ *       Otherwise, @p is_full is #FALSE (0)
  *
  * @return RingBuffer_Error_t
  *         - #RING_BUFFER_ERROR_NONE                : no error
@@ -531,6 +732,282 @@ RingBuffer_Error_t RingBuffer_enIsEmpty(RingBuffer_t * ring_buffer, uint8_t * is
  */
 RingBuffer_Error_t RingBuffer_enIsFull(RingBuffer_t * ring_buffer, uint8_t * is_full);
 
+
+/** @brief Reserve free locations in the ring buffer, to write items in place (zero copy write)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] len          : number of locations to reserve
+ * @param [out] first       : pointer to ring buffer span variable, to store the first reserved block (from ring buffer tail)
+ * @param [out] second      : pointer to ring buffer span variable, to store the second reserved block (from the start of ring buffer data),
+ *                            its count is 0 when reserved locations don't wrap around the end of ring buffer data
+ * @param [out] reserved    : pointer to ring buffer counter variable to store number of reserved locations (`first->count + second->count`)
+ *
+ * @note Reserved locations are written in place, then added to @p ring_buffer using RingBuffer_enCommit().
+ *       Reserving again before committing returns the same locations.
+ *
+ * @pre @p ring_buffer instance is initialized
+ *
+ * @post @p reserved contains number of locations that can be written, up to @p len
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer, @p first, @p second or @p reserved is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0
+ *         - #RING_BUFFER_ERROR_FULL                : @p ring_buffer is full
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the locations were reserved, as @p ring_buffer didn't have enough free space
+ *
+ */
+RingBuffer_Error_t RingBuffer_enReserve(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Span_t * const first, RingBuffer_Span_t * const second, RingBuffer_Counter_t * const reserved);
+
+
+/** @brief Commit items written in place into reserved locations, adds them to the ring buffer
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] count        : number of items to commit, the first @p count reserved locations (0 drops the reservation)
+ *
+ * @pre @p count locations were reserved using RingBuffer_enReserve()
+ *
+ * @post @p count items are added to @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p count is more than the free space in @p ring_buffer
+ *
+ */
+RingBuffer_Error_t RingBuffer_enCommit(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t count);
+
+
+/** @brief Acquire items in the ring buffer, to read them in place (zero copy read)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] len          : number of items to acquire
+ * @param [out] first       : pointer to ring buffer span variable, to store the first acquired block (from ring buffer head)
+ * @param [out] second      : pointer to ring buffer span variable, to store the second acquired block (from the start of ring buffer data),
+ *                            its count is 0 when acquired items don't wrap around the end of ring buffer data
+ * @param [out] acquired    : pointer to ring buffer counter variable to store number of acquired items (`first->count + second->count`)
+ *
+ * @note Acquired items are read in place, then removed from @p ring_buffer using RingBuffer_enRelease().
+ *       Acquiring again before releasing returns the same items.
+ *
+ * @pre @p ring_buffer instance is initialized
+ *
+ * @post @p acquired contains number of items that can be read, up to @p len
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer, @p first, @p second or @p acquired is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0
+ *         - #RING_BUFFER_ERROR_EMPTY               : @p ring_buffer is empty
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the items were acquired, as @p ring_buffer didn't have enough items
+ *
+ */
+RingBuffer_Error_t RingBuffer_enAcquire(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Span_t * const first, RingBuffer_Span_t * const second, RingBuffer_Counter_t * const acquired);
+
+
+/** @brief Release items read in place from acquired items, removes them from the ring buffer
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] count        : number of items to release, the first @p count acquired items (0 keeps all the items)
+ *
+ * @pre @p count items were acquired using RingBuffer_enAcquire()
+ *
+ * @post @p count items are removed from @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p count is more than the number of items in @p ring_buffer
+ *
+ */
+RingBuffer_Error_t RingBuffer_enRelease(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t count);
+
+
+/** @brief Begin a put batch: items put in the batch are published at once (producer)
+ *
+ * @param [in] ring_buffer      : pointer to ring buffer object
+ * @param [out] batch           : pointer to batch session object
+ * @param [in] publish_count    : number of items that publishes ring buffer tail during the batch, 0 publishes only at the end
+ *
+ * @note Ring buffer tail is published by RingBuffer_enPutBatchEnd(), after @p publish_count items, or when the
+ *       ring buffer is full, so the consumer doesn't see the batch items before that, and the cache line holding tail
+ *       is written once per batch instead of once per item.
+ *
+ * @note Other producer functions can't be used on @p ring_buffer until the batch ends.
+ *
+ * @pre @p ring_buffer instance is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p batch is NULL, or @p ring_buffer was not initialized
+ *
+ */
+RingBuffer_Error_t RingBuffer_enPutBatchBegin(RingBuffer_t * const ring_buffer, RingBuffer_Batch_t * const batch, RingBuffer_Counter_t publish_count);
+
+
+/** @brief Put an item in a put batch (producer)
+ *
+ * @param [in] batch        : pointer to batch session object
+ * @param [in] item         : pointer to item to put
+ *
+ * @pre @p batch was started using RingBuffer_enPutBatchBegin()
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p batch or @p item is NULL
+ *         - #RING_BUFFER_ERROR_FULL            : ring buffer is full, the item is not added (pending items are published)
+ *
+ */
+RingBuffer_Error_t RingBuffer_enPutBatchItem(RingBuffer_Batch_t * const batch, RingBuffer_Item_t const * const item);
+
+
+/** @brief End a put batch, publishing its pending items (producer)
+ *
+ * @param [in] batch        : pointer to batch session object
+ *
+ * @pre @p batch was started using RingBuffer_enPutBatchBegin()
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p batch is NULL
+ *
+ */
+RingBuffer_Error_t RingBuffer_enPutBatchEnd(RingBuffer_Batch_t * const batch);
+
+
+/** @brief Begin a get batch: items got in the batch are removed at once (consumer)
+ *
+ * @param [in] ring_buffer      : pointer to ring buffer object
+ * @param [out] batch           : pointer to batch session object
+ * @param [in] publish_count    : number of items that publishes ring buffer head during the batch, 0 publishes only at the end
+ *
+ * @note Ring buffer head is published by RingBuffer_enGetBatchEnd(), after @p publish_count items, or when the
+ *       ring buffer is empty, so the producer doesn't reuse locations of the batch items before that.
+ *
+ * @note Other consumer functions can't be used on @p ring_buffer until the batch ends.
+ *
+ * @pre @p ring_buffer instance is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p batch is NULL, or @p ring_buffer was not initialized
+ *
+ */
+RingBuffer_Error_t RingBuffer_enGetBatchBegin(RingBuffer_t * const ring_buffer, RingBuffer_Batch_t * const batch, RingBuffer_Counter_t publish_count);
+
+
+/** @brief Get an item in a get batch (consumer)
+ *
+ * @param [in] batch        : pointer to batch session object
+ * @param [out] item        : pointer to item to copy the oldest item into
+ *
+ * @pre @p batch was started using RingBuffer_enGetBatchBegin()
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p batch or @p item is NULL
+ *         - #RING_BUFFER_ERROR_EMPTY           : ring buffer is empty (pending items are removed)
+ *
+ */
+RingBuffer_Error_t RingBuffer_enGetBatchItem(RingBuffer_Batch_t * const batch, RingBuffer_Item_t * const item);
+
+
+/** @brief End a get batch, removing its pending items (consumer)
+ *
+ * @param [in] batch        : pointer to batch session object
+ *
+ * @pre @p batch was started using RingBuffer_enGetBatchBegin()
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p batch is NULL
+ *
+ */
+RingBuffer_Error_t RingBuffer_enGetBatchEnd(RingBuffer_Batch_t * const batch);
+
+/* ---------------------------------------------------------------------------
+ *
+ * Unchecked functions (RingBuffer_u*):
+ * - same behavior as the RingBuffer_en* function of the same name, without parameter checks
+ *   (even with #DEBUG_RING_BUFFER), for callers that already validated their parameters
+ * - return the number of items transferred by value, instead of an error code and a count written through a pointer,
+ *   so callers don't branch on error codes, and don't store and reload a count on every call
+ * - the ring buffer must be initialized, pointers must be valid, and item counts must not be 0
+ *
+ * ------------------------------------------------------------------------- */
+
+
+/** @brief Put an item into ring buffer, unchecked (see RingBuffer_enPutItem())
+ *
+ * @return number of items put: 1, or 0 when the ring buffer is full
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uPutItem(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const item);
+
+
+/** @brief Put up to @p len items into ring buffer, unchecked (see RingBuffer_enPutItems())
+ *
+ * @return number of items put, less than @p len when the ring buffer didn't have enough free locations, 0 when full
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uPutItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len);
+
+
+/** @brief Get an item from ring buffer, unchecked (see RingBuffer_enGetItem())
+ *
+ * @return number of items taken: 1, or 0 when the ring buffer is empty
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uGetItem(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item);
+
+
+/** @brief Get up to @p len items from ring buffer, unchecked (see RingBuffer_enGetItems())
+ *
+ * @return number of items taken, less than @p len when the ring buffer didn't have enough items, 0 when empty
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uGetItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len);
+
+
+/** @brief Read up to @p len items @p offset items after the oldest item, without removing them, unchecked (see RingBuffer_enPeekItems())
+ *
+ * @return number of items read, 0 when the ring buffer is empty or doesn't have more than @p offset items
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uPeekItems(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t offset);
+
+
+/** @brief Remove up to @p skip_count oldest items, unchecked (see RingBuffer_enSkipItems())
+ *
+ * @return number of items removed
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uSkipItems(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t skip_count);
+
+
+/** @brief Advance ring buffer's tail (write) pointer by up to @p advance_count, unchecked (see RingBuffer_enAdvance())
+ *
+ * @return number of locations added to the ring buffer
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uAdvance(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t advance_count);
+
+
+/** @brief Get number of items in the ring buffer, unchecked (see RingBuffer_enItemCount())
+ *
+ * @return number of items in the ring buffer
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uItemCount(RingBuffer_t * const ring_buffer);
+
+
+/** @brief Get number of free locations in the ring buffer, unchecked (see RingBuffer_enFreeCount())
+ *
+ * @return number of items that can be put into the ring buffer
+ *
+ */
+RingBuffer_Counter_t RingBuffer_uFreeCount(RingBuffer_t * const ring_buffer);
+
 #ifdef DEBUG
 
 /** @brief Get a human readable ring buffer error
@@ -556,4 +1033,8 @@ const char * RingBuffer_pcError(RingBuffer_Error_t error);
 }
 #endif /* __cplusplus */
 
+#if RING_BUFFER_INLINE
+#include "ring_buffer/ring_buffer_inline.h"
+#endif /*  RING_BUFFER_INLINE  */
+
 #endif /* __RING_BUFFER_H__ */
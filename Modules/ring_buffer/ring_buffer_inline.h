@@ -0,0 +1,690 @@
+/******************************************************************************
+ * @file      ring_buffer_inline.h
+ * @brief     Ring buffer index logic, and header-only fast path of the single item
+ *            and count functions.
+ *
+ * @details   Ring buffer pointer helpers (wrap, location, item/free counts, acquire/release
+ *            accesses and spans) and the item copy kernel are `static inline` functions shared by
+ *            ring_buffer.c and every inline function, so both always use the same index logic.
+ *
+ *            The fast path functions are the bodies of RingBuffer_enPutItem(), RingBuffer_enGetItem(),
+ *            RingBuffer_enItemCount(), RingBuffer_enFreeCount(), RingBuffer_enIsEmpty() and RingBuffer_enIsFull(),
+ *            and of the unchecked RingBuffer_uPutItem(), RingBuffer_uGetItem(), RingBuffer_uItemCount() and
+ *            RingBuffer_uFreeCount(), ring_buffer.c calls them to provide the functions. When #RING_BUFFER_INLINE is enabled,
+ *            calls to these functions are calls to the fast path, and are inlined into the caller:
+ *            no call, and results written through pointers to local variables stay in registers.
+ *
+ * @note      Included by ring_buffer.h when #RING_BUFFER_INLINE is enabled, it can also be included
+ *            directly to use `RingBuffer_en*Inline()` functions in some translation units only.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_INLINE_H__
+#define __RING_BUFFER_INLINE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RingBuffer
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* ----------------------------- Index Helpers ----------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Move ring buffer pointer @p index ahead by @p count locations, and wrap it around ring buffer size.
+ *
+ * When #RING_BUFFER_FREE_RUNNING is enabled, the pointer is only incremented (wraps around on overflow).
+ * When #RING_BUFFER_POWER_OF_TWO is enabled, the pointer is wrapped using a mask,
+ * otherwise, it's wrapped by subtracting ring buffer size.
+ *
+ * @pre @p count <= ring_buffer->size
+ *
+ * @return new pointer value
+ */
+static inline RingBuffer_Counter_t RingBuffer_xWrap(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t index, RingBuffer_Counter_t count)
+{
+#if RING_BUFFER_FREE_RUNNING
+
+    (void)ring_buffer;
+
+    return (RingBuffer_Counter_t)(index + count);
+
+#elif RING_BUFFER_POWER_OF_TWO
+
+    return (RingBuffer_Counter_t)((index + count) & (ring_buffer->size - 1));
+
+#else
+
+    if(count >= (RingBuffer_Counter_t)(ring_buffer->size - index))
+    {
+        return (RingBuffer_Counter_t)(index + count - ring_buffer->size);
+    }
+
+    return (RingBuffer_Counter_t)(index + count);
+
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get location of ring buffer pointer @p index in ring buffer data.
+ *
+ * @return @p index masked by `size - 1` when #RING_BUFFER_FREE_RUNNING is enabled, @p index otherwise.
+ */
+static inline RingBuffer_Counter_t RingBuffer_xIndex(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t index)
+{
+#if RING_BUFFER_FREE_RUNNING
+
+    return (RingBuffer_Counter_t)(index & (ring_buffer->size - 1));
+
+#else
+
+    (void)ring_buffer;
+
+    return index;
+
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get maximum number of items ring buffer can hold.
+ *
+ * @return `size` when #RING_BUFFER_FREE_RUNNING is enabled, `size - 1` otherwise.
+ */
+static inline RingBuffer_Counter_t RingBuffer_xCapacity(RingBuffer_t const * const ring_buffer)
+{
+#if RING_BUFFER_FREE_RUNNING
+
+    return ring_buffer->size;
+
+#else
+
+    return (RingBuffer_Counter_t)(ring_buffer->size - 1);
+
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get number of items in the ring buffer, for the given @p head & @p tail values.
+ */
+static inline RingBuffer_Counter_t RingBuffer_xItemCount(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t head, RingBuffer_Counter_t tail)
+{
+#if RING_BUFFER_FREE_RUNNING
+
+    (void)ring_buffer;
+
+    return (RingBuffer_Counter_t)(tail - head);
+
+#elif RING_BUFFER_POWER_OF_TWO
+
+    return (RingBuffer_Counter_t)((tail - head) & (ring_buffer->size - 1));
+
+#else
+
+    if(tail > head)
+    {
+        return tail - head;
+    }
+
+    if(tail < head)
+    {
+        return (RingBuffer_Counter_t)(tail + ring_buffer->size - head);
+    }
+
+    return 0;
+
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get number of free locations in the ring buffer, for the given @p head & @p tail values.
+ */
+static inline RingBuffer_Counter_t RingBuffer_xFreeCount(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t head, RingBuffer_Counter_t tail)
+{
+#if RING_BUFFER_FREE_RUNNING
+
+    return (RingBuffer_Counter_t)(ring_buffer->size - (RingBuffer_Counter_t)(tail - head));
+
+#elif RING_BUFFER_POWER_OF_TWO
+
+    return (RingBuffer_Counter_t)((head - tail - 1) & (ring_buffer->size - 1));
+
+#else
+
+    if(tail > head)
+    {
+        return (RingBuffer_Counter_t)(ring_buffer->size - (tail - head) - 1);
+    }
+
+    if(head > tail)
+    {
+        return (RingBuffer_Counter_t)((head - tail) - 1);
+    }
+
+    return (RingBuffer_Counter_t)(ring_buffer->size - 1);
+
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get number of contiguous locations in ring buffer data, starting at @p location.
+ *
+ * @return `size` for a mirrored ring buffer (#RING_BUFFER_MIRROR), as locations after the end of
+ *         ring buffer data map to its start, `size - location` otherwise.
+ */
+static inline RingBuffer_Counter_t RingBuffer_xLinearCount(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t location)
+{
+#if RING_BUFFER_MIRROR
+
+    if(ring_buffer->mirror)
+    {
+        return ring_buffer->size;
+    }
+
+#endif /*  RING_BUFFER_MIRROR  */
+
+    return (RingBuffer_Counter_t)(ring_buffer->size - location);
+}
+
+/* ---------------------------------------------------------------------------
+ *
+ * Ring buffer pointers ordering (when RING_BUFFER_ATOMIC is enabled):
+ * - The producer/consumer is the only writer of tail/head, so it loads its own pointer relaxed
+ * - The other side's pointer is loaded with acquire, so data accesses can't move before it:
+ *   the consumer doesn't read items before they're published, and the producer
+ *   doesn't overwrite items before they're consumed
+ * - Own pointer is stored with release, so data accesses can't move after it
+ *
+ * Without RING_BUFFER_ATOMIC, pointers are volatile and ordering is left to the target.
+ * In C++, pointers are `std::atomic` (see RingBuffer_SharedCounter_t), with the same ordering.
+ *
+ * ------------------------------------------------------------------------- */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Load ring buffer pointer owned by the caller (only written by the caller).
+ */
+static inline RingBuffer_Counter_t RingBuffer_xLoadOwn(RingBuffer_SharedCounter_t const * const counter)
+{
+#if RING_BUFFER_ATOMIC && defined(__cplusplus)
+
+    return counter->load(std::memory_order_relaxed);
+
+#elif RING_BUFFER_ATOMIC
+
+    return atomic_load_explicit(counter, memory_order_relaxed);
+
+#else
+
+    return (*counter);
+
+#endif /*  RING_BUFFER_ATOMIC  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Load ring buffer pointer owned by the other side, with acquire ordering.
+ */
+static inline RingBuffer_Counter_t RingBuffer_xLoadAcquire(RingBuffer_SharedCounter_t const * const counter)
+{
+#if RING_BUFFER_ATOMIC && defined(__cplusplus)
+
+    return counter->load(std::memory_order_acquire);
+
+#elif RING_BUFFER_ATOMIC
+
+    return atomic_load_explicit(counter, memory_order_acquire);
+
+#else
+
+    return (*counter);
+
+#endif /*  RING_BUFFER_ATOMIC  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Publish ring buffer pointer owned by the caller, with release ordering.
+ */
+static inline void RingBuffer_xStoreRelease(RingBuffer_SharedCounter_t * const counter, RingBuffer_Counter_t value)
+{
+#if RING_BUFFER_ATOMIC && defined(__cplusplus)
+
+    counter->store(value, std::memory_order_release);
+
+#elif RING_BUFFER_ATOMIC
+
+    atomic_store_explicit(counter, value, memory_order_release);
+
+#else
+
+    (*counter) = value;
+
+#endif /*  RING_BUFFER_ATOMIC  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get ring buffer head as seen by the producer, that has at least @p needed free locations if possible.
+ *
+ * When #RING_BUFFER_CACHE_LINE_SIZE is enabled, the producer uses its cached copy of head,
+ * and only reads the consumer's head (and refreshes the cached copy) when the cached copy
+ * doesn't have @p needed free locations. The cached copy can only lag behind the real head,
+ * so the free locations it gives are always available.
+ *
+ * @return head value, to be used to get number of free locations
+ */
+static inline RingBuffer_Counter_t RingBuffer_xProducerHead(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t tail, RingBuffer_Counter_t needed)
+{
+#if RING_BUFFER_CACHE_LINE_SIZE
+
+    RingBuffer_Counter_t head = ring_buffer->head_cache;
+
+    if(RingBuffer_xFreeCount(ring_buffer, head, tail) < needed)
+    {
+        head = RingBuffer_xLoadAcquire(&ring_buffer->head);
+        ring_buffer->head_cache = head;
+    }
+
+    return head;
+
+#else
+
+    (void)tail;
+    (void)needed;
+
+    return RingBuffer_xLoadAcquire(&ring_buffer->head);
+
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get ring buffer tail as seen by the consumer, that has at least @p needed items if possible.
+ *
+ * When #RING_BUFFER_CACHE_LINE_SIZE is enabled, the consumer uses its cached copy of tail,
+ * and only reads the producer's tail (and refreshes the cached copy) when the cached copy
+ * doesn't have @p needed items.
+ *
+ * @return tail value, to be used to get number of items
+ */
+static inline RingBuffer_Counter_t RingBuffer_xConsumerTail(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t head, RingBuffer_Counter_t needed)
+{
+#if RING_BUFFER_CACHE_LINE_SIZE
+
+    RingBuffer_Counter_t tail = ring_buffer->tail_cache;
+
+    if(RingBuffer_xItemCount(ring_buffer, head, tail) < needed)
+    {
+        tail = RingBuffer_xLoadAcquire(&ring_buffer->tail);
+        ring_buffer->tail_cache = tail;
+    }
+
+    return tail;
+
+#else
+
+    (void)head;
+    (void)needed;
+
+    return RingBuffer_xLoadAcquire(&ring_buffer->tail);
+
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Split @p count items starting at ring buffer pointer @p index into two spans:
+ *        up to the end of ring buffer data, then from its start.
+ */
+static inline void RingBuffer_xSpans(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t index, RingBuffer_Counter_t count,
+                                     RingBuffer_Span_t * const first, RingBuffer_Span_t * const second)
+{
+    RingBuffer_Counter_t location = RingBuffer_xIndex(ring_buffer, index);
+
+    first->data = &ring_buffer->data[location];
+    first->count = MIN(count, RingBuffer_xLinearCount(ring_buffer, location));
+
+    second->data = ring_buffer->data;
+    second->count = (RingBuffer_Counter_t)(count - first->count);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------ Copy Kernels ----------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Copy @p count items of @p item_size bytes from @p src to @p dst (blocks don't overlap),
+ *        @p count is at most @p max_count.
+ *
+ * @p item_size is a constant at every call, so the kernel is specialized for it at compile time:
+ *  - 16 bytes blocks (vector moves)
+ *  - remaining bytes by 8, 4 and 2 bytes words, then a single byte, each step is removed when the item size
+ *    makes it unreachable (16 bytes items: no words, 4 bytes items: no 2 bytes word nor single byte)
+ *
+ * Stores don't overlap, so items read back right after they're copied (consumer of a ring buffer in cache)
+ * are forwarded from the stores.
+ *
+ * Copies larger than #RING_BUFFER_COPY_INLINE_MAX bytes call `memcpy`. @p max_count is the capacity of the ring buffer
+ * when it's a constant (`SIZE_MAX` otherwise): when it fits the inline copy, the `memcpy` call is removed at compile time,
+ * instead of being checked by the compiler against a storage it can't overflow.
+ */
+static inline void RingBuffer_xCopy(void * const dst, void const * const src, size_t count, size_t item_size, size_t max_count)
+{
+    uint8_t * to = (uint8_t *)dst;
+    uint8_t const * from = (uint8_t const *)src;
+    size_t size = count * item_size;
+
+    if(size > RING_BUFFER_COPY_INLINE_MAX)
+    {
+        /*  removed when @p max_count items fit the inline copy, larger copies can't happen  */
+        if(max_count > (RING_BUFFER_COPY_INLINE_MAX / item_size))
+        {
+            memcpy(to, from, size);
+        }
+
+        return;
+    }
+
+    for(; size >= 16; size -= 16, to += 16, from += 16)
+    {
+        memcpy(to, from, 16);
+    }
+
+    if((item_size % 16) && (size >= 8))
+    {
+        memcpy(to, from, 8);
+        size -= 8;
+        to += 8;
+        from += 8;
+    }
+
+    if((item_size % 8) && (size >= 4))
+    {
+        memcpy(to, from, 4);
+        size -= 4;
+        to += 4;
+        from += 4;
+    }
+
+    if((item_size % 4) && (size >= 2))
+    {
+        memcpy(to, from, 2);
+        size -= 2;
+        to += 2;
+        from += 2;
+    }
+
+    if((item_size % 2) && size)
+    {
+        (*to) = (*from);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Copy @p count ring buffer items from @p src to @p dst, using the kernel specialized for `sizeof(RingBuffer_Item_t)`.
+ */
+static inline void RingBuffer_xCopyItems(RingBuffer_Item_t * const dst, RingBuffer_Item_t const * const src, RingBuffer_Counter_t count)
+{
+    RingBuffer_xCopy(dst, src, count, sizeof(RingBuffer_Item_t), SIZE_MAX);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ---------------------------- Inline Functions --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_uPutItem(), unchecked
+ */
+static inline RingBuffer_Counter_t RingBuffer_uPutItemInline(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const item)
+{
+    RingBuffer_Counter_t tail = RingBuffer_xLoadOwn(&ring_buffer->tail);
+    RingBuffer_Counter_t head = RingBuffer_xProducerHead(ring_buffer, tail, 1);
+
+    /*  check if ring_buffer is full  */
+    if(RingBuffer_xFreeCount(ring_buffer, head, tail) == 0)
+    {
+        return 0;
+    }
+
+    /*  put item into ring_buffer  */
+    memcpy(&ring_buffer->data[RingBuffer_xIndex(ring_buffer, tail)], item, sizeof(RingBuffer_Item_t));
+
+    /*  update ring_buffer tail pointer  */
+    RingBuffer_xStoreRelease(&ring_buffer->tail, RingBuffer_xWrap(ring_buffer, tail, 1));
+
+    return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_uGetItem(), unchecked
+ */
+static inline RingBuffer_Counter_t RingBuffer_uGetItemInline(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
+{
+    RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer->head);
+    RingBuffer_Counter_t tail = RingBuffer_xConsumerTail(ring_buffer, head, 1);
+
+    /*  check if ring_buffer is empty  */
+    if(head == tail)
+    {
+        return 0;
+    }
+
+    /*  get item from ring_buffer  */
+    memcpy(item, &ring_buffer->data[RingBuffer_xIndex(ring_buffer, head)], sizeof(RingBuffer_Item_t));
+
+    /*  update ring_buffer head pointer  */
+    RingBuffer_xStoreRelease(&ring_buffer->head, RingBuffer_xWrap(ring_buffer, head, 1));
+
+    return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_uItemCount(), unchecked
+ */
+static inline RingBuffer_Counter_t RingBuffer_uItemCountInline(RingBuffer_t * const ring_buffer)
+{
+    RingBuffer_Counter_t tail = RingBuffer_xLoadAcquire(&ring_buffer->tail);
+    RingBuffer_Counter_t head = RingBuffer_xLoadAcquire(&ring_buffer->head);
+
+    return RingBuffer_xItemCount(ring_buffer, head, tail);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_uFreeCount(), unchecked
+ */
+static inline RingBuffer_Counter_t RingBuffer_uFreeCountInline(RingBuffer_t * const ring_buffer)
+{
+    RingBuffer_Counter_t tail = RingBuffer_xLoadAcquire(&ring_buffer->tail);
+    RingBuffer_Counter_t head = RingBuffer_xLoadAcquire(&ring_buffer->head);
+
+    return RingBuffer_xFreeCount(ring_buffer, head, tail);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_enPutItem(), same parameters and errors
+ */
+static inline RingBuffer_Error_t RingBuffer_enPutItemInline(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    return RingBuffer_uPutItemInline(ring_buffer, item) ? RING_BUFFER_ERROR_NONE : RING_BUFFER_ERROR_FULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_enGetItem(), same parameters and errors
+ */
+static inline RingBuffer_Error_t RingBuffer_enGetItemInline(RingBuffer_t * const ring_buffer, RingBuffer_Item_t * const item)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    return RingBuffer_uGetItemInline(ring_buffer, item) ? RING_BUFFER_ERROR_NONE : RING_BUFFER_ERROR_EMPTY;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_enItemCount(), same parameters and errors
+ */
+static inline RingBuffer_Error_t RingBuffer_enItemCountInline(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * item_count)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*item_count) = RingBuffer_uItemCountInline(ring_buffer);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_enFreeCount(), same parameters and errors
+ */
+static inline RingBuffer_Error_t RingBuffer_enFreeCountInline(RingBuffer_t * ring_buffer, RingBuffer_Counter_t * free_count)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(free_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*free_count) = RingBuffer_uFreeCountInline(ring_buffer);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_enIsEmpty(), same parameters and errors
+ */
+static inline RingBuffer_Error_t RingBuffer_enIsEmptyInline(RingBuffer_t * ring_buffer, uint8_t * is_empty)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(is_empty))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*is_empty) = (RingBuffer_xLoadAcquire(&ring_buffer->head) == RingBuffer_xLoadAcquire(&ring_buffer->tail));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Inline RingBuffer_enIsFull(), same parameters and errors
+ */
+static inline RingBuffer_Error_t RingBuffer_enIsFullInline(RingBuffer_t * ring_buffer, uint8_t * is_full)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(is_full))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*is_full) = (RingBuffer_uItemCountInline(ring_buffer) == RingBuffer_xCapacity(ring_buffer));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#if RING_BUFFER_INLINE
+
+/*  calls are inlined, ring_buffer.c functions are still available as `(RingBuffer_enPutItem)(...)` and through function pointers  */
+#define RingBuffer_enPutItem(ring_buffer, item)             RingBuffer_enPutItemInline((ring_buffer), (item))
+#define RingBuffer_enGetItem(ring_buffer, item)             RingBuffer_enGetItemInline((ring_buffer), (item))
+#define RingBuffer_enItemCount(ring_buffer, item_count)     RingBuffer_enItemCountInline((ring_buffer), (item_count))
+#define RingBuffer_enFreeCount(ring_buffer, free_count)     RingBuffer_enFreeCountInline((ring_buffer), (free_count))
+#define RingBuffer_enIsEmpty(ring_buffer, is_empty)         RingBuffer_enIsEmptyInline((ring_buffer), (is_empty))
+#define RingBuffer_enIsFull(ring_buffer, is_full)           RingBuffer_enIsFullInline((ring_buffer), (is_full))
+#define RingBuffer_uPutItem(ring_buffer, item)              RingBuffer_uPutItemInline((ring_buffer), (item))
+#define RingBuffer_uGetItem(ring_buffer, item)              RingBuffer_uGetItemInline((ring_buffer), (item))
+#define RingBuffer_uItemCount(ring_buffer)                  RingBuffer_uItemCountInline((ring_buffer))
+#define RingBuffer_uFreeCount(ring_buffer)                  RingBuffer_uFreeCountInline((ring_buffer))
+
+#endif /*  RING_BUFFER_INLINE  */
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_INLINE_H__ */
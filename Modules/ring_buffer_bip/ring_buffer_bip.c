@@ -0,0 +1,260 @@
+/******************************************************************************
+ * @file      ring_buffer_bip.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
+#include "ring_buffer_bip/ring_buffer_bip.h"
+
+/* ---------------------------------------------------------------------------
+ *
+ * Bip buffer pointers (locations in [0, size]):
+ * - read <= write  : items are in [read, write), free locations are [write, size) and [0, read)
+ * - write < read   : the producer wrapped to the start of data (inverted),
+ *                    items are in [read, watermark) then [0, write), free locations are [write, read)
+ * - read == write  : bip buffer is empty, so write never reaches read from behind
+ *
+ * When the producer wraps, it stores the watermark before publishing write, and it can't
+ * wrap again before the consumer wraps, so the consumer's watermark is always valid.
+ *
+ * Pointers ordering is the same as ring buffer pointers (ring_buffer_inline.h): own pointers are loaded
+ * relaxed, the other side's pointer is loaded with acquire, and own pointers are stored with release.
+ *
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get the end of the contiguous block of items at @p read (consumer)
+ */
+static inline RingBuffer_Counter_t RingBufferBip_xReadEnd(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t read, RingBuffer_Counter_t write)
+{
+    if(read <= write)
+    {
+        return write;
+    }
+
+    /*  inverted, the watermark was stored before write was published  */
+    return RingBuffer_xLoadOwn(&ring_buffer->watermark);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBip_enInit(RingBufferBip_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(size < 2)
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    ring_buffer->data = (RingBuffer_Item_t * const)data;
+    ring_buffer->size = size;
+    ring_buffer->reserve_start = 0;
+    ring_buffer->reserve_count = 0;
+    RingBuffer_xStoreRelease(&ring_buffer->watermark, size);
+    RingBuffer_xStoreRelease(&ring_buffer->read, 0);
+    RingBuffer_xStoreRelease(&ring_buffer->write, 0);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBip_enReserve(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Item_t ** const address)
+{
+    RingBuffer_Counter_t write;
+    RingBuffer_Counter_t read;
+    RingBuffer_Counter_t start;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(address))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    write = RingBuffer_xLoadOwn(&ring_buffer->write);
+    read = RingBuffer_xLoadAcquire(&ring_buffer->read);
+
+    if(write < read)
+    {
+        /*  inverted, write must stay behind read  */
+        if(len >= (RingBuffer_Counter_t)(read - write))
+        {
+            ring_buffer->reserve_count = 0;
+            return RING_BUFFER_ERROR_FULL;
+        }
+
+        start = write;
+    }
+    else if(len <= (RingBuffer_Counter_t)(ring_buffer->size - write))
+    {
+        start = write;
+    }
+    else if(len < read)
+    {
+        /*  doesn't fit before the end, wrap to the start of data  */
+        start = 0;
+    }
+    else
+    {
+        ring_buffer->reserve_count = 0;
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    ring_buffer->reserve_start = start;
+    ring_buffer->reserve_count = len;
+    (*address) = &ring_buffer->data[start];
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBip_enCommit(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t count)
+{
+    RingBuffer_Counter_t write;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(count > ring_buffer->reserve_count)
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    ring_buffer->reserve_count = 0;
+
+    if(IS_ZERO(count))
+    {
+        return RING_BUFFER_ERROR_NONE;
+    }
+
+    write = RingBuffer_xLoadOwn(&ring_buffer->write);
+
+    if(ring_buffer->reserve_start != write)
+    {
+        /*  wrapped, the first region ends at the current write pointer  */
+        RingBuffer_xStoreRelease(&ring_buffer->watermark, write);
+        write = 0;
+    }
+
+    RingBuffer_xStoreRelease(&ring_buffer->write, (RingBuffer_Counter_t)(write + count));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBip_enRead(RingBufferBip_t * const ring_buffer, RingBuffer_Item_t ** const address, RingBuffer_Counter_t * const count)
+{
+    RingBuffer_Counter_t read;
+    RingBuffer_Counter_t write;
+    RingBuffer_Counter_t end;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(address) || IS_NULLPTR(count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    read = RingBuffer_xLoadOwn(&ring_buffer->read);
+    write = RingBuffer_xLoadAcquire(&ring_buffer->write);
+    end = RingBufferBip_xReadEnd(ring_buffer, read, write);
+
+    if((read > write) && (read == end))
+    {
+        /*  first region is read, continue with the second region  */
+        read = 0;
+        end = write;
+        RingBuffer_xStoreRelease(&ring_buffer->read, 0);
+    }
+
+    (*address) = &ring_buffer->data[read];
+    (*count) = (RingBuffer_Counter_t)(end - read);
+
+    if(IS_ZERO(*count))
+    {
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBip_enRelease(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t count)
+{
+    RingBuffer_Counter_t read;
+    RingBuffer_Counter_t write;
+    RingBuffer_Counter_t end;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    read = RingBuffer_xLoadOwn(&ring_buffer->read);
+    write = RingBuffer_xLoadAcquire(&ring_buffer->write);
+    end = RingBufferBip_xReadEnd(ring_buffer, read, write);
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(count > (RingBuffer_Counter_t)(end - read))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    read = (RingBuffer_Counter_t)(read + count);
+
+    if((read == end) && (end != write))
+    {
+        /*  end of the first region, free it to the producer right away  */
+        read = 0;
+    }
+
+    RingBuffer_xStoreRelease(&ring_buffer->read, read);
+
+    return RING_BUFFER_ERROR_NONE;
+}
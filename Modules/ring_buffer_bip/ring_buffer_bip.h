@@ -0,0 +1,175 @@
+/******************************************************************************
+ * @file      ring_buffer_bip.h
+ * @brief     A Lock free, SPSC (Single Producer Single Consumer),
+ *            bipartite (bip) buffer of contiguous blocks.
+ *
+ * @details   Bip buffer is a ring buffer where the producer reserves contiguous blocks,
+ *            a reservation of `n` items either succeeds as one linear block, or fails:
+ *              - When a block doesn't fit before the end of ring buffer data, it's
+ *              reserved at the start of ring buffer data (second region), and the
+ *              end of the first region is marked by a watermark
+ *              - The consumer reads the first region up to the watermark, then the
+ *              second region, so blocks are read in order
+ *
+ *            Blocks are written in place (DMA, serializers...) without split copies,
+ *            and the consumer reads contiguous blocks in place.
+ *
+ *            Uses ring buffer item & counter types (#RING_BUFFER_ITEM_DATA_TYPE,
+ *            #RING_BUFFER_COUNTER_DATA_TYPE), pointers ordering (#RING_BUFFER_ATOMIC)
+ *            and cache line layout (#RING_BUFFER_CACHE_LINE_SIZE). Size doesn't need to be a power of 2.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_BIP_H__
+#define __RING_BUFFER_BIP_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferBip Lock free SPSC (Single Producer, Single Consumer) bip buffer
+ * @brief Lock free SPSC (Single Producer, Single Consumer) bipartite buffer
+ * @details   Contiguous reservations, read in order using a watermark at the end of the first region.
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Bip buffer structure
+ */
+typedef struct RingBufferBip_t {
+    RingBuffer_Item_t * data;               /**<  pointer to bip buffer data  */
+    RingBuffer_Counter_t size;              /**<  size of bip buffer data  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  consumer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t read;        /**<  read pointer, location of the oldest item  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  producer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t write;       /**<  write pointer, location where the next block is written  */
+    RingBuffer_SharedCounter_t watermark;   /**<  end of the first region, valid when write pointer is behind read pointer  */
+    RingBuffer_Counter_t reserve_start;     /**<  producer's reserved block location  */
+    RingBuffer_Counter_t reserve_count;     /**<  producer's reserved block size, 0 when there's no reservation  */
+} RingBufferBip_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize bip buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to bip buffer object
+ * @param [in] data         : pointer to an array of items used for bip buffer's data storage
+ * @param [in] size         : size of bip buffer data, must be > 1
+ *
+ * @pre @p ring_buffer and @p data are not null
+ *
+ * @post @p ring_buffer instance is initialized, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p data is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1
+ *
+ */
+RingBuffer_Error_t RingBufferBip_enInit(RingBufferBip_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size);
+
+
+/** @brief Reserve a contiguous block of @p len free locations (producer)
+ *
+ * @param [in] ring_buffer  : pointer to bip buffer object
+ * @param [in] len          : number of locations to reserve
+ * @param [out] address     : pointer to pointer to RingBuffer_Item_t to store address of the reserved block
+ *
+ * @note The block is written in place, then added to @p ring_buffer using RingBufferBip_enCommit().
+ *       Reserving again before committing drops the previous reservation.
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error, @p len contiguous locations are reserved
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p address is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0
+ *         - #RING_BUFFER_ERROR_FULL            : @p ring_buffer doesn't have @p len contiguous free locations, nothing is reserved
+ *
+ */
+RingBuffer_Error_t RingBufferBip_enReserve(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Item_t ** const address);
+
+
+/** @brief Commit the first @p count items of the reserved block (producer)
+ *
+ * @param [in] ring_buffer  : pointer to bip buffer object
+ * @param [in] count        : number of items written in the reserved block (0 drops the reservation)
+ *
+ * @pre a block of at least @p count locations was reserved using RingBufferBip_enReserve()
+ *
+ * @post @p count items are added to @p ring_buffer, and the reservation is done
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p count is more than the reserved block size
+ *
+ */
+RingBuffer_Error_t RingBufferBip_enCommit(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t count);
+
+
+/** @brief Get the oldest contiguous block of items (consumer, zero copy read)
+ *
+ * @param [in] ring_buffer  : pointer to bip buffer object
+ * @param [out] address     : pointer to pointer to RingBuffer_Item_t to store address of the block
+ * @param [out] count       : pointer to RingBuffer_Counter_t to store number of items in the block
+ *
+ * @note Items of the first region (up to the watermark) are read before items of the second region,
+ *       then items are removed from @p ring_buffer using RingBufferBip_enRelease()
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p address or @p count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferBip_enRead(RingBufferBip_t * const ring_buffer, RingBuffer_Item_t ** const address, RingBuffer_Counter_t * const count);
+
+
+/** @brief Release the first @p count items of the block returned by RingBufferBip_enRead() (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to bip buffer object
+ * @param [in] count        : number of items to remove
+ *
+ * @pre @p count items were read using RingBufferBip_enRead()
+ *
+ * @post @p count items are removed from @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p count is more than the number of items in the block
+ *
+ */
+RingBuffer_Error_t RingBufferBip_enRelease(RingBufferBip_t * const ring_buffer, RingBuffer_Counter_t count);
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_BIP_H__ */
@@ -0,0 +1,564 @@
+/******************************************************************************
+ * @file      ring_buffer_broadcast.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_broadcast/ring_buffer_broadcast.h"
+
+#if RING_BUFFER_BROADCAST
+
+/* ---------------------------------------------------------------------------
+ *
+ * Broadcast ring buffer counters (all free running):
+ * - tail       : number of items put by the producer
+ * - head (i)   : number of items read by consumer i, head (i) <= tail <= head (i) + size
+ * - limit      : producer's write limit, min (head (i)) + size over joined consumers,
+ *                cached by the producer and only refreshed when it doesn't leave enough free space
+ *
+ * Cursor states:
+ * - FREE       : cursor is not used, producer ignores it
+ * - JOINING    : cursor is claimed by a joining consumer, producer ignores it
+ * - JOINED     : producer is bounded by cursor's head
+ *
+ * Join:
+ * 1 - claim a FREE cursor (compare & swap FREE -> JOINING), set its head to tail
+ * 2 - store JOINED, full fence, then set head to tail again
+ *
+ * The producer refreshes its limit with a full fence before loading cursor states, so either
+ * the producer sees the cursor JOINED (and is bounded by its head), or the consumer's second
+ * tail load sees the tail the producer computed its limit from: in both cases limit <= head + size,
+ * and the producer never overwrites items the consumer didn't read.
+ *
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Broadcast ring buffer cursor states
+ */
+#define RING_BUFFER_BROADCAST_CURSOR_FREE       ((RingBuffer_Counter_t)0)
+#define RING_BUFFER_BROADCAST_CURSOR_JOINING    ((RingBuffer_Counter_t)1)
+#define RING_BUFFER_BROADCAST_CURSOR_JOINED     ((RingBuffer_Counter_t)2)
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get producer's write limit, leaving at least @p needed free locations after @p tail when possible.
+ *
+ * @details Cursors are scanned only when the cached limit doesn't leave @p needed free locations,
+ *          free locations are bounded by the slowest joined consumer (or ring buffer size when no consumer is joined).
+ */
+static inline RingBuffer_Counter_t RingBufferBroadcast_xProducerLimit(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Counter_t tail, RingBuffer_Counter_t needed)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t used;
+
+    if((RingBuffer_Counter_t)(ring_buffer->limit - tail) >= needed)
+    {
+        return ring_buffer->limit;
+    }
+
+    /*  pairs with the joining consumer's fence, see Join above  */
+    atomic_thread_fence(memory_order_seq_cst);
+
+    free_count = ring_buffer->size;
+
+    for(RingBuffer_Counter_t i = 0; i < ring_buffer->cursor_count; i++)
+    {
+        cursor = &ring_buffer->cursors[i];
+
+        /*  acquire: consumer is done reading locations before its head (or before it left)  */
+        if(atomic_load_explicit(&cursor->state, memory_order_acquire) == RING_BUFFER_BROADCAST_CURSOR_JOINED)
+        {
+            used = (RingBuffer_Counter_t)(tail - atomic_load_explicit(&cursor->head, memory_order_acquire));
+
+            /*  a joining consumer's first head can lag behind by more than size, until its head is set again  */
+            free_count = (used < ring_buffer->size) ? MIN(free_count, (RingBuffer_Counter_t)(ring_buffer->size - used)) : 0;
+        }
+    }
+
+    ring_buffer->limit = (RingBuffer_Counter_t)(tail + free_count);
+
+    return ring_buffer->limit;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get joined consumer's cursor, NULL if @p consumer is not a joined consumer
+ */
+static inline RingBufferBroadcast_Cursor_t * RingBufferBroadcast_xCursor(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer)
+{
+    if((consumer >= ring_buffer->cursor_count) ||
+       (atomic_load_explicit(&ring_buffer->cursors[consumer].state, memory_order_relaxed) != RING_BUFFER_BROADCAST_CURSOR_JOINED))
+    {
+        return NULL;
+    }
+
+    return &ring_buffer->cursors[consumer];
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enInit(RingBufferBroadcast_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size,
+                                              RingBufferBroadcast_Cursor_t * const cursors, RingBuffer_Counter_t cursor_count)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(data) || IS_NULLPTR(cursors))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if((size < 2) || (size & (size - 1)) || IS_ZERO(cursor_count))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    for(RingBuffer_Counter_t i = 0; i < cursor_count; i++)
+    {
+        atomic_store_explicit(&cursors[i].head, 0, memory_order_relaxed);
+        atomic_store_explicit(&cursors[i].state, RING_BUFFER_BROADCAST_CURSOR_FREE, memory_order_relaxed);
+    }
+
+    ring_buffer->data = (RingBuffer_Item_t *)data;
+    ring_buffer->size = size;
+    ring_buffer->cursors = cursors;
+    ring_buffer->cursor_count = cursor_count;
+    ring_buffer->limit = size;
+    atomic_store_explicit(&ring_buffer->tail, 0, memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enJoin(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t * const consumer)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+    RingBuffer_Counter_t state;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(consumer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    for(RingBuffer_Counter_t i = 0; i < ring_buffer->cursor_count; i++)
+    {
+        cursor = &ring_buffer->cursors[i];
+        state = RING_BUFFER_BROADCAST_CURSOR_FREE;
+
+        if(!atomic_compare_exchange_strong_explicit(&cursor->state, &state, RING_BUFFER_BROADCAST_CURSOR_JOINING, memory_order_acquire, memory_order_relaxed))
+        {
+            continue;
+        }
+
+        /*  first head, bounds the producer as soon as it sees the cursor joined  */
+        atomic_store_explicit(&cursor->head, atomic_load_explicit(&ring_buffer->tail, memory_order_relaxed), memory_order_relaxed);
+
+        /*  release: producer seeing the cursor joined sees its first head  */
+        atomic_store_explicit(&cursor->state, RING_BUFFER_BROADCAST_CURSOR_JOINED, memory_order_release);
+
+        /*  pairs with the producer's fence, tail loaded after the fence is not behind the producer's limit - size  */
+        atomic_thread_fence(memory_order_seq_cst);
+
+        atomic_store_explicit(&cursor->head, atomic_load_explicit(&ring_buffer->tail, memory_order_acquire), memory_order_release);
+
+        (*consumer) = i;
+
+        return RING_BUFFER_ERROR_NONE;
+    }
+
+    return RING_BUFFER_ERROR_FULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enLeave(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    cursor = RingBufferBroadcast_xCursor(ring_buffer, consumer);
+
+    if(IS_NULLPTR(cursor))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    /*  release: consumer is done reading items before the producer can overwrite them  */
+    atomic_store_explicit(&cursor->state, RING_BUFFER_BROADCAST_CURSOR_FREE, memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enPutItem(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Item_t const * const item)
+{
+    RingBuffer_Counter_t tail;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    tail = atomic_load_explicit(&ring_buffer->tail, memory_order_relaxed);
+
+    if(RingBufferBroadcast_xProducerLimit(ring_buffer, tail, 1) == tail)
+    {
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    ring_buffer->data[tail & (ring_buffer->size - 1)] = (*item);
+
+    /*  release: consumers reading tail see the item  */
+    atomic_store_explicit(&ring_buffer->tail, (RingBuffer_Counter_t)(tail + 1), memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enPutItems(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t write_count;
+    RingBuffer_Counter_t items_to_write;
+    RingBuffer_Counter_t index;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    tail = atomic_load_explicit(&ring_buffer->tail, memory_order_relaxed);
+    free_count = (RingBuffer_Counter_t)(RingBufferBroadcast_xProducerLimit(ring_buffer, tail, MIN(len, ring_buffer->size)) - tail);
+
+    if(free_count == 0)
+    {
+        (*item_count) = 0;
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    items_to_write = MIN(free_count, len);
+
+    /*  copy items up to the end of ring buffer data, then from its start  */
+    index = (RingBuffer_Counter_t)(tail & (ring_buffer->size - 1));
+    write_count = MIN(items_to_write, (RingBuffer_Counter_t)(ring_buffer->size - index));
+
+    memcpy(&ring_buffer->data[index], items, write_count * sizeof(RingBuffer_Item_t));
+
+    if(items_to_write > write_count)
+    {
+        memcpy(ring_buffer->data, &items[write_count], (items_to_write - write_count) * sizeof(RingBuffer_Item_t));
+    }
+
+    /*  release: consumers reading tail see the items  */
+    atomic_store_explicit(&ring_buffer->tail, (RingBuffer_Counter_t)(tail + items_to_write), memory_order_release);
+
+    (*item_count) = items_to_write;
+
+    if(items_to_write != len)
+    {
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enFreeCount(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Counter_t * const free_count)
+{
+    RingBuffer_Counter_t tail;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(free_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    tail = atomic_load_explicit(&ring_buffer->tail, memory_order_relaxed);
+
+    /*  cursors are always scanned, unless the cached limit already leaves the whole ring buffer free  */
+    (*free_count) = (RingBuffer_Counter_t)(RingBufferBroadcast_xProducerLimit(ring_buffer, tail, ring_buffer->size) - tail);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enGetItems(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer,
+                                                  RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enPeekItems(ring_buffer, consumer, items, len, 0, item_count);
+
+    if((error == RING_BUFFER_ERROR_NONE) || (error == RING_BUFFER_ERROR_INSUFFICIENT_ITEMS))
+    {
+        RingBufferBroadcast_Cursor_t * cursor = &ring_buffer->cursors[consumer];
+
+        /*  release: items are read before the producer can overwrite them  */
+        atomic_store_explicit(&cursor->head, (RingBuffer_Counter_t)(atomic_load_explicit(&cursor->head, memory_order_relaxed) + (*item_count)), memory_order_release);
+    }
+
+    return error;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enPeekItems(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer,
+                                                   RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t offset, RingBuffer_Counter_t * const item_count)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t available_items;
+    RingBuffer_Counter_t items_to_peek;
+    RingBuffer_Counter_t read_count;
+    RingBuffer_Counter_t index;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    cursor = RingBufferBroadcast_xCursor(ring_buffer, consumer);
+
+    if(IS_NULLPTR(cursor))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    /*  acquire: items put before tail are visible  */
+    head = atomic_load_explicit(&cursor->head, memory_order_relaxed);
+    available_items = (RingBuffer_Counter_t)(atomic_load_explicit(&ring_buffer->tail, memory_order_acquire) - head);
+
+    if(available_items == 0)
+    {
+        (*item_count) = 0;
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    if(offset >= available_items)
+    {
+        (*item_count) = 0;
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    items_to_peek = MIN((RingBuffer_Counter_t)(available_items - offset), len);
+
+    /*  copy items up to the end of ring buffer data, then from its start  */
+    index = (RingBuffer_Counter_t)((RingBuffer_Counter_t)(head + offset) & (ring_buffer->size - 1));
+    read_count = MIN(items_to_peek, (RingBuffer_Counter_t)(ring_buffer->size - index));
+
+    memcpy(items, &ring_buffer->data[index], read_count * sizeof(RingBuffer_Item_t));
+
+    if(items_to_peek > read_count)
+    {
+        memcpy(&items[read_count], ring_buffer->data, (items_to_peek - read_count) * sizeof(RingBuffer_Item_t));
+    }
+
+    (*item_count) = items_to_peek;
+
+    if(items_to_peek != len)
+    {
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enSkipItems(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer,
+                                                   RingBuffer_Counter_t skip_count, RingBuffer_Counter_t * const skipped)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t available_items;
+    RingBuffer_Counter_t skipped_items;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(skipped))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(skip_count))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    cursor = RingBufferBroadcast_xCursor(ring_buffer, consumer);
+
+    if(IS_NULLPTR(cursor))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    head = atomic_load_explicit(&cursor->head, memory_order_relaxed);
+    available_items = (RingBuffer_Counter_t)(atomic_load_explicit(&ring_buffer->tail, memory_order_acquire) - head);
+
+    if(available_items == 0)
+    {
+        (*skipped) = 0;
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    skipped_items = MIN(available_items, skip_count);
+
+    /*  release: skipped items (read in place) are read before the producer can overwrite them  */
+    atomic_store_explicit(&cursor->head, (RingBuffer_Counter_t)(head + skipped_items), memory_order_release);
+    (*skipped) = skipped_items;
+
+    if(skipped_items != skip_count)
+    {
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enItemCount(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer, RingBuffer_Counter_t * const item_count)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    cursor = RingBufferBroadcast_xCursor(ring_buffer, consumer);
+
+    if(IS_NULLPTR(cursor))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    (*item_count) = (RingBuffer_Counter_t)(atomic_load_explicit(&ring_buffer->tail, memory_order_acquire) - atomic_load_explicit(&cursor->head, memory_order_relaxed));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enBlockReadAddress(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer, RingBuffer_Item_t ** const read_address)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(read_address))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    cursor = RingBufferBroadcast_xCursor(ring_buffer, consumer);
+
+    if(IS_NULLPTR(cursor))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    (*read_address) = &ring_buffer->data[atomic_load_explicit(&cursor->head, memory_order_relaxed) & (ring_buffer->size - 1)];
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferBroadcast_enBlockReadCount(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer, RingBuffer_Counter_t * const item_count)
+{
+    RingBufferBroadcast_Cursor_t * cursor;
+    RingBuffer_Counter_t head;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(ring_buffer->cursors) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    cursor = RingBufferBroadcast_xCursor(ring_buffer, consumer);
+
+    if(IS_NULLPTR(cursor))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    head = atomic_load_explicit(&cursor->head, memory_order_relaxed);
+
+    /*  items available to the consumer, up to the end of ring buffer data  */
+    (*item_count) = MIN((RingBuffer_Counter_t)(atomic_load_explicit(&ring_buffer->tail, memory_order_acquire) - head),
+                        (RingBuffer_Counter_t)(ring_buffer->size - (head & (ring_buffer->size - 1))));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_BROADCAST  */
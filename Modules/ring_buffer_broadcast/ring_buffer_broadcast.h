@@ -0,0 +1,305 @@
+/******************************************************************************
+ * @file      ring_buffer_broadcast.h
+ * @brief     A Lock free, broadcast SPMC (Single Producer Multiple Consumers),
+ *            FIFO (First In, First Out) ring buffer.
+ *
+ * @details   Broadcast ring buffer delivers every item put by the producer to
+ *            every consumer, without copying items into a ring buffer per consumer:
+ *              - Each consumer has its own read pointer (cursor), and reads items
+ *              at its own pace using peek/get/skip/block-read functions
+ *              - The producer's free space is bounded by the slowest consumer
+ *              - Consumers can join (start reading from the newest item) and leave
+ *              at runtime, while the producer is putting items
+ *              - When no consumer is joined, the producer overwrites old items freely
+ *
+ *            Requires #RING_BUFFER_ATOMIC and #RING_BUFFER_FREE_RUNNING,
+ *            broadcast ring buffer functions are not available otherwise.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_BROADCAST_H__
+#define __RING_BUFFER_BROADCAST_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferBroadcast Lock free broadcast SPMC (Single Producer, Multiple Consumers) ring buffer
+ * @brief Lock free broadcast SPMC (Single Producer, Multiple Consumers) ring buffer
+ * @details   Every consumer reads every item, using its own cursor. The producer is bounded by the slowest consumer.
+ * @{
+ * */
+
+/**
+ * @brief Broadcast ring buffer is available, it needs atomic free running ring buffer pointers
+ * */
+#define RING_BUFFER_BROADCAST           (RING_BUFFER_ATOMIC && RING_BUFFER_FREE_RUNNING)
+
+#if RING_BUFFER_BROADCAST
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Broadcast ring buffer consumer cursor
+ *
+ * @note Cursors are aligned (padded) to #RING_BUFFER_CACHE_LINE_SIZE when it's set,
+ *       so consumers don't share cache lines.
+ */
+typedef struct RingBufferBroadcast_Cursor_t {
+#if RING_BUFFER_CACHE_LINE_SIZE
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t head;        /**<  consumer's read pointer, used to read items from the buffer  */
+    RingBuffer_SharedCounter_t state;       /**<  cursor state: free, joining or joined  */
+} RingBufferBroadcast_Cursor_t;
+
+/**
+ * @brief Broadcast ring buffer consumer identifier, index of consumer's cursor
+ */
+typedef RingBuffer_Counter_t RingBufferBroadcast_Consumer_t;
+
+/**
+ * @brief Broadcast ring buffer structure
+ */
+typedef struct RingBufferBroadcast_t {
+    RingBuffer_Item_t * data;               /**<  pointer to ring buffer data  */
+    RingBuffer_Counter_t size;              /**<  size of ring buffer, maximum number of items ring buffer can hold  */
+    RingBufferBroadcast_Cursor_t * cursors; /**<  pointer to consumers cursors  */
+    RingBuffer_Counter_t cursor_count;      /**<  number of cursors, maximum number of joined consumers  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  producer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t tail;        /**<  ring buffer tail pointer, used to write items to the buffer  */
+    RingBuffer_Counter_t limit;             /**<  producer's cached write limit, slowest consumer's head + size  */
+} RingBufferBroadcast_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize broadcast ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] data         : pointer to an array of items used for ring buffer's data storage
+ * @param [in] size         : size of ring buffer data, must be a power of 2 > 1
+ * @param [in] cursors      : pointer to an array of @p cursor_count consumer cursors
+ * @param [in] cursor_count : maximum number of joined consumers, must be > 0
+ *
+ * @pre @p ring_buffer, @p data and @p cursors are not null
+ *
+ * @post @p ring_buffer instance is initialized, is empty and has no joined consumers
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p data or @p cursors is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1, @p size is not a power of 2, or @p cursor_count is 0
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enInit(RingBufferBroadcast_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size,
+                                              RingBufferBroadcast_Cursor_t * const cursors, RingBuffer_Counter_t cursor_count);
+
+
+/** @brief Join broadcast ring buffer as a consumer, can be called while the producer is putting items
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [out] consumer    : pointer to consumer identifier variable, used with consumer functions
+ *
+ * @post @p consumer reads items put into @p ring_buffer after it joined
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE    : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR : @p ring_buffer or @p consumer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_FULL    : all cursors are used by joined consumers
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enJoin(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t * const consumer);
+
+
+/** @brief Leave broadcast ring buffer, the producer is no longer bounded by @p consumer
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] consumer     : joined consumer identifier
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p consumer is not a joined consumer
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enLeave(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer);
+
+
+/** @brief Put an item into broadcast ring buffer (producer)
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] item         : pointer to ring buffer item to put into ring buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE    : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_FULL    : slowest consumer didn't read the oldest item yet
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enPutItem(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Item_t const * const item);
+
+
+/** @brief Put multiple items into broadcast ring buffer (producer)
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] items        : pointer to an array of ring buffer items
+ * @param [in] len          : number of items to put into ring buffer
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items successfully put into the ring buffer.
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p items is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0
+ *         - #RING_BUFFER_ERROR_FULL                : slowest consumer didn't read the oldest item yet
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the items were put into @p ring_buffer
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enPutItems(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count);
+
+
+/** @brief Get free space available to the producer, bounded by the slowest joined consumer
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [out] free_count  : pointer to RingBuffer_Counter_t variable
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p free_count is NULL, or @p ring_buffer was not initialized
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enFreeCount(RingBufferBroadcast_t * const ring_buffer, RingBuffer_Counter_t * const free_count);
+
+
+/** @brief Get items from broadcast ring buffer (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] consumer     : joined consumer identifier
+ * @param [out] items       : pointer to an array of ring buffer items
+ * @param [in] len          : number of items to get from ring buffer
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items taken from the ring buffer.
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer, @p items or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0, or @p consumer is not a valid consumer
+ *         - #RING_BUFFER_ERROR_EMPTY               : no items for @p consumer
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the items were taken
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enGetItems(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer,
+                                                  RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count);
+
+
+/** @brief Read items from broadcast ring buffer without removing them (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] consumer     : joined consumer identifier
+ * @param [out] items       : pointer to an array of ring buffer items to read items into
+ * @param [in] len          : number of items to peek
+ * @param [in] offset       : number of items to skip before peeking
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items read
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer, @p items or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0, or @p consumer is not a valid consumer
+ *         - #RING_BUFFER_ERROR_EMPTY               : no items for @p consumer
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the items were read
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enPeekItems(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer,
+                                                   RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t offset, RingBuffer_Counter_t * const item_count);
+
+
+/** @brief Skip oldest items of a consumer, moves consumer's read pointer ahead (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] consumer     : joined consumer identifier
+ * @param [in] skip_count   : number of items to skip
+ * @param [out] skipped     : pointer to RingBuffer_Counter_t variable to store number of skipped items
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p skipped is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p skip_count is 0, or @p consumer is not a valid consumer
+ *         - #RING_BUFFER_ERROR_EMPTY               : no items for @p consumer
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the items were skipped
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enSkipItems(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer,
+                                                   RingBuffer_Counter_t skip_count, RingBuffer_Counter_t * const skipped);
+
+
+/** @brief Get number of items available to a consumer
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] consumer     : joined consumer identifier
+ * @param [out] item_count  : pointer to RingBuffer_Counter_t variable
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p consumer is not a valid consumer
+ *
+ */
+RingBuffer_Error_t RingBufferBroadcast_enItemCount(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer, RingBuffer_Counter_t * const item_count);
+
+
+/**
+ * @brief Get consumer's read address, address of its oldest item (consumer, zero copy read)
+ *
+ * @param [in] ring_buffer      : pointer to broadcast ring buffer object
+ * @param [in] consumer         : joined consumer identifier
+ * @param [out] read_address    : pointer to pointer to RingBuffer_Item_t to store address of item to be read
+ *
+ * @note Items are read in place, then released using RingBufferBroadcast_enSkipItems()
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p read_address is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p consumer is not a valid consumer
+ *
+ * */
+RingBuffer_Error_t RingBufferBroadcast_enBlockReadAddress(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer, RingBuffer_Item_t ** const read_address);
+
+
+/**
+ * @brief Get consumer's number of items that can be read as a contiguous linear block in memory (consumer, zero copy read)
+ *
+ * @param [in] ring_buffer  : pointer to broadcast ring buffer object
+ * @param [in] consumer     : joined consumer identifier
+ * @param [out] item_count  : pointer to RingBuffer_Counter_t to store number of items that can be read
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p consumer is not a valid consumer
+ *
+ * */
+RingBuffer_Error_t RingBufferBroadcast_enBlockReadCount(RingBufferBroadcast_t * const ring_buffer, RingBufferBroadcast_Consumer_t consumer, RingBuffer_Counter_t * const item_count);
+
+#endif /*  RING_BUFFER_BROADCAST  */
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_BROADCAST_H__ */
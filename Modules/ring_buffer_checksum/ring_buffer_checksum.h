@@ -0,0 +1,148 @@
+/******************************************************************************
+ * @file      ring_buffer_checksum.h
+ * @brief     Streaming checksums (CRC32C, CRC16-CCITT, Adler32) over ring buffer items,
+ *            computed in place.
+ *
+ * @details   Checksums are computed over a range of readable items, given as an offset and a length
+ *            from the oldest item (ring buffer head), without peeking items into a scratch array.
+ *            Items are checksummed as bytes, a range wrapping around the end of ring buffer data is
+ *            checksummed in two parts.
+ *
+ *            Checksums are incremental: the checksum of a range continues from the checksum passed in,
+ *            so a frame can be checksummed as its items arrive (offset 0 with the items received so far,
+ *            then from that offset with the new items), and isn't checksummed again at the end:
+ *              - RingBuffer_enCrc32c()     : CRC-32C (Castagnoli), using CRC instructions when available
+ *                                            (x86 SSE4.2, ARMv8 CRC32), start with #RING_BUFFER_CRC32C_INIT
+ *              - RingBuffer_enCrc16Ccitt() : CRC-16/CCITT-FALSE (polynomial 0x1021), start with #RING_BUFFER_CRC16_CCITT_INIT
+ *              - RingBuffer_enAdler32()    : Adler-32, start with #RING_BUFFER_ADLER32_INIT
+ *
+ *            Checksums are computed by the consumer side, they don't remove items.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_CHECKSUM_H__
+#define __RING_BUFFER_CHECKSUM_H__
+
+#include <stdint.h>
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferChecksum Ring buffer streaming checksums
+ * @brief Ring buffer in place CRC32C, CRC16-CCITT and Adler32
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------- Configuration Macros ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Use CRC instructions for CRC32C
+ *
+ * @note Defaults to 1 when compiler flags enable them: SSE4.2 on x86 (`-msse4.2`), CRC32 on ARMv8 (`-march=armv8-a+crc`).
+ *       Can be set during build to use the table driven CRC32C: `-DRING_BUFFER_CRC32C_HARDWARE=0`
+ * */
+#ifndef RING_BUFFER_CRC32C_HARDWARE
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+#define RING_BUFFER_CRC32C_HARDWARE     1
+#else
+#define RING_BUFFER_CRC32C_HARDWARE     0
+#endif /*  __SSE4_2__ || __ARM_FEATURE_CRC32  */
+#endif /*  RING_BUFFER_CRC32C_HARDWARE  */
+
+/**
+ * @brief Initial CRC32C, the CRC32C of no items
+ * */
+#define RING_BUFFER_CRC32C_INIT         0x00000000UL
+
+/**
+ * @brief Initial CRC16-CCITT, the CRC16-CCITT of no items
+ * */
+#define RING_BUFFER_CRC16_CCITT_INIT    0xFFFFU
+
+/**
+ * @brief Initial Adler32, the Adler32 of no items
+ * */
+#define RING_BUFFER_ADLER32_INIT        0x00000001UL
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Continue CRC32C @p crc over @p len items, @p offset items after the oldest item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] offset       : number of oldest items before the range
+ * @param [in] len          : number of items in the range
+ * @param [in,out] crc      : pointer to CRC32C of the items before the range (#RING_BUFFER_CRC32C_INIT for none),
+ *                            updated to the CRC32C including the range
+ *
+ * @note Same value as the common CRC-32C of the item bytes (`"123456789"` gives 0xE3069283).
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p crc is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0
+ *         - #RING_BUFFER_ERROR_EMPTY               : @p ring_buffer is empty, @p crc is unchanged
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : @p ring_buffer has less than @p offset + @p len items, @p crc is unchanged
+ *
+ */
+RingBuffer_Error_t RingBuffer_enCrc32c(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t offset, RingBuffer_Counter_t len, uint32_t * const crc);
+
+
+/** @brief Continue CRC16-CCITT @p crc over @p len items, @p offset items after the oldest item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] offset       : number of oldest items before the range
+ * @param [in] len          : number of items in the range
+ * @param [in,out] crc      : pointer to CRC16-CCITT of the items before the range (#RING_BUFFER_CRC16_CCITT_INIT for none),
+ *                            updated to the CRC16-CCITT including the range
+ *
+ * @note CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, not reflected (`"123456789"` gives 0x29B1).
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - Same as RingBuffer_enCrc32c()
+ *
+ */
+RingBuffer_Error_t RingBuffer_enCrc16Ccitt(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t offset, RingBuffer_Counter_t len, uint16_t * const crc);
+
+
+/** @brief Continue Adler32 @p adler over @p len items, @p offset items after the oldest item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] offset       : number of oldest items before the range
+ * @param [in] len          : number of items in the range
+ * @param [in,out] adler    : pointer to Adler32 of the items before the range (#RING_BUFFER_ADLER32_INIT for none),
+ *                            updated to the Adler32 including the range
+ *
+ * @note Same value as zlib's `adler32()` (`"123456789"` gives 0x091E01DE).
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - Same as RingBuffer_enCrc32c()
+ *
+ */
+RingBuffer_Error_t RingBuffer_enAdler32(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t offset, RingBuffer_Counter_t len, uint32_t * const adler);
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_CHECKSUM_H__ */
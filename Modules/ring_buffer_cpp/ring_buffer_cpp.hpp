@@ -0,0 +1,825 @@
+/******************************************************************************
+ * @file      ring_buffer_cpp.hpp
+ * @brief     C++17 ring buffer container `RingBuffer<T, N>`: items of any type (move-only, non trivial),
+ *            compile-time or runtime capacity, spans and random access iterators.
+ *
+ * @details   `RingBuffer<T, N>` holds up to `N` items in the object, `RingBuffer<T>` allocates its
+ *            locations when it's constructed with a runtime capacity:
+ *
+ *              RingBuffer<std::string, 16> names;
+ *              RingBuffer<std::unique_ptr<Message>> messages(capacity);
+ *
+ *            Pointers are a #RingBuffer_t, moved with the index logic of ring_buffer.c (ring_buffer_inline.h),
+ *            in the same #RING_BUFFER_POWER_OF_TWO, #RING_BUFFER_FREE_RUNNING, #RING_BUFFER_CACHE_LINE_SIZE
+ *            and #RING_BUFFER_ATOMIC configuration. Items are constructed in place when they're put
+ *            (push(), emplace()), and moved out and destroyed when they're taken (pop(), skip()):
+ *              - bulk push() and pop() of trivially copyable items copy blocks with the ring buffer
+ *                copy kernel (RingBuffer_xCopy()), other items are moved one by one
+ *              - readable() gives the items as two spans: up to the end of ring buffer data, then from its start,
+ *                writable() gives the free locations of trivially copyable items, and commit() publishes them
+ *              - begin() and end() are random access iterators from the oldest item, for standard algorithms
+ *
+ *            Same rules as #RingBuffer_t (SPSC): push(), emplace(), writable() and commit() are called by the producer,
+ *            pop(), skip(), clear(), readable(), element access and iterators by the consumer.
+ *
+ * @note      C++17, spans are `std::span` in C++20 (RingBufferSpan otherwise). Link ring_buffer.c.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_CPP_HPP__
+#define __RING_BUFFER_CPP_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if (__cplusplus >= 202002L) && defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#endif /*  __has_include(<span>)  */
+#endif /*  __cplusplus >= 202002L  */
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
+
+/**
+ * @addtogroup RingBuffer
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* ---------------------------- Capacity Helpers --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Capacity of `RingBuffer<T>`, given when it's constructed
+ */
+inline constexpr std::size_t RING_BUFFER_DYNAMIC_CAPACITY = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Get number of locations in ring buffer data holding at least @p capacity items.
+ *
+ * `capacity + 1` (one location is always free), rounded up to a power of 2 when #RING_BUFFER_POWER_OF_TWO is enabled,
+ * `capacity` rounded up to a power of 2 when #RING_BUFFER_FREE_RUNNING is enabled.
+ * No capacity is a ring buffer without data and free locations (1 location, 0 with free running pointers).
+ */
+constexpr std::size_t RingBuffer_xSlotCount(std::size_t capacity) noexcept
+{
+#if RING_BUFFER_FREE_RUNNING
+
+    std::size_t slots = 2;
+
+    if(capacity == 0)
+    {
+        return 0;
+    }
+
+    while(slots < capacity)
+    {
+        slots *= 2;
+    }
+
+    return slots;
+
+#elif RING_BUFFER_POWER_OF_TWO
+
+    std::size_t slots = 2;
+
+    if(capacity == 0)
+    {
+        return 1;
+    }
+
+    while(slots <= capacity)
+    {
+        slots *= 2;
+    }
+
+    return slots;
+
+#else
+
+    return capacity + 1;
+
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get largest capacity, its locations are counted by #RingBuffer_Counter_t.
+ */
+constexpr std::size_t RingBuffer_xMaxCapacity() noexcept
+{
+    constexpr std::size_t counter_max = static_cast<std::size_t>(std::min<std::uintmax_t>(std::numeric_limits<RingBuffer_Counter_t>::max(),
+                                                                                           std::numeric_limits<std::size_t>::max()));
+
+#if RING_BUFFER_FREE_RUNNING
+
+    return (counter_max >> 1) + 1;
+
+#elif RING_BUFFER_POWER_OF_TWO
+
+    return counter_max >> 1;
+
+#else
+
+    return counter_max - 1;
+
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+}
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------------- Spans ---------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+#if defined(__cpp_lib_span)
+
+/**
+ * @brief Contiguous items in ring buffer data
+ */
+template<typename T>
+using RingBufferSpan = std::span<T>;
+
+#else
+
+/**
+ * @brief Contiguous items in ring buffer data, the part of `std::span` used by ring buffers before C++20
+ */
+template<typename T>
+class RingBufferSpan {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+
+    constexpr RingBufferSpan() noexcept = default;
+    constexpr RingBufferSpan(T * data, size_type size) noexcept : data_(data), size_(size) {}
+
+    constexpr pointer data() const noexcept { return data_; }
+    constexpr size_type size() const noexcept { return size_; }
+    constexpr size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr reference operator[](size_type index) const noexcept { return data_[index]; }
+    constexpr reference front() const noexcept { return data_[0]; }
+    constexpr reference back() const noexcept { return data_[size_ - 1]; }
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+private:
+    T * data_ = nullptr;
+    size_type size_ = 0;
+};
+
+#endif /*  __cpp_lib_span  */
+
+/**
+ * @brief Locations of a static ring buffer, in the object
+ */
+template<typename T, std::size_t SLOTS>
+struct RingBufferSlots {
+    alignas(T) unsigned char bytes [sizeof(T) * SLOTS];
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------- Container ------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Ring buffer of up to @p N items of type @p T, or of a capacity given at construction (#RING_BUFFER_DYNAMIC_CAPACITY)
+ *
+ * @note capacity() can be larger than the requested capacity: locations are rounded up to a power of 2
+ *       when #RING_BUFFER_POWER_OF_TWO is enabled.
+ */
+template<typename T, std::size_t N = RING_BUFFER_DYNAMIC_CAPACITY>
+class RingBuffer {
+    static constexpr bool DYNAMIC = (N == RING_BUFFER_DYNAMIC_CAPACITY);
+    static constexpr std::size_t STATIC_SLOTS = DYNAMIC ? 1 : RingBuffer_xSlotCount(N);
+    static constexpr std::size_t STATIC_CAPACITY = RING_BUFFER_FREE_RUNNING ? STATIC_SLOTS : (STATIC_SLOTS - 1);
+    static constexpr std::size_t COPY_MAX_COUNT = DYNAMIC ? SIZE_MAX : STATIC_CAPACITY;
+
+    static_assert(DYNAMIC || ((N > 0) && (N <= RingBuffer_xMaxCapacity())), "RingBuffer capacity must be > 0, and its locations counted by RingBuffer_Counter_t");
+
+    template<bool CONST>
+    class Iterator;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = T const &;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using span = RingBufferSpan<T>;
+    using const_span = RingBufferSpan<T const>;
+
+    /**
+     * @brief Empty ring buffer of @p N items, a ring buffer without capacity for #RING_BUFFER_DYNAMIC_CAPACITY
+     */
+    RingBuffer() noexcept
+    {
+        xInit(DYNAMIC ? RingBuffer_xSlotCount(0) : STATIC_SLOTS);
+    }
+
+    /**
+     * @brief Empty ring buffer of at least @p capacity items (up to max_size()), data is allocated
+     */
+    template<bool D = DYNAMIC, typename = std::enable_if_t<D>>
+    explicit RingBuffer(size_type capacity)
+    {
+        xAllocate(RingBuffer_xSlotCount(std::min(capacity, max_size())));
+    }
+
+    RingBuffer(RingBuffer const & other)
+    {
+        if constexpr(DYNAMIC)
+        {
+            xAllocate(other.ring_buffer_.size);
+        }
+        else
+        {
+            xInit(STATIC_SLOTS);
+        }
+
+        try
+        {
+            for(T const & item : other)
+            {
+                (void)emplace(item);
+            }
+        }
+        catch(...)
+        {
+            /*  destructor doesn't run when a constructor throws, destroy copied items and free data  */
+            clear();
+            xRelease();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Take items of @p other, @p other is left empty (without capacity for #RING_BUFFER_DYNAMIC_CAPACITY: data is moved)
+     */
+    RingBuffer(RingBuffer && other) noexcept(DYNAMIC || std::is_nothrow_move_constructible_v<T>)
+    {
+        xInit(DYNAMIC ? RingBuffer_xSlotCount(0) : STATIC_SLOTS);
+        xTake(other);
+    }
+
+    RingBuffer & operator=(RingBuffer const & other)
+    {
+        if(this != &other)
+        {
+            RingBuffer copy(other);
+
+            (*this) = std::move(copy);
+        }
+
+        return (*this);
+    }
+
+    RingBuffer & operator=(RingBuffer && other) noexcept(DYNAMIC || std::is_nothrow_move_constructible_v<T>)
+    {
+        if(this != &other)
+        {
+            clear();
+            xRelease();
+            xTake(other);
+        }
+
+        return (*this);
+    }
+
+    ~RingBuffer()
+    {
+        clear();
+        xRelease();
+    }
+
+    /* ----------------------------------------------------------------------- */
+
+    /**
+     * @brief Get maximum number of items ring buffer can hold
+     */
+    size_type capacity() const noexcept
+    {
+        return RingBuffer_xCapacity(&ring_buffer_);
+    }
+
+    /**
+     * @brief Get largest capacity
+     */
+    static constexpr size_type max_size() noexcept
+    {
+        return RingBuffer_xMaxCapacity();
+    }
+
+    /**
+     * @brief Get number of items in ring buffer
+     */
+    size_type size() const noexcept
+    {
+        RingBuffer_Counter_t tail = RingBuffer_xLoadAcquire(&ring_buffer_.tail);
+        RingBuffer_Counter_t head = RingBuffer_xLoadAcquire(&ring_buffer_.head);
+
+        return RingBuffer_xItemCount(&ring_buffer_, head, tail);
+    }
+
+    bool empty() const noexcept
+    {
+        return RingBuffer_xLoadAcquire(&ring_buffer_.head) == RingBuffer_xLoadAcquire(&ring_buffer_.tail);
+    }
+
+    bool full() const noexcept
+    {
+        return size() == capacity();
+    }
+
+    /* ----------------------------------------------------------------------- */
+
+    /**
+     * @brief Construct an item from @p args in place, after the newest item (producer)
+     *
+     * @return true, or false when the ring buffer is full (nothing is constructed)
+     */
+    template<typename... Args>
+    bool emplace(Args &&... args)
+    {
+        RingBuffer_Counter_t tail = RingBuffer_xLoadOwn(&ring_buffer_.tail);
+        RingBuffer_Counter_t head = RingBuffer_xProducerHead(&ring_buffer_, tail, 1);
+
+        if(RingBuffer_xFreeCount(&ring_buffer_, head, tail) == 0)
+        {
+            return false;
+        }
+
+        ::new(static_cast<void *>(xSlot(RingBuffer_xIndex(&ring_buffer_, tail)))) T(std::forward<Args>(args)...);
+
+        RingBuffer_xStoreRelease(&ring_buffer_.tail, RingBuffer_xWrap(&ring_buffer_, tail, 1));
+
+        return true;
+    }
+
+    /**
+     * @brief Put a copy of @p item (producer)
+     *
+     * @return true, or false when the ring buffer is full
+     */
+    bool push(T const & item)
+    {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Move @p item into the ring buffer (producer), @p item isn't moved when the ring buffer is full
+     *
+     * @return true, or false when the ring buffer is full
+     */
+    bool push(T && item)
+    {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Put copies of up to @p count items (producer), blocks of trivially copyable items are copied with RingBuffer_xCopy()
+     *
+     * @return number of items put, less than @p count when the ring buffer didn't have enough free locations
+     */
+    size_type push(T const * items, size_type count)
+    {
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            RingBuffer_Counter_t tail = RingBuffer_xLoadOwn(&ring_buffer_.tail);
+            RingBuffer_Counter_t len = xClamp(count);
+            RingBuffer_Counter_t free_count = RingBuffer_xFreeCount(&ring_buffer_, RingBuffer_xProducerHead(&ring_buffer_, tail, len), tail);
+            RingBuffer_Counter_t write_count = MIN(len, free_count);
+            span first;
+            span second;
+
+            xSpans(tail, write_count, first, second);
+
+            RingBuffer_xCopy(first.data(), items, first.size(), sizeof(T), COPY_MAX_COUNT);
+            RingBuffer_xCopy(second.data(), &items[first.size()], second.size(), sizeof(T), COPY_MAX_COUNT);
+
+            RingBuffer_xStoreRelease(&ring_buffer_.tail, RingBuffer_xWrap(&ring_buffer_, tail, write_count));
+
+            return write_count;
+        }
+        else
+        {
+            size_type put_count = 0;
+
+            while((put_count < count) && emplace(items[put_count]))
+            {
+                put_count++;
+            }
+
+            return put_count;
+        }
+    }
+
+    /* ----------------------------------------------------------------------- */
+
+    /**
+     * @brief Move the oldest item into @p item, and remove it (consumer)
+     *
+     * @return true, or false when the ring buffer is empty (@p item is unchanged)
+     */
+    bool pop(T & item)
+    {
+        RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer_.head);
+
+        if(head == RingBuffer_xConsumerTail(&ring_buffer_, head, 1))
+        {
+            return false;
+        }
+
+        T * oldest = xSlot(RingBuffer_xIndex(&ring_buffer_, head));
+
+        item = std::move(*oldest);
+        oldest->~T();
+
+        RingBuffer_xStoreRelease(&ring_buffer_.head, RingBuffer_xWrap(&ring_buffer_, head, 1));
+
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest item (consumer)
+     *
+     * @return true, or false when the ring buffer is empty
+     */
+    bool pop()
+    {
+        return skip(1) == 1;
+    }
+
+    /**
+     * @brief Move up to @p count oldest items into @p items, and remove them (consumer),
+     *        blocks of trivially copyable items are copied with RingBuffer_xCopy()
+     *
+     * @return number of items taken, less than @p count when the ring buffer didn't have enough items
+     */
+    size_type pop(T * items, size_type count)
+    {
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer_.head);
+            RingBuffer_Counter_t len = xClamp(count);
+            RingBuffer_Counter_t item_count = RingBuffer_xItemCount(&ring_buffer_, head, RingBuffer_xConsumerTail(&ring_buffer_, head, len));
+            RingBuffer_Counter_t read_count = MIN(len, item_count);
+            span first;
+            span second;
+
+            xSpans(head, read_count, first, second);
+
+            RingBuffer_xCopy(items, first.data(), first.size(), sizeof(T), COPY_MAX_COUNT);
+            RingBuffer_xCopy(&items[first.size()], second.data(), second.size(), sizeof(T), COPY_MAX_COUNT);
+
+            RingBuffer_xStoreRelease(&ring_buffer_.head, RingBuffer_xWrap(&ring_buffer_, head, read_count));
+
+            return read_count;
+        }
+        else
+        {
+            size_type taken_count = 0;
+
+            while((taken_count < count) && pop(items[taken_count]))
+            {
+                taken_count++;
+            }
+
+            return taken_count;
+        }
+    }
+
+    /**
+     * @brief Remove up to @p count oldest items (consumer)
+     *
+     * @return number of items removed
+     */
+    size_type skip(size_type count)
+    {
+        RingBuffer_Counter_t skip_count = static_cast<RingBuffer_Counter_t>(std::min(count, size()));
+
+        if constexpr(!std::is_trivially_destructible_v<T>)
+        {
+            for(RingBuffer_Counter_t i = 0; i < skip_count; i++)
+            {
+                (*this)[i].~T();
+            }
+        }
+
+        return RingBuffer_uSkipItems(&ring_buffer_, skip_count);
+    }
+
+    /**
+     * @brief Remove all items (consumer)
+     */
+    void clear()
+    {
+        (void)skip(size());
+    }
+
+    /* ----------------------------------------------------------------------- */
+
+    /**
+     * @brief Get item @p index after the oldest item (consumer)
+     *
+     * @pre @p index < size()
+     */
+    reference operator[](size_type index) noexcept
+    {
+        return (*xSlot(xLocation(index)));
+    }
+
+    const_reference operator[](size_type index) const noexcept
+    {
+        return (*xSlot(xLocation(index)));
+    }
+
+    /**
+     * @brief Get oldest item (consumer)
+     *
+     * @pre ring buffer isn't empty
+     */
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+
+    /**
+     * @brief Get newest item (consumer)
+     *
+     * @pre ring buffer isn't empty
+     */
+    reference back() noexcept { return (*this)[size() - 1]; }
+    const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, static_cast<difference_type>(size())); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, static_cast<difference_type>(size())); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* ----------------------------------------------------------------------- */
+
+    /**
+     * @brief Get items as two spans: from the oldest item up to the end of ring buffer data, then from its start (consumer)
+     *
+     * @note Items stay in the ring buffer, remove them with skip().
+     */
+    std::pair<span, span> readable() noexcept
+    {
+        RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer_.head);
+        RingBuffer_Counter_t tail = RingBuffer_xConsumerTail(&ring_buffer_, head, RingBuffer_xCapacity(&ring_buffer_));
+        std::pair<span, span> spans;
+
+        xSpans(head, RingBuffer_xItemCount(&ring_buffer_, head, tail), spans.first, spans.second);
+
+        return spans;
+    }
+
+    std::pair<const_span, const_span> readable() const noexcept
+    {
+        RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer_.head);
+        RingBuffer_Counter_t tail = RingBuffer_xLoadAcquire(&ring_buffer_.tail);
+        std::pair<span, span> spans;
+
+        const_cast<RingBuffer *>(this)->xSpans(head, RingBuffer_xItemCount(&ring_buffer_, head, tail), spans.first, spans.second);
+
+        return { const_span(spans.first.data(), spans.first.size()), const_span(spans.second.data(), spans.second.size()) };
+    }
+
+    /**
+     * @brief Get free locations as two spans: after the newest item up to the end of ring buffer data, then from its start (producer)
+     *
+     * @note Items written to the spans are added with commit().
+     */
+    std::pair<span, span> writable() noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "RingBuffer::writable() needs trivially copyable items, free locations hold no item");
+
+        RingBuffer_Counter_t tail = RingBuffer_xLoadOwn(&ring_buffer_.tail);
+        RingBuffer_Counter_t head = RingBuffer_xProducerHead(&ring_buffer_, tail, RingBuffer_xCapacity(&ring_buffer_));
+        std::pair<span, span> spans;
+
+        xSpans(tail, RingBuffer_xFreeCount(&ring_buffer_, head, tail), spans.first, spans.second);
+
+        return spans;
+    }
+
+    /**
+     * @brief Add up to @p count items written to writable() spans (producer)
+     *
+     * @return number of items added
+     */
+    size_type commit(size_type count) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "RingBuffer::commit() needs trivially copyable items");
+
+        return RingBuffer_uAdvance(&ring_buffer_, xClamp(count));
+    }
+
+private:
+    /* ----------------------------------------------------------------------- */
+
+    T * xData() noexcept
+    {
+        if constexpr(DYNAMIC)
+        {
+            return data_;
+        }
+        else
+        {
+            return reinterpret_cast<T *>(data_.bytes);
+        }
+    }
+
+    T const * xData() const noexcept
+    {
+        return const_cast<RingBuffer *>(this)->xData();
+    }
+
+    T * xSlot(RingBuffer_Counter_t location) noexcept { return xData() + location; }
+    T const * xSlot(RingBuffer_Counter_t location) const noexcept { return xData() + location; }
+
+    /*  location of item @p index after the oldest item  */
+    RingBuffer_Counter_t xLocation(size_type index) const noexcept
+    {
+        RingBuffer_Counter_t head = RingBuffer_xLoadOwn(&ring_buffer_.head);
+
+        return RingBuffer_xIndex(&ring_buffer_, RingBuffer_xWrap(&ring_buffer_, head, static_cast<RingBuffer_Counter_t>(index)));
+    }
+
+    /*  largest number of items transferred at once  */
+    RingBuffer_Counter_t xClamp(size_type count) const noexcept
+    {
+        return static_cast<RingBuffer_Counter_t>(std::min(count, capacity()));
+    }
+
+    /*  split @p count locations from ring buffer pointer @p index, like RingBuffer_xSpans()  */
+    void xSpans(RingBuffer_Counter_t index, RingBuffer_Counter_t count, span & first, span & second) noexcept
+    {
+        RingBuffer_Counter_t location = RingBuffer_xIndex(&ring_buffer_, index);
+        RingBuffer_Counter_t first_count = MIN(count, RingBuffer_xLinearCount(&ring_buffer_, location));
+
+        /*  the second count is bounded by @p count (same value): without it, the compiler rewrites the difference and loses
+            the range of the copies, and warns about copies past the end of the user array  */
+        first = span(xSlot(location), first_count);
+        second = span(xData(), MIN(static_cast<RingBuffer_Counter_t>(count - first_count), count));
+    }
+
+    /* ----------------------------------------------------------------------- */
+
+    /*  empty ring buffer pointers over @p slots locations  */
+    void xInit(std::size_t slots) noexcept
+    {
+        if(slots < 2)
+        {
+            /*  without data: no free location (one location, or no location for free running pointers), data is never accessed  */
+            (void)RingBuffer_enInit(&ring_buffer_, reinterpret_cast<RingBuffer_Item_t const *>(&ring_buffer_), 2);
+            ring_buffer_.data = nullptr;
+            ring_buffer_.size = static_cast<RingBuffer_Counter_t>(slots);
+            return;
+        }
+
+        (void)RingBuffer_enInit(&ring_buffer_, reinterpret_cast<RingBuffer_Item_t const *>(xData()), static_cast<RingBuffer_Counter_t>(slots));
+    }
+
+    void xAllocate(std::size_t slots)
+    {
+        if constexpr(DYNAMIC)
+        {
+            data_ = (slots < 2) ? nullptr : std::allocator<T>().allocate(slots);
+        }
+
+        xInit(slots);
+    }
+
+    /*  free allocated data, ring buffer is empty  */
+    void xRelease() noexcept
+    {
+        if constexpr(DYNAMIC)
+        {
+            if(data_ != nullptr)
+            {
+                std::allocator<T>().deallocate(data_, ring_buffer_.size);
+                data_ = nullptr;
+            }
+
+            xInit(RingBuffer_xSlotCount(0));
+        }
+    }
+
+    /*  take items of @p other, ring buffer is empty (and has no data for #RING_BUFFER_DYNAMIC_CAPACITY)  */
+    void xTake(RingBuffer & other)
+    {
+        if constexpr(DYNAMIC)
+        {
+            RingBuffer_Counter_t location = other.xLocation(0);
+            RingBuffer_Counter_t count = static_cast<RingBuffer_Counter_t>(other.size());
+
+            data_ = std::exchange(other.data_, nullptr);
+            xInit(other.ring_buffer_.size);
+            other.xInit(RingBuffer_xSlotCount(0));
+
+            /*  same locations: pointers at the oldest item's location, then the items  */
+            (void)RingBuffer_uAdvance(&ring_buffer_, location);
+            (void)RingBuffer_uSkipItems(&ring_buffer_, location);
+            (void)RingBuffer_uAdvance(&ring_buffer_, count);
+        }
+        else
+        {
+            for(T & item : other)
+            {
+                (void)emplace(std::move(item));
+            }
+
+            other.clear();
+        }
+    }
+
+    /* ----------------------------------------------------------------------- */
+
+    RingBuffer_t ring_buffer_;
+    std::conditional_t<DYNAMIC, T *, RingBufferSlots<T, STATIC_SLOTS>> data_ {};
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------- Iterators ------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Random access iterator over ring buffer items, from the oldest item
+ */
+template<typename T, std::size_t N>
+template<bool CONST>
+class RingBuffer<T, N>::Iterator {
+    using Container = std::conditional_t<CONST, RingBuffer const, RingBuffer>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<CONST, T const *, T *>;
+    using reference = std::conditional_t<CONST, T const &, T &>;
+
+    Iterator() noexcept = default;
+
+    /*  iterator converts to const iterator  */
+    template<bool C = CONST, typename = std::enable_if_t<!C>>
+    operator Iterator<true>() const noexcept { return Iterator<true>(ring_buffer_, offset_); }
+
+    reference operator*() const noexcept { return (*ring_buffer_)[static_cast<size_type>(offset_)]; }
+    pointer operator->() const noexcept { return &(**this); }
+    reference operator[](difference_type n) const noexcept { return (*ring_buffer_)[static_cast<size_type>(offset_ + n)]; }
+
+    Iterator & operator++() noexcept { offset_++; return (*this); }
+    Iterator & operator--() noexcept { offset_--; return (*this); }
+    Iterator operator++(int) noexcept { Iterator previous = (*this); offset_++; return previous; }
+    Iterator operator--(int) noexcept { Iterator previous = (*this); offset_--; return previous; }
+    Iterator & operator+=(difference_type n) noexcept { offset_ += n; return (*this); }
+    Iterator & operator-=(difference_type n) noexcept { offset_ -= n; return (*this); }
+
+    friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+    friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+    friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(Iterator const & a, Iterator const & b) noexcept { return a.offset_ - b.offset_; }
+
+    friend bool operator==(Iterator const & a, Iterator const & b) noexcept { return a.offset_ == b.offset_; }
+    friend bool operator!=(Iterator const & a, Iterator const & b) noexcept { return a.offset_ != b.offset_; }
+    friend bool operator<(Iterator const & a, Iterator const & b) noexcept { return a.offset_ < b.offset_; }
+    friend bool operator>(Iterator const & a, Iterator const & b) noexcept { return a.offset_ > b.offset_; }
+    friend bool operator<=(Iterator const & a, Iterator const & b) noexcept { return a.offset_ <= b.offset_; }
+    friend bool operator>=(Iterator const & a, Iterator const & b) noexcept { return a.offset_ >= b.offset_; }
+
+private:
+    friend class RingBuffer;
+    template<bool>
+    friend class Iterator;
+
+    Iterator(Container * ring_buffer, difference_type offset) noexcept : ring_buffer_(ring_buffer), offset_(offset) {}
+
+    Container * ring_buffer_ = nullptr;     /*  iterated ring buffer  */
+    difference_type offset_ = 0;            /*  number of items after the oldest item  */
+};
+
+/** @} */
+
+#endif /* __RING_BUFFER_CPP_HPP__ */
@@ -0,0 +1,346 @@
+/******************************************************************************
+ * @file      ring_buffer_define.h
+ * @brief     Type generic ring buffer generator: ring buffers of any item type, counter type
+ *            and compile-time capacity, in the same program.
+ *
+ * @details   #RING_BUFFER_ITEM_DATA_TYPE and #RING_BUFFER_COUNTER_DATA_TYPE set one item type for
+ *            every #RingBuffer_t of a program. RING_BUFFER_DEFINE() generates a ring buffer type
+ *            and its `static inline` functions for one item type, counter type and capacity:
+ *
+ *              RING_BUFFER_DEFINE(Samples, int32_t, uint16_t, 1000)
+ *
+ *            defines `Samples_t` (items stored in the structure), `Samples_Item_t`, `Samples_Counter_t`,
+ *            and Samples_enInit(), Samples_uPutItem(), Samples_uGetItem(), Samples_uPutItems(),
+ *            Samples_uGetItems(), Samples_uPeekItems(), Samples_uSkipItems(), Samples_uAdvance(),
+ *            Samples_uItemCount() and Samples_uFreeCount(). They behave like the unchecked ring buffer
+ *            functions of the same name (RingBuffer_uPutItems(), ...), and return the number of items transferred.
+ *
+ *            The capacity is a constant, so the compiler folds the wrap arithmetic, and blocks of items
+ *            are copied by the ring buffer copy kernel specialized for the item size (RingBuffer_xCopy()):
+ *              - power of 2 capacity: free running pointers, locations are masked (like #RING_BUFFER_FREE_RUNNING)
+ *              - other capacities: pointers wrap at `capacity + 1` locations, compared against a constant
+ *
+ *            Generated ring buffers follow the same rules as #RingBuffer_t (SPSC), and use the same
+ *            #RING_BUFFER_ATOMIC and #RING_BUFFER_CACHE_LINE_SIZE configuration.
+ *
+ * @note      C11 (`_Static_assert`, and `_Atomic` when #RING_BUFFER_ATOMIC is enabled).
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_DEFINE_H__
+#define __RING_BUFFER_DEFINE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferDefine Type generic ring buffer generator
+ * @brief Ring buffers specialized for an item type, counter type and compile-time capacity
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Generator Helpers --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Capacity is a power of 2
+ */
+#define RING_BUFFER_DEFINE_IS_POWER_OF_TWO(capacity)        ((((capacity) & ((capacity) - 1)) == 0))
+
+/**
+ * @brief Number of locations in data, `capacity + 1` when the capacity isn't a power of 2 (one location is always free)
+ */
+#define RING_BUFFER_DEFINE_SIZE(capacity)                   (RING_BUFFER_DEFINE_IS_POWER_OF_TWO(capacity) ? (capacity) : ((capacity) + 1))
+
+#define RING_BUFFER_DEFINE_STATIC_ASSERT(condition, message)    _Static_assert((condition), message)
+
+#if RING_BUFFER_ATOMIC
+
+#define RING_BUFFER_DEFINE_SHARED(counter_type)             _Atomic counter_type
+#define RING_BUFFER_DEFINE_LOAD_OWN(counter)                atomic_load_explicit(&(counter), memory_order_relaxed)
+#define RING_BUFFER_DEFINE_LOAD_ACQUIRE(counter)            atomic_load_explicit(&(counter), memory_order_acquire)
+#define RING_BUFFER_DEFINE_STORE_RELEASE(counter, value)    atomic_store_explicit(&(counter), (value), memory_order_release)
+
+#else
+
+#define RING_BUFFER_DEFINE_SHARED(counter_type)             volatile counter_type
+#define RING_BUFFER_DEFINE_LOAD_OWN(counter)                (counter)
+#define RING_BUFFER_DEFINE_LOAD_ACQUIRE(counter)            (counter)
+#define RING_BUFFER_DEFINE_STORE_RELEASE(counter, value)    ((counter) = (value))
+
+#endif /*  RING_BUFFER_ATOMIC  */
+
+#if RING_BUFFER_CACHE_LINE_SIZE
+#define RING_BUFFER_DEFINE_ALIGNED                          RING_BUFFER_CACHE_ALIGNED
+#else
+#define RING_BUFFER_DEFINE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+
+#ifdef DEBUG_RING_BUFFER
+#define RING_BUFFER_DEFINE_CHECK_NULLPTR(ptr)               do { if(IS_NULLPTR(ptr)) { return RING_BUFFER_ERROR_NULLPTR; } } while(0)
+#else
+#define RING_BUFFER_DEFINE_CHECK_NULLPTR(ptr)               ((void)0)
+#endif /*  DEBUG_RING_BUFFER  */
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------- Generator ------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Define ring buffer type `name##_t` of @p capacity items of @p item_type, with @p counter_type pointers,
+ *        and its functions `name##_*()`
+ *
+ * @param name          : prefix of the generated type and functions
+ * @param item_type     : item type, copied as bytes (any size: bytes, samples, structures)
+ * @param counter_type  : unsigned pointer type, must hold @p capacity (`capacity + 1` when it isn't a power of 2)
+ * @param capacity      : maximum number of items, a constant > 0
+ *
+ * @note Use once per name, at file scope (in a header to share the ring buffer type between files).
+ *       Functions are `static inline`, unused functions aren't compiled.
+ *
+ * @note Generated functions:
+ *       - `RingBuffer_Error_t name##_enInit(name##_t * ring_buffer)`: empty the ring buffer
+ *       - `name##_Counter_t name##_uPutItem(name##_t * ring_buffer, name##_Item_t const * item)` and
+ *         `name##_uGetItem(name##_t * ring_buffer, name##_Item_t * item)`: 1, or 0 when full/empty
+ *       - `name##_uPutItems()`, `name##_uGetItems()` and `name##_uPeekItems()`: number of items copied
+ *       - `name##_uSkipItems()` and `name##_uAdvance()`: number of items removed/added
+ *       - `name##_uItemCount()` and `name##_uFreeCount()`
+ */
+#define RING_BUFFER_DEFINE(name, item_type, counter_type, capacity)                                                     \
+/*  item and counter types  */                                                                                          \
+typedef item_type name##_Item_t;                                                                                        \
+typedef counter_type name##_Counter_t;                                                                                  \
+                                                                                                                        \
+RING_BUFFER_DEFINE_STATIC_ASSERT((capacity) > 0, #name ": capacity must be > 0");                                       \
+RING_BUFFER_DEFINE_STATIC_ASSERT((counter_type)(-1) > 0, #name ": counter type must be unsigned");                      \
+RING_BUFFER_DEFINE_STATIC_ASSERT((counter_type)RING_BUFFER_DEFINE_SIZE(capacity) == RING_BUFFER_DEFINE_SIZE(capacity), #name ": capacity doesn't fit counter type"); \
+                                                                                                                        \
+/*  ring buffer structure, items are stored in the structure  */                                                        \
+typedef struct name##_t {                                                                                               \
+    RING_BUFFER_DEFINE_ALIGNED                                                                                          \
+    RING_BUFFER_DEFINE_SHARED(counter_type) head;                                                                       \
+    RING_BUFFER_DEFINE_ALIGNED                                                                                          \
+    RING_BUFFER_DEFINE_SHARED(counter_type) tail;                                                                       \
+    RING_BUFFER_DEFINE_ALIGNED                                                                                          \
+    name##_Item_t data [RING_BUFFER_DEFINE_SIZE(capacity)];                                                             \
+} name##_t;                                                                                                             \
+                                                                                                                        \
+/*  move pointer @p index ahead by @p count locations  */                                                               \
+static inline name##_Counter_t name##_xWrap(name##_Counter_t index, name##_Counter_t count)                             \
+{                                                                                                                       \
+    if(RING_BUFFER_DEFINE_IS_POWER_OF_TWO(capacity))                                                                    \
+    {                                                                                                                   \
+        return (name##_Counter_t)(index + count);                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    if(count >= (name##_Counter_t)(RING_BUFFER_DEFINE_SIZE(capacity) - index))                                          \
+    {                                                                                                                   \
+        return (name##_Counter_t)(index + count - RING_BUFFER_DEFINE_SIZE(capacity)); \
+    }                                                                                                                   \
+                                                                                                                        \
+    return (name##_Counter_t)(index + count);                                                                           \
+}                                                                                                                       \
+                                                                                                                        \
+/*  location of pointer @p index in data  */                                                                            \
+static inline name##_Counter_t name##_xIndex(name##_Counter_t index)                                                    \
+{                                                                                                                       \
+    if(RING_BUFFER_DEFINE_IS_POWER_OF_TWO(capacity))                                                                    \
+    {                                                                                                                   \
+        return (name##_Counter_t)(index & ((capacity) - 1));                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    return index;                                                                                                       \
+}                                                                                                                       \
+                                                                                                                        \
+/*  number of items for @p head and @p tail  */                                                                         \
+static inline name##_Counter_t name##_xItemCount(name##_Counter_t head, name##_Counter_t tail)                          \
+{                                                                                                                       \
+    if(RING_BUFFER_DEFINE_IS_POWER_OF_TWO(capacity) || (tail >= head))                                                  \
+    {                                                                                                                   \
+        return (name##_Counter_t)(tail - head);                                                                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    return (name##_Counter_t)(tail + RING_BUFFER_DEFINE_SIZE(capacity) - head);                                         \
+}                                                                                                                       \
+                                                                                                                        \
+/*  copy @p count items at pointer @p index into @p items, in at most two blocks  */                                    \
+static inline void name##_xCopyOut(name##_t const * const ring_buffer, name##_Counter_t index, name##_Item_t * const items, name##_Counter_t count) \
+{                                                                                                                       \
+    name##_Counter_t location = name##_xIndex(index);                                                                   \
+    name##_Counter_t linear = MIN(count, (name##_Counter_t)(RING_BUFFER_DEFINE_SIZE(capacity) - location));             \
+                                                                                                                        \
+    RingBuffer_xCopy(items, &ring_buffer->data[location], linear, sizeof(name##_Item_t), (capacity)); \
+                                                                                                                        \
+    if(count > linear)                                                                                                  \
+    {                                                                                                                   \
+        /*  bounded by @p count (same value), the compiler keeps the range of the copy  */                              \
+        RingBuffer_xCopy(&items[linear], ring_buffer->data, MIN((size_t)(count - linear), (size_t)count), sizeof(name##_Item_t), (capacity)); \
+    }                                                                                                                   \
+}                                                                                                                       \
+                                                                                                                        \
+/*  copy @p count items from @p items to pointer @p index, in at most two blocks  */                                    \
+static inline void name##_xCopyIn(name##_t * const ring_buffer, name##_Counter_t index, name##_Item_t const * const items, name##_Counter_t count) \
+{                                                                                                                       \
+    name##_Counter_t location = name##_xIndex(index);                                                                   \
+    name##_Counter_t linear = MIN(count, (name##_Counter_t)(RING_BUFFER_DEFINE_SIZE(capacity) - location));             \
+                                                                                                                        \
+    RingBuffer_xCopy(&ring_buffer->data[location], items, linear, sizeof(name##_Item_t), (capacity)); \
+                                                                                                                        \
+    if(count > linear)                                                                                                  \
+    {                                                                                                                   \
+        /*  bounded by @p count (same value), the compiler keeps the range of the copy  */                              \
+        RingBuffer_xCopy(ring_buffer->data, &items[linear], MIN((size_t)(count - linear), (size_t)count), sizeof(name##_Item_t), (capacity)); \
+    }                                                                                                                   \
+}                                                                                                                       \
+                                                                                                                        \
+/*  initialize (empty) ring buffer  */                                                                                  \
+static inline RingBuffer_Error_t name##_enInit(name##_t * const ring_buffer)                                            \
+{                                                                                                                       \
+    RING_BUFFER_DEFINE_CHECK_NULLPTR(ring_buffer);                                                                      \
+                                                                                                                        \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->head, 0);                                                             \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->tail, 0);                                                             \
+                                                                                                                        \
+    return RING_BUFFER_ERROR_NONE;                                                                                      \
+}                                                                                                                       \
+                                                                                                                        \
+/*  number of items (consumer or producer)  */                                                                          \
+static inline name##_Counter_t name##_uItemCount(name##_t * const ring_buffer)                                          \
+{                                                                                                                       \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->tail);                                         \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->head);                                         \
+                                                                                                                        \
+    return name##_xItemCount(head, tail);                                                                               \
+}                                                                                                                       \
+                                                                                                                        \
+/*  number of free locations (consumer or producer)  */                                                                 \
+static inline name##_Counter_t name##_uFreeCount(name##_t * const ring_buffer)                                          \
+{                                                                                                                       \
+    return (name##_Counter_t)((capacity) - name##_uItemCount(ring_buffer));                                             \
+}                                                                                                                       \
+                                                                                                                        \
+/*  put an item (producer), returns 1, or 0 when full  */                                                               \
+static inline name##_Counter_t name##_uPutItem(name##_t * const ring_buffer, name##_Item_t const * const item)          \
+{                                                                                                                       \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->tail);                                             \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->head);                                         \
+                                                                                                                        \
+    if(name##_xItemCount(head, tail) == (capacity))                                                                     \
+    {                                                                                                                   \
+        return 0;                                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    memcpy(&ring_buffer->data[name##_xIndex(tail)], item, sizeof(name##_Item_t));                                       \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->tail, name##_xWrap(tail, 1));                                         \
+                                                                                                                        \
+    return 1;                                                                                                           \
+}                                                                                                                       \
+                                                                                                                        \
+/*  get an item (consumer), returns 1, or 0 when empty  */                                                              \
+static inline name##_Counter_t name##_uGetItem(name##_t * const ring_buffer, name##_Item_t * const item)                \
+{                                                                                                                       \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->head);                                             \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->tail);                                         \
+                                                                                                                        \
+    if(head == tail)                                                                                                    \
+    {                                                                                                                   \
+        return 0;                                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    memcpy(item, &ring_buffer->data[name##_xIndex(head)], sizeof(name##_Item_t));                                       \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->head, name##_xWrap(head, 1));                                         \
+                                                                                                                        \
+    return 1;                                                                                                           \
+}                                                                                                                       \
+                                                                                                                        \
+/*  put up to @p len items (producer), returns number of items put  */                                                  \
+static inline name##_Counter_t name##_uPutItems(name##_t * const ring_buffer, name##_Item_t const * const items, name##_Counter_t len) \
+{                                                                                                                       \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->tail);                                             \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->head);                                         \
+    name##_Counter_t count = MIN(len, (name##_Counter_t)((capacity) - name##_xItemCount(head, tail)));                  \
+                                                                                                                        \
+    name##_xCopyIn(ring_buffer, tail, items, count);                                                                    \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->tail, name##_xWrap(tail, count));                                     \
+                                                                                                                        \
+    return count;                                                                                                       \
+}                                                                                                                       \
+                                                                                                                        \
+/*  get up to @p len items (consumer), returns number of items taken  */                                                \
+static inline name##_Counter_t name##_uGetItems(name##_t * const ring_buffer, name##_Item_t * const items, name##_Counter_t len) \
+{                                                                                                                       \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->head);                                             \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->tail);                                         \
+    name##_Counter_t count = MIN(len, name##_xItemCount(head, tail));                                                   \
+                                                                                                                        \
+    name##_xCopyOut(ring_buffer, head, items, count);                                                                   \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->head, name##_xWrap(head, count));                                     \
+                                                                                                                        \
+    return count;                                                                                                       \
+}                                                                                                                       \
+                                                                                                                        \
+/*  read up to @p len items @p offset items after the oldest item, without removing them (consumer), returns number of items read  */ \
+static inline name##_Counter_t name##_uPeekItems(name##_t * const ring_buffer, name##_Item_t * const items, name##_Counter_t len, name##_Counter_t offset) \
+{                                                                                                                       \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->head);                                             \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->tail);                                         \
+    name##_Counter_t available = name##_xItemCount(head, tail);                                                         \
+    name##_Counter_t count;                                                                                             \
+                                                                                                                        \
+    if(offset >= available)                                                                                             \
+    {                                                                                                                   \
+        return 0;                                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    count = MIN(len, (name##_Counter_t)(available - offset));                                                           \
+    name##_xCopyOut(ring_buffer, name##_xWrap(head, offset), items, count);                                             \
+                                                                                                                        \
+    return count;                                                                                                       \
+}                                                                                                                       \
+                                                                                                                        \
+/*  remove up to @p skip_count oldest items (consumer), returns number of items removed  */                             \
+static inline name##_Counter_t name##_uSkipItems(name##_t * const ring_buffer, name##_Counter_t skip_count)             \
+{                                                                                                                       \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->head);                                             \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->tail);                                         \
+    name##_Counter_t count = MIN(skip_count, name##_xItemCount(head, tail));                                            \
+                                                                                                                        \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->head, name##_xWrap(head, count));                                     \
+                                                                                                                        \
+    return count;                                                                                                       \
+}                                                                                                                       \
+                                                                                                                        \
+/*  advance tail (write) pointer by up to @p advance_count (producer), returns number of locations added  */            \
+static inline name##_Counter_t name##_uAdvance(name##_t * const ring_buffer, name##_Counter_t advance_count)            \
+{                                                                                                                       \
+    name##_Counter_t tail = RING_BUFFER_DEFINE_LOAD_OWN(ring_buffer->tail);                                             \
+    name##_Counter_t head = RING_BUFFER_DEFINE_LOAD_ACQUIRE(ring_buffer->head);                                         \
+    name##_Counter_t count = MIN(advance_count, (name##_Counter_t)((capacity) - name##_xItemCount(head, tail)));        \
+                                                                                                                        \
+    RING_BUFFER_DEFINE_STORE_RELEASE(ring_buffer->tail, name##_xWrap(tail, count));                                     \
+                                                                                                                        \
+    return count;                                                                                                       \
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_DEFINE_H__ */
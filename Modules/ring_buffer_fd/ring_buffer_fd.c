@@ -0,0 +1,296 @@
+/******************************************************************************
+ * @file      ring_buffer_fd.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_fd/ring_buffer_fd.h"
+
+#if RING_BUFFER_FD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Build `iovec`s for ring buffer spans @p first and @p second
+ *
+ * @return number of `iovec`s (1 or 2)
+ */
+static inline int RingBuffer_xIovec(struct iovec * const iov, RingBuffer_Span_t const * const first, RingBuffer_Span_t const * const second)
+{
+    iov[0].iov_base = first->data;
+    iov[0].iov_len = (size_t)first->count * sizeof(RingBuffer_Item_t);
+    iov[1].iov_base = second->data;
+    iov[1].iov_len = (size_t)second->count * sizeof(RingBuffer_Item_t);
+
+    return IS_ZERO(second->count) ? 1 : 2;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get address of byte @p offset in ring buffer spans @p first and @p second
+ *
+ * @note Items never straddle spans, so the rest of an item at @p offset is contiguous
+ */
+static inline uint8_t * RingBuffer_xByteAddress(RingBuffer_Span_t const * const first, RingBuffer_Span_t const * const second, size_t offset)
+{
+    size_t first_bytes = (size_t)first->count * sizeof(RingBuffer_Item_t);
+
+    if(offset < first_bytes)
+    {
+        return &((uint8_t *)first->data)[offset];
+    }
+
+    return &((uint8_t *)second->data)[offset - first_bytes];
+}
+
+/* ------------------------------------------------------------------------- */
+
+#ifdef DEBUG_RING_BUFFER
+
+/**
+ * @brief Check @p fd can transfer items of ring buffer item type (debug builds)
+ *
+ * A non blocking @p fd can end a transfer in the middle of a multi byte item, with no way to resume it
+ * on the next call (the rest of the item would be lost or sent twice), so it's only accepted for single byte items.
+ *
+ * @return #RING_BUFFER_ERROR_NONE, #RING_BUFFER_ERROR_INVALID_PARAM for a non blocking @p fd,
+ *         or #RING_BUFFER_ERROR_SYSTEM when @p fd flags can't be read
+ */
+static inline RingBuffer_Error_t RingBuffer_xCheckFd(int fd)
+{
+    int flags;
+
+    if(sizeof(RingBuffer_Item_t) == 1)
+    {
+        return RING_BUFFER_ERROR_NONE;
+    }
+
+    flags = fcntl(fd, F_GETFL);
+
+    if(flags < 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    return (flags & O_NONBLOCK) ? RING_BUFFER_ERROR_INVALID_PARAM : RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Transfer the rest of an item (@p remaining bytes @ @p address), when a system call ended in the middle of it
+ *
+ * @return 0 when the item is complete, 1 at end of file, -1 on failure (`errno` holds the reason)
+ */
+static int RingBuffer_xCompleteItem(int fd, uint8_t * address, size_t remaining, uint8_t is_write)
+{
+    ssize_t transferred;
+
+    while(remaining)
+    {
+        transferred = is_write ? write(fd, address, remaining) : read(fd, address, remaining);
+
+        if(transferred < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        if(IS_ZERO(transferred))
+        {
+            return 1;
+        }
+
+        address += transferred;
+        remaining -= (size_t)transferred;
+    }
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enReadFromFd(RingBuffer_t * const ring_buffer, int fd, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t reserved;
+    struct iovec iov [2];
+    ssize_t bytes;
+    size_t partial;
+    int iov_count;
+#ifdef DEBUG_RING_BUFFER
+    RingBuffer_Error_t error;
+#endif /*  DEBUG_RING_BUFFER  */
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    error = RingBuffer_xCheckFd(fd);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        (*item_count) = 0;
+        return error;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*item_count) = 0;
+
+    /*  free locations, errors other than full are expected (less free locations than len)  */
+    (void)RingBuffer_enReserve(ring_buffer, len, &first, &second, &reserved);
+
+    if(IS_ZERO(reserved))
+    {
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    iov_count = RingBuffer_xIovec(iov, &first, &second);
+
+    do
+    {
+        bytes = readv(fd, iov, iov_count);
+    } while((bytes < 0) && (errno == EINTR));
+
+    if(bytes < 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    partial = (size_t)bytes % sizeof(RingBuffer_Item_t);
+
+    if(partial)
+    {
+        int completed = RingBuffer_xCompleteItem(fd, RingBuffer_xByteAddress(&first, &second, (size_t)bytes), sizeof(RingBuffer_Item_t) - partial, 0);
+
+        /*  a partial item at end of file is dropped  */
+        if(completed == 0)
+        {
+            bytes += (ssize_t)(sizeof(RingBuffer_Item_t) - partial);
+        }
+        else if(completed < 0)
+        {
+            (*item_count) = (RingBuffer_Counter_t)((size_t)bytes / sizeof(RingBuffer_Item_t));
+            (void)RingBuffer_enCommit(ring_buffer, (*item_count));
+            return RING_BUFFER_ERROR_SYSTEM;
+        }
+    }
+
+    (*item_count) = (RingBuffer_Counter_t)((size_t)bytes / sizeof(RingBuffer_Item_t));
+
+    return RingBuffer_enCommit(ring_buffer, (*item_count));
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enWriteToFd(RingBuffer_t * const ring_buffer, int fd, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t acquired;
+    struct iovec iov [2];
+    ssize_t bytes;
+    size_t partial;
+    int iov_count;
+#ifdef DEBUG_RING_BUFFER
+    RingBuffer_Error_t error;
+#endif /*  DEBUG_RING_BUFFER  */
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    error = RingBuffer_xCheckFd(fd);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        (*item_count) = 0;
+        return error;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*item_count) = 0;
+
+    /*  readable items, errors other than empty are expected (less items than len)  */
+    (void)RingBuffer_enAcquire(ring_buffer, len, &first, &second, &acquired);
+
+    if(IS_ZERO(acquired))
+    {
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    iov_count = RingBuffer_xIovec(iov, &first, &second);
+
+    do
+    {
+        bytes = writev(fd, iov, iov_count);
+    } while((bytes < 0) && (errno == EINTR));
+
+    if(bytes < 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    partial = (size_t)bytes % sizeof(RingBuffer_Item_t);
+
+    if(partial)
+    {
+        if(RingBuffer_xCompleteItem(fd, RingBuffer_xByteAddress(&first, &second, (size_t)bytes), sizeof(RingBuffer_Item_t) - partial, 1) != 0)
+        {
+            (*item_count) = (RingBuffer_Counter_t)((size_t)bytes / sizeof(RingBuffer_Item_t));
+            (void)RingBuffer_enRelease(ring_buffer, (*item_count));
+            return RING_BUFFER_ERROR_SYSTEM;
+        }
+
+        bytes += (ssize_t)(sizeof(RingBuffer_Item_t) - partial);
+    }
+
+    (*item_count) = (RingBuffer_Counter_t)((size_t)bytes / sizeof(RingBuffer_Item_t));
+
+    return RingBuffer_enRelease(ring_buffer, (*item_count));
+}
+
+#endif /*  RING_BUFFER_FD  */
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * @file      ring_buffer_fd.h
+ * @brief     Ring buffer file descriptor ingest/drain (POSIX), using scatter/gather I/O.
+ *
+ * @details   Items are transferred between a ring buffer (#RingBuffer_t) and a file descriptor
+ *            (pipe, file, socket...) in place, without intermediate copies:
+ *              - RingBuffer_enReadFromFd() reads into the free locations of the ring buffer
+ *              using `readv`, with one `iovec` per free span (two when free locations wrap)
+ *              - RingBuffer_enWriteToFd() writes the items of the ring buffer using `writev`,
+ *              with one `iovec` per readable span
+ *
+ *            So a single system call fills or drains the ring buffer, across the end of ring buffer data.
+ *            The producer side (read from fd) and the consumer side (write to fd) follow the usual SPSC rules.
+ *
+ * @note      Non blocking file descriptors are only supported for single byte items (`uint8_t`, the default item type):
+ *            a multi byte item cut by a transfer can't be resumed on the next call. Debug builds reject such file descriptors.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_FD_H__
+#define __RING_BUFFER_FD_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferFd Ring buffer file descriptor I/O (POSIX)
+ * @brief Ring buffer file descriptor ingest/drain using `readv`/`writev`
+ * @{
+ * */
+
+/**
+ * @brief Ring buffer file descriptor I/O is available, it needs POSIX `readv`/`writev`
+ * */
+#if defined(__unix__) || defined(__APPLE__)
+#define RING_BUFFER_FD                  1
+#else
+#define RING_BUFFER_FD                  0
+#endif /*  __unix__ || __APPLE__  */
+
+#if RING_BUFFER_FD
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Read up to @p len items from file descriptor @p fd into ring buffer (producer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] fd           : file descriptor to read from
+ * @param [in] len          : maximum number of items to read
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items read
+ *
+ * @note Items are read directly into ring buffer data (a single `readv` call, retried when interrupted).
+ *       When the call ends in the middle of an item, the rest of the item is read before returning,
+ *       an item cut by end of file or by a failure is dropped.
+ *
+ * @pre @p ring_buffer is initialized
+ * @pre @p fd is blocking when items are larger than a byte (checked in debug builds only)
+ *
+ * @post @p item_count items are added to @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error, @p item_count is 0 at end of file
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0, or @p fd is non blocking and items are larger than a byte (debug builds)
+ *         - #RING_BUFFER_ERROR_FULL            : @p ring_buffer is full, @p fd is not read
+ *         - #RING_BUFFER_ERROR_SYSTEM          : `readv` failed (`errno` holds the reason, `EAGAIN` for a non blocking @p fd without data),
+ *                                                @p item_count items were read before the failure
+ *
+ */
+RingBuffer_Error_t RingBuffer_enReadFromFd(RingBuffer_t * const ring_buffer, int fd, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count);
+
+
+/** @brief Write up to @p len items from ring buffer to file descriptor @p fd (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] fd           : file descriptor to write to
+ * @param [in] len          : maximum number of items to write
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items written
+ *
+ * @note Items are written directly from ring buffer data (a single `writev` call, retried when interrupted).
+ *       When the call ends in the middle of an item, the rest of the item is written before returning,
+ *       after a failure in the middle of an item the stream can't be resumed (the item is kept in @p ring_buffer).
+ *
+ * @pre @p ring_buffer is initialized
+ * @pre @p fd is blocking when items are larger than a byte (checked in debug builds only)
+ *
+ * @post @p item_count items are removed from @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0, or @p fd is non blocking and items are larger than a byte (debug builds)
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty, nothing is written to @p fd
+ *         - #RING_BUFFER_ERROR_SYSTEM          : `writev` failed (`errno` holds the reason, `EAGAIN` for a non blocking @p fd that can't take data),
+ *                                                @p item_count items were written before the failure
+ *
+ */
+RingBuffer_Error_t RingBuffer_enWriteToFd(RingBuffer_t * const ring_buffer, int fd, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count);
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  RING_BUFFER_FD  */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_FD_H__ */
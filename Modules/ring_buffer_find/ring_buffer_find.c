@@ -0,0 +1,468 @@
+/******************************************************************************
+ * @file      ring_buffer_find.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_find/ring_buffer_find.h"
+
+/* ---------------------------------------------------------------------------
+ *
+ * Search:
+ * - readable items are acquired as two spans (up to the end of ring buffer data, then from its start)
+ * - each span is searched with vector compares: a vector of items is compared to the item
+ *   to find, the compare result is turned into a bit mask, its lowest set bit is the first match
+ * - patterns compare two vectors: items at the candidate start against the first pattern item,
+ *   and items `len - 1` further against the last pattern item, only starts matching both are
+ *   compared in full (so a pattern is rarely compared item by item)
+ * - pattern starts in the last `len - 1` items of the first span straddle the end of ring buffer
+ *   data, they are compared in two parts
+ *
+ * ------------------------------------------------------------------------- */
+
+#if (RING_BUFFER_FIND_VECTOR_SIZE == 32)
+
+#include <immintrin.h>
+
+typedef __m256i RingBuffer_Vector_t;
+
+/**
+ * @brief Bits of a match mask per matching byte
+ */
+#define RING_BUFFER_FIND_MASK_BITS      1
+
+#elif (RING_BUFFER_FIND_VECTOR_SIZE == 16) && defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+typedef uint8x16_t RingBuffer_Vector_t;
+
+/**
+ * @brief Bits of a match mask per matching byte, NEON doesn't have a byte mask instruction,
+ *        compare results are narrowed to 4 bits per byte instead
+ */
+#define RING_BUFFER_FIND_MASK_BITS      4
+
+#elif (RING_BUFFER_FIND_VECTOR_SIZE == 16)
+
+#include <emmintrin.h>
+
+typedef __m128i RingBuffer_Vector_t;
+
+/**
+ * @brief Bits of a match mask per matching byte
+ */
+#define RING_BUFFER_FIND_MASK_BITS      1
+
+#elif (RING_BUFFER_FIND_VECTOR_SIZE != 0)
+#error "RING_BUFFER_FIND_VECTOR_SIZE must be 0, 16 or 32"
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+
+#if RING_BUFFER_FIND_VECTOR_SIZE
+
+/**
+ * @brief Number of items in a vector
+ */
+#define RING_BUFFER_FIND_VECTOR_ITEMS   ((RingBuffer_Counter_t)(RING_BUFFER_FIND_VECTOR_SIZE / sizeof(RingBuffer_Item_t)))
+
+/**
+ * @brief Bits of a match mask per matching item
+ */
+#define RING_BUFFER_FIND_ITEM_BITS      ((uint32_t)(RING_BUFFER_FIND_MASK_BITS * sizeof(RingBuffer_Item_t)))
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Check whether items are compared using vectors, vector compares have lanes of 1, 2 or 4 bytes
+ */
+static inline uint8_t RingBuffer_xVectorItems(void)
+{
+    return (sizeof(RingBuffer_Item_t) == 1) || (sizeof(RingBuffer_Item_t) == 2) || (sizeof(RingBuffer_Item_t) == 4);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a vector with all its lanes set to @p item
+ */
+static inline RingBuffer_Vector_t RingBuffer_xSplat(RingBuffer_Item_t const * const item)
+{
+    uint8_t value_8 = 0;
+    uint16_t value_16 = 0;
+    uint32_t value_32 = 0;
+
+    /*  only the copy of the item size is used, others keep the compiler from reading past the item  */
+    memcpy(&value_8, item, MIN(sizeof(value_8), sizeof(RingBuffer_Item_t)));
+    memcpy(&value_16, item, MIN(sizeof(value_16), sizeof(RingBuffer_Item_t)));
+    memcpy(&value_32, item, MIN(sizeof(value_32), sizeof(RingBuffer_Item_t)));
+
+#if (RING_BUFFER_FIND_VECTOR_SIZE == 32)
+
+    switch(sizeof(RingBuffer_Item_t))
+    {
+        case 1  : return _mm256_set1_epi8((char)value_8);
+        case 2  : return _mm256_set1_epi16((short)value_16);
+        default : return _mm256_set1_epi32((int)value_32);
+    }
+
+#elif defined(__ARM_NEON)
+
+    switch(sizeof(RingBuffer_Item_t))
+    {
+        case 1  : return vdupq_n_u8(value_8);
+        case 2  : return vreinterpretq_u8_u16(vdupq_n_u16(value_16));
+        default : return vreinterpretq_u8_u32(vdupq_n_u32(value_32));
+    }
+
+#else
+
+    switch(sizeof(RingBuffer_Item_t))
+    {
+        case 1  : return _mm_set1_epi8((char)value_8);
+        case 2  : return _mm_set1_epi16((short)value_16);
+        default : return _mm_set1_epi32((int)value_32);
+    }
+
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Compare a vector of items @ @p items to @p needle (unaligned load)
+ *
+ * @return match mask, #RING_BUFFER_FIND_ITEM_BITS bits per item, set for equal items
+ */
+static inline uint64_t RingBuffer_xMatch(RingBuffer_Item_t const * const items, RingBuffer_Vector_t needle)
+{
+#if (RING_BUFFER_FIND_VECTOR_SIZE == 32)
+
+    __m256i block = _mm256_loadu_si256((__m256i const *)(void const *)items);
+    __m256i equal;
+
+    switch(sizeof(RingBuffer_Item_t))
+    {
+        case 1  : equal = _mm256_cmpeq_epi8(block, needle);     break;
+        case 2  : equal = _mm256_cmpeq_epi16(block, needle);    break;
+        default : equal = _mm256_cmpeq_epi32(block, needle);    break;
+    }
+
+    return (uint64_t)(uint32_t)_mm256_movemask_epi8(equal);
+
+#elif defined(__ARM_NEON)
+
+    uint8x16_t block = vld1q_u8((uint8_t const *)(void const *)items);
+    uint8x16_t equal;
+
+    switch(sizeof(RingBuffer_Item_t))
+    {
+        case 1  : equal = vceqq_u8(block, needle);                                                                      break;
+        case 2  : equal = vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(block), vreinterpretq_u16_u8(needle)));  break;
+        default : equal = vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(block), vreinterpretq_u32_u8(needle)));  break;
+    }
+
+    /*  keep 4 bits of each byte compare result  */
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+
+#else
+
+    __m128i block = _mm_loadu_si128((__m128i const *)(void const *)items);
+    __m128i equal;
+
+    switch(sizeof(RingBuffer_Item_t))
+    {
+        case 1  : equal = _mm_cmpeq_epi8(block, needle);    break;
+        case 2  : equal = _mm_cmpeq_epi16(block, needle);   break;
+        default : equal = _mm_cmpeq_epi32(block, needle);   break;
+    }
+
+    return (uint64_t)(uint32_t)_mm_movemask_epi8(equal);
+
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get index of the first matching item of match mask @p mask (not 0)
+ */
+static inline RingBuffer_Counter_t RingBuffer_xFirstMatch(uint64_t mask)
+{
+    return (RingBuffer_Counter_t)((uint32_t)__builtin_ctzll(mask) / RING_BUFFER_FIND_ITEM_BITS);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Clear the bits of item @p index, and of the items before it, from match mask @p mask
+ */
+static inline uint64_t RingBuffer_xClearMatch(uint64_t mask, RingBuffer_Counter_t index)
+{
+    uint32_t next = ((uint32_t)index + 1) * RING_BUFFER_FIND_ITEM_BITS;
+
+    return (next < 64) ? (mask & (~(uint64_t)0 << next)) : 0;
+}
+
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Find the first item equal to @p item in @p count contiguous @p items
+ *
+ * @return index of the found item, @p count when not found
+ */
+static RingBuffer_Counter_t RingBuffer_xFindItem(RingBuffer_Item_t const * const items, RingBuffer_Counter_t count, RingBuffer_Item_t const * const item)
+{
+    RingBuffer_Counter_t index = 0;
+
+#if RING_BUFFER_FIND_VECTOR_SIZE
+
+    if(RingBuffer_xVectorItems())
+    {
+        RingBuffer_Vector_t needle = RingBuffer_xSplat(item);
+        uint64_t mask;
+
+        /*  4 vectors per check, the loop doesn't branch on each compare  */
+        for(; (RingBuffer_Counter_t)(count - index) >= (4 * RING_BUFFER_FIND_VECTOR_ITEMS); index += (4 * RING_BUFFER_FIND_VECTOR_ITEMS))
+        {
+            mask = RingBuffer_xMatch(&items[index], needle) |
+                   RingBuffer_xMatch(&items[index + RING_BUFFER_FIND_VECTOR_ITEMS], needle) |
+                   RingBuffer_xMatch(&items[index + (2 * RING_BUFFER_FIND_VECTOR_ITEMS)], needle) |
+                   RingBuffer_xMatch(&items[index + (3 * RING_BUFFER_FIND_VECTOR_ITEMS)], needle);
+
+            if(mask)
+            {
+                /*  found in one of the vectors, the loop below finds which  */
+                break;
+            }
+        }
+
+        for(; (RingBuffer_Counter_t)(count - index) >= RING_BUFFER_FIND_VECTOR_ITEMS; index += RING_BUFFER_FIND_VECTOR_ITEMS)
+        {
+            mask = RingBuffer_xMatch(&items[index], needle);
+
+            if(mask)
+            {
+                return (RingBuffer_Counter_t)(index + RingBuffer_xFirstMatch(mask));
+            }
+        }
+    }
+
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+
+    if(sizeof(RingBuffer_Item_t) == 1)
+    {
+        /*  byte items, the C library search is usually faster than a byte loop  */
+        uint8_t const * found = (uint8_t const *)memchr(&items[index], *(uint8_t const *)item, (size_t)(count - index));
+
+        return IS_NULLPTR(found) ? count : (RingBuffer_Counter_t)(found - (uint8_t const *)items);
+    }
+
+    for(; index < count; index++)
+    {
+        if(memcmp(&items[index], item, sizeof(RingBuffer_Item_t)) == 0)
+        {
+            return index;
+        }
+    }
+
+    return count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Find the first sequence of @p len (2 or more) items equal to @p pattern in @p count contiguous @p items
+ *
+ * @return index of the first item of the found pattern, @p count when not found
+ */
+static RingBuffer_Counter_t RingBuffer_xFindPattern(RingBuffer_Item_t const * const items, RingBuffer_Counter_t count,
+                                                    RingBuffer_Item_t const * const pattern, RingBuffer_Counter_t len)
+{
+    RingBuffer_Counter_t index = 0;
+    RingBuffer_Counter_t starts;
+
+    if(count < len)
+    {
+        return count;
+    }
+
+    /*  number of pattern starts in items  */
+    starts = (RingBuffer_Counter_t)(count - len + 1);
+
+#if RING_BUFFER_FIND_VECTOR_SIZE
+
+    if(RingBuffer_xVectorItems())
+    {
+        RingBuffer_Vector_t first = RingBuffer_xSplat(&pattern[0]);
+        RingBuffer_Vector_t last = RingBuffer_xSplat(&pattern[len - 1]);
+        RingBuffer_Counter_t match;
+        uint64_t mask;
+
+        /*  last items vector ends at most at the end of items  */
+        for(; (RingBuffer_Counter_t)(starts - index) >= RING_BUFFER_FIND_VECTOR_ITEMS; index += RING_BUFFER_FIND_VECTOR_ITEMS)
+        {
+            mask = RingBuffer_xMatch(&items[index], first) & RingBuffer_xMatch(&items[index + len - 1], last);
+
+            while(mask)
+            {
+                match = RingBuffer_xFirstMatch(mask);
+
+                /*  first and last items match, compare items between them  */
+                if(memcmp(&items[index + match + 1], &pattern[1], (size_t)(len - 2) * sizeof(RingBuffer_Item_t)) == 0)
+                {
+                    return (RingBuffer_Counter_t)(index + match);
+                }
+
+                mask = RingBuffer_xClearMatch(mask, match);
+            }
+        }
+    }
+
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+
+    /*  remaining starts: find the first pattern item, then compare the rest  */
+    while(index < starts)
+    {
+        index = (RingBuffer_Counter_t)(index + RingBuffer_xFindItem(&items[index], (RingBuffer_Counter_t)(starts - index), pattern));
+
+        if(index == starts)
+        {
+            break;
+        }
+
+        if(memcmp(&items[index + 1], &pattern[1], (size_t)(len - 1) * sizeof(RingBuffer_Item_t)) == 0)
+        {
+            return index;
+        }
+
+        index++;
+    }
+
+    return count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enFindItem(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const item, RingBuffer_Counter_t offset, RingBuffer_Counter_t * const position)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    return RingBuffer_enFindPattern(ring_buffer, item, 1, offset, position);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBuffer_enFindPattern(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const pattern, RingBuffer_Counter_t len,
+                                            RingBuffer_Counter_t offset, RingBuffer_Counter_t * const position)
+{
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t acquired;
+    RingBuffer_Counter_t start;
+    RingBuffer_Counter_t end;
+    RingBuffer_Counter_t found;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(pattern) || IS_NULLPTR(position))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*position) = offset;
+
+    /*  all readable items, errors other than empty are expected (less items than requested)  */
+    (void)RingBuffer_enAcquire(ring_buffer, (RingBuffer_Counter_t)~(RingBuffer_Counter_t)0, &first, &second, &acquired);
+
+    if(IS_ZERO(acquired))
+    {
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    if((offset >= acquired) || (len > (RingBuffer_Counter_t)(acquired - offset)))
+    {
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    /*  1 - patterns within the first span  */
+    if(offset < first.count)
+    {
+        end = (RingBuffer_Counter_t)(first.count - offset);
+        found = (len == 1) ? RingBuffer_xFindItem(&first.data[offset], end, pattern)
+                           : RingBuffer_xFindPattern(&first.data[offset], end, pattern, len);
+
+        if(found != end)
+        {
+            (*position) = (RingBuffer_Counter_t)(offset + found);
+            return RING_BUFFER_ERROR_NONE;
+        }
+    }
+
+    /*  2 - patterns straddling the end of ring buffer data, starting in the last len - 1 items of the first span  */
+    if(second.count && (len > 1))
+    {
+        start = (first.count > (RingBuffer_Counter_t)(len - 1)) ? (RingBuffer_Counter_t)(first.count - len + 1) : 0;
+        start = MAX(start, offset);
+        end = (RingBuffer_Counter_t)(acquired - len + 1);
+        end = MIN(end, first.count);
+
+        for(; start < end; start++)
+        {
+            RingBuffer_Counter_t first_count = (RingBuffer_Counter_t)(first.count - start);
+
+            if((memcmp(&first.data[start], pattern, (size_t)first_count * sizeof(RingBuffer_Item_t)) == 0) &&
+               (memcmp(second.data, &pattern[first_count], (size_t)(len - first_count) * sizeof(RingBuffer_Item_t)) == 0))
+            {
+                (*position) = start;
+                return RING_BUFFER_ERROR_NONE;
+            }
+        }
+    }
+
+    /*  3 - patterns within the second span  */
+    if(second.count)
+    {
+        start = (offset > first.count) ? (RingBuffer_Counter_t)(offset - first.count) : 0;
+        end = (RingBuffer_Counter_t)(second.count - start);
+        found = (len == 1) ? RingBuffer_xFindItem(&second.data[start], end, pattern)
+                           : RingBuffer_xFindPattern(&second.data[start], end, pattern, len);
+
+        if(found != end)
+        {
+            (*position) = (RingBuffer_Counter_t)(first.count + start + found);
+            return RING_BUFFER_ERROR_NONE;
+        }
+    }
+
+    /*  not found, a pattern can still start in the last len - 1 items  */
+    (*position) = (RingBuffer_Counter_t)(acquired - len + 1);
+
+    return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+}
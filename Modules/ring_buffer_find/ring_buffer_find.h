@@ -0,0 +1,115 @@
+/******************************************************************************
+ * @file      ring_buffer_find.h
+ * @brief     Ring buffer item and pattern search, in place over the readable items,
+ *            using SIMD compares (SSE2, AVX2 or NEON) with a scalar fallback.
+ *
+ * @details   Items are searched where they are stored, without peeking them into a scratch array:
+ *              - RingBuffer_enFindItem() finds the first item equal to an item (a delimiter, `\n`)
+ *              - RingBuffer_enFindPattern() finds the first sequence of items equal to a pattern
+ *              (a sync word), including patterns that straddle the end of ring buffer data
+ *
+ *            Offsets are relative to the oldest item (ring buffer head), so a found item or pattern
+ *            can be peeked, acquired or skipped right away. Searching doesn't remove items,
+ *            it's done by the consumer side.
+ *
+ *            Items are compared byte by byte (like `memcmp`). Vector compares are used for items of
+ *            1, 2 or 4 bytes, larger items are compared one by one.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_FIND_H__
+#define __RING_BUFFER_FIND_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferFind Ring buffer item and pattern search
+ * @brief Ring buffer in place item and pattern search, using SIMD compares
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------- Configuration Macros ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Size in bytes of vectors compared at once, 0 compares items one by one
+ *
+ * @note Defaults to the widest vectors enabled by compiler flags: 32 with AVX2 (`-mavx2`),
+ *       16 with SSE2 (x86-64) or NEON (AArch64), 0 otherwise.
+ *       Can be set during build to use the scalar search: `-DRING_BUFFER_FIND_VECTOR_SIZE=0`
+ * */
+#ifndef RING_BUFFER_FIND_VECTOR_SIZE
+#if defined(__AVX2__)
+#define RING_BUFFER_FIND_VECTOR_SIZE    32
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+#define RING_BUFFER_FIND_VECTOR_SIZE    16
+#else
+#define RING_BUFFER_FIND_VECTOR_SIZE    0
+#endif /*  __AVX2__  */
+#endif /*  RING_BUFFER_FIND_VECTOR_SIZE  */
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Find the first item equal to @p item, at or after @p offset items from the oldest item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] item         : pointer to item to find
+ * @param [in] offset       : number of oldest items to skip before searching
+ * @param [out] position    : pointer to ring buffer counter variable to store the offset of the found item, from the oldest item.
+ *                            When @p item isn't found, the offset to search again from once more items are added
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error, @p item is found at @p position
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer, @p item or @p position is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY               : @p ring_buffer is empty
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : @p item isn't found in the items after @p offset
+ *
+ */
+RingBuffer_Error_t RingBuffer_enFindItem(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const item, RingBuffer_Counter_t offset, RingBuffer_Counter_t * const position);
+
+
+/** @brief Find the first sequence of @p len items equal to @p pattern, starting at or after @p offset items from the oldest item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] pattern      : pointer to an array of items to find
+ * @param [in] len          : number of items in @p pattern
+ * @param [in] offset       : number of oldest items to skip before searching
+ * @param [out] position    : pointer to ring buffer counter variable to store the offset of the first item of the found pattern, from the oldest item.
+ *                            When @p pattern isn't found, the offset to search again from once more items are added
+ *                            (a pattern can start in the last `len - 1` items)
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error, @p pattern is found at @p position
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer, @p pattern or @p position is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0
+ *         - #RING_BUFFER_ERROR_EMPTY               : @p ring_buffer is empty
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : @p pattern isn't found in the items after @p offset
+ *
+ */
+RingBuffer_Error_t RingBuffer_enFindPattern(RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const pattern, RingBuffer_Counter_t len,
+                                            RingBuffer_Counter_t offset, RingBuffer_Counter_t * const position);
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_FIND_H__ */
@@ -0,0 +1,309 @@
+/******************************************************************************
+ * @file      ring_buffer_lossy.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
+#include "ring_buffer_lossy/ring_buffer_lossy.h"
+
+#if RING_BUFFER_LOSSY
+
+/* ---------------------------------------------------------------------------
+ *
+ * Lossy ring buffer pointers (free running):
+ * - tail   : items in [tail - size, tail) are in ring buffer data, published with release ordering
+ * - write  : the producer stores write = tail + len before writing len items, so locations of items
+ *            before `write - size` may be being overwritten
+ * - head   : consumer's sequence number, items in [head, tail - size) were overwritten (lost)
+ *
+ * The consumer copies items, then checks them against write (sequence lock):
+ * - producer: store write (relaxed), release fence, write items, store tail (release)
+ * - consumer: load tail (acquire), copy items, acquire fence, load write (relaxed)
+ * Copied items before `write - size` may be torn, so they're dropped and counted as lost.
+ *
+ * The consumer must get items before the producer laps it by more than #RingBuffer_Counter_t range.
+ *
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Load lossy ring buffer pointer, with relaxed ordering.
+ */
+static inline RingBuffer_Counter_t RingBufferLossy_xLoadRelaxed(RingBuffer_SharedCounter_t const * const counter)
+{
+    return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Announce the locations the producer is about to overwrite, before writing them.
+ */
+static inline void RingBufferLossy_xAnnounce(RingBufferLossy_t * const ring_buffer, RingBuffer_Counter_t write)
+{
+    atomic_store_explicit(&ring_buffer->write, write, memory_order_relaxed);
+
+    /*  items writes can't move before write pointer store  */
+    atomic_thread_fence(memory_order_release);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Publish written items, with release ordering.
+ */
+static inline void RingBufferLossy_xPublish(RingBufferLossy_t * const ring_buffer, RingBuffer_Counter_t tail)
+{
+    atomic_store_explicit(&ring_buffer->tail, tail, memory_order_release);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get the producer's write pointer after copying items.
+ */
+static inline RingBuffer_Counter_t RingBufferLossy_xValidate(RingBufferLossy_t * const ring_buffer)
+{
+    /*  items reads can't move after write pointer load  */
+    atomic_thread_fence(memory_order_acquire);
+
+    return RingBufferLossy_xLoadRelaxed(&ring_buffer->write);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Copy @p count items starting at sequence number @p head into @p items
+ */
+static inline void RingBufferLossy_xCopy(RingBufferLossy_t const * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t head, RingBuffer_Counter_t count)
+{
+    RingBuffer_Counter_t index = head & (ring_buffer->size - 1);
+    RingBuffer_Counter_t first = MIN(count, (RingBuffer_Counter_t)(ring_buffer->size - index));
+
+    memcpy(items, &ring_buffer->data[index], first * sizeof(RingBuffer_Item_t));
+
+    if(count > first)
+    {
+        memcpy(&items[first], ring_buffer->data, (count - first) * sizeof(RingBuffer_Item_t));
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferLossy_enInit(RingBufferLossy_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if((size < 2) || (size & (size - 1)))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    ring_buffer->data = (RingBuffer_Item_t * const)data;
+    ring_buffer->size = size;
+    ring_buffer->head = 0;
+    RingBufferLossy_xAnnounce(ring_buffer, 0);
+    RingBufferLossy_xPublish(ring_buffer, 0);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferLossy_enPutItem(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t const * const item)
+{
+    RingBuffer_Counter_t tail;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    tail = RingBufferLossy_xLoadRelaxed(&ring_buffer->tail);
+
+    RingBufferLossy_xAnnounce(ring_buffer, (RingBuffer_Counter_t)(tail + 1));
+
+    memcpy(&ring_buffer->data[tail & (ring_buffer->size - 1)], item, sizeof(RingBuffer_Item_t));
+
+    RingBufferLossy_xPublish(ring_buffer, (RingBuffer_Counter_t)(tail + 1));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferLossy_enPutItems(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len)
+{
+    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t skipped;
+    RingBuffer_Counter_t index;
+    RingBuffer_Counter_t count;
+    RingBuffer_Counter_t first;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(items))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    tail = RingBufferLossy_xLoadRelaxed(&ring_buffer->tail);
+
+    /*  only the last size items can be in ring buffer data  */
+    skipped = (len > ring_buffer->size) ? (RingBuffer_Counter_t)(len - ring_buffer->size) : 0;
+    count = (RingBuffer_Counter_t)(len - skipped);
+    index = (RingBuffer_Counter_t)(tail + skipped) & (ring_buffer->size - 1);
+    first = MIN(count, (RingBuffer_Counter_t)(ring_buffer->size - index));
+
+    RingBufferLossy_xAnnounce(ring_buffer, (RingBuffer_Counter_t)(tail + len));
+
+    memcpy(&ring_buffer->data[index], &items[skipped], first * sizeof(RingBuffer_Item_t));
+
+    if(count > first)
+    {
+        memcpy(ring_buffer->data, &items[skipped + first], (count - first) * sizeof(RingBuffer_Item_t));
+    }
+
+    RingBufferLossy_xPublish(ring_buffer, (RingBuffer_Counter_t)(tail + len));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferLossy_enGetItem(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t * const item, RingBuffer_Counter_t * const lost)
+{
+    RingBuffer_Counter_t item_count;
+
+    return RingBufferLossy_enGetItems(ring_buffer, item, 1, &item_count, lost);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferLossy_enGetItems(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len,
+                                              RingBuffer_Counter_t * const item_count, RingBuffer_Counter_t * const lost)
+{
+    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t write;
+    RingBuffer_Counter_t next;
+    RingBuffer_Counter_t count;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(items) || IS_NULLPTR(item_count) || IS_NULLPTR(lost))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    head = ring_buffer->head;
+    (*lost) = 0;
+
+    for(;;)
+    {
+        tail = RingBuffer_xLoadAcquire(&ring_buffer->tail);
+
+        if(tail == head)
+        {
+            ring_buffer->head = head;
+            (*item_count) = 0;
+            return RING_BUFFER_ERROR_EMPTY;
+        }
+
+        /*  overwritten items  */
+        if((RingBuffer_Counter_t)(tail - head) > ring_buffer->size)
+        {
+            (*lost) += (RingBuffer_Counter_t)(tail - ring_buffer->size - head);
+            head = (RingBuffer_Counter_t)(tail - ring_buffer->size);
+        }
+
+        count = MIN(len, (RingBuffer_Counter_t)(tail - head));
+
+        RingBufferLossy_xCopy(ring_buffer, items, head, count);
+
+        write = RingBufferLossy_xValidate(ring_buffer);
+
+        /*  copied items are valid when the producer didn't start overwriting them  */
+        if((RingBuffer_Counter_t)(write - head) <= ring_buffer->size)
+        {
+            break;
+        }
+
+        /*  items up to write - size may be torn, copy newer items (published ones only)  */
+        next = (RingBuffer_Counter_t)(write - ring_buffer->size);
+
+        if((RingBuffer_Counter_t)(next - head) > (RingBuffer_Counter_t)(tail - head))
+        {
+            next = tail;
+        }
+
+        (*lost) += (RingBuffer_Counter_t)(next - head);
+        head = next;
+    }
+
+    ring_buffer->head = (RingBuffer_Counter_t)(head + count);
+    (*item_count) = count;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferLossy_enItemCount(RingBufferLossy_t * const ring_buffer, RingBuffer_Counter_t * const item_count, RingBuffer_Counter_t * const lost)
+{
+    RingBuffer_Counter_t used;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data) || IS_NULLPTR(item_count) || IS_NULLPTR(lost))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    used = (RingBuffer_Counter_t)(RingBuffer_xLoadAcquire(&ring_buffer->tail) - ring_buffer->head);
+
+    (*item_count) = MIN(used, ring_buffer->size);
+    (*lost) = (RingBuffer_Counter_t)(used - (*item_count));
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_LOSSY  */
@@ -0,0 +1,197 @@
+/******************************************************************************
+ * @file      ring_buffer_lossy.h
+ * @brief     A Lock free, SPSC (Single Producer Single Consumer),
+ *            overwrite oldest (lossy) ring buffer.
+ *
+ * @details   Lossy ring buffer is a ring buffer where the producer never waits for the consumer:
+ *              - Put functions always succeed, when the ring buffer is full the oldest items are overwritten
+ *              - The consumer gets the number of items it lost (overwritten before they were read)
+ *              with every get, items are sequence numbered by free running pointers, so a loss is a gap
+ *              - The consumer never returns an item that was being overwritten while it was copied (torn item):
+ *              the producer announces the locations it's about to overwrite before writing them, and the
+ *              consumer checks its copied items against it after copying them (sequence lock), torn items
+ *              are counted as lost
+ *
+ *            Intended for telemetry and debug logs, where the producer is a hot path and the newest items matter most.
+ *
+ * @note      Requires #RING_BUFFER_ATOMIC and #RING_BUFFER_FREE_RUNNING (power of 2 size),
+ *            the sequence lock needs acquire & release fences.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_LOSSY_H__
+#define __RING_BUFFER_LOSSY_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferLossy Lock free SPSC (Single Producer, Single Consumer) overwrite oldest ring buffer
+ * @brief Lock free SPSC (Single Producer, Single Consumer) overwrite oldest (lossy) ring buffer
+ * @details   The producer never stalls, the consumer detects lost items and never reads torn items.
+ * @{
+ * */
+
+/**
+ * @brief Lossy ring buffer is available, it needs atomic free running ring buffer pointers
+ * */
+#define RING_BUFFER_LOSSY               (RING_BUFFER_ATOMIC && RING_BUFFER_FREE_RUNNING)
+
+#if RING_BUFFER_LOSSY
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Lossy ring buffer structure
+ */
+typedef struct RingBufferLossy_t {
+    RingBuffer_Item_t * data;               /**<  pointer to ring buffer data  */
+    RingBuffer_Counter_t size;              /**<  size of ring buffer, maximum number of items ring buffer can hold  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  consumer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_Counter_t head;              /**<  consumer's read pointer, sequence number of the next item to read (private to the consumer)  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  producer cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t tail;        /**<  ring buffer tail pointer, items before it are published  */
+    RingBuffer_SharedCounter_t write;       /**<  producer's write pointer, items before it are published or being written  */
+} RingBufferLossy_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize lossy ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to lossy ring buffer object
+ * @param [in] data         : pointer to an array of items used for ring buffer's data storage
+ * @param [in] size         : size of ring buffer data, must be a power of 2 > 1
+ *
+ * @pre @p ring_buffer and @p data are not null
+ *
+ * @post @p ring_buffer instance is initialized, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p data is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1, or @p size is not a power of 2
+ *
+ */
+RingBuffer_Error_t RingBufferLossy_enInit(RingBufferLossy_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size);
+
+
+/** @brief Put an item into lossy ring buffer, overwriting the oldest item when it's full (producer)
+ *
+ * @param [in] ring_buffer  : pointer to lossy ring buffer object
+ * @param [in] item         : pointer to item to put
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *
+ */
+RingBuffer_Error_t RingBufferLossy_enPutItem(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t const * const item);
+
+
+/** @brief Put items into lossy ring buffer, overwriting the oldest items when it's full (producer)
+ *
+ * @param [in] ring_buffer  : pointer to lossy ring buffer object
+ * @param [in] items        : pointer to an array of items
+ * @param [in] len          : number of items to put
+ *
+ * @note When @p len is more than ring buffer size, only the last `size` items are written,
+ *       the others are lost right away.
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p items is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0
+ *
+ */
+RingBuffer_Error_t RingBufferLossy_enPutItems(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len);
+
+
+/** @brief Get the oldest item from lossy ring buffer (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to lossy ring buffer object
+ * @param [out] item        : pointer to item to copy the oldest item into
+ * @param [out] lost        : pointer to ring buffer counter variable to store number of items lost since the previous get
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p item or @p lost is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferLossy_enGetItem(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t * const item, RingBuffer_Counter_t * const lost);
+
+
+/** @brief Get up to @p len oldest items from lossy ring buffer (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to lossy ring buffer object
+ * @param [out] items       : pointer to an array of items to copy items into
+ * @param [in] len          : maximum number of items to get
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items copied
+ * @param [out] lost        : pointer to ring buffer counter variable to store number of items lost since the previous get
+ *
+ * @note Items are consecutive: the first item's sequence number is the previous get's last item sequence number + 1 + @p lost
+ *
+ * @note @p lost is also set when @p ring_buffer is empty, as items can be overwritten while they're copied
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p items, @p item_count or @p lost is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferLossy_enGetItems(RingBufferLossy_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len,
+                                              RingBuffer_Counter_t * const item_count, RingBuffer_Counter_t * const lost);
+
+
+/** @brief Get number of items in lossy ring buffer, and number of items lost since the previous get (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to lossy ring buffer object
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items
+ * @param [out] lost        : pointer to ring buffer counter variable to store number of items lost
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p item_count or @p lost is NULL, or @p ring_buffer was not initialized
+ *
+ */
+RingBuffer_Error_t RingBufferLossy_enItemCount(RingBufferLossy_t * const ring_buffer, RingBuffer_Counter_t * const item_count, RingBuffer_Counter_t * const lost);
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  RING_BUFFER_LOSSY  */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_LOSSY_H__ */
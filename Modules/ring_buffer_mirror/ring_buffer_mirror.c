@@ -0,0 +1,148 @@
+/******************************************************************************
+ * @file      ring_buffer_mirror.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE                     /*  memfd_create()  */
+#endif /*  __linux__  */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mirror/ring_buffer_mirror.h"
+
+#if RING_BUFFER_MIRROR && defined(__linux__)
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* ---------------------------------------------------------------------------
+ *
+ * Mirrored data layout:
+ * - a virtual address range of 2 * size items is reserved (PROT_NONE), so no other mapping can land in it
+ * - the shared memory file is mapped over both halves (MAP_FIXED | MAP_SHARED), so both halves are the same pages
+ * - the file descriptor is closed once mapped, the mappings keep the pages alive until they're unmapped
+ *
+ * ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMirror_enCreate(RingBuffer_t * ring_buffer, RingBuffer_Counter_t size)
+{
+    RingBuffer_Error_t error;
+    size_t bytes;
+    uint8_t * address;
+    void * mapping;
+    long page_size;
+    int fd;
+    int saved_errno;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    page_size = sysconf(_SC_PAGESIZE);
+    bytes = (size_t)size * sizeof(RingBuffer_Item_t);
+
+    if((page_size <= 0) || IS_ZERO(bytes) || (bytes % (size_t)page_size))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    fd = memfd_create("ring_buffer_mirror", MFD_CLOEXEC);
+
+    if(fd < 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    if(ftruncate(fd, (off_t)bytes) != 0)
+    {
+        saved_errno = errno;
+        (void)close(fd);
+        errno = saved_errno;
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    mapping = mmap(NULL, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if(mapping == MAP_FAILED)
+    {
+        saved_errno = errno;
+        (void)close(fd);
+        errno = saved_errno;
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    address = (uint8_t *)mapping;
+
+    if((mmap(address, bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_SHARED, fd, 0) == MAP_FAILED) ||
+       (mmap(&address[bytes], bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_SHARED, fd, 0) == MAP_FAILED))
+    {
+        saved_errno = errno;
+        (void)munmap(mapping, 2 * bytes);
+        (void)close(fd);
+        errno = saved_errno;
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    (void)close(fd);
+
+    error = RingBuffer_enInit(ring_buffer, (RingBuffer_Item_t *)mapping, size);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        (void)munmap(mapping, 2 * bytes);
+        return error;
+    }
+
+    ring_buffer->mirror = 1;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMirror_enDestroy(RingBuffer_t * ring_buffer)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    if(!ring_buffer->mirror)
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    if(munmap(ring_buffer->data, 2 * (size_t)ring_buffer->size * sizeof(RingBuffer_Item_t)) != 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    ring_buffer->data = NULL;
+    ring_buffer->size = 0;
+    ring_buffer->mirror = 0;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_MIRROR && __linux__  */
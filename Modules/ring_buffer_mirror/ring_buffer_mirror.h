@@ -0,0 +1,91 @@
+/******************************************************************************
+ * @file      ring_buffer_mirror.h
+ * @brief     Mirrored ring buffer data (Linux), ring buffer data mapped twice
+ *            back to back in virtual memory.
+ *
+ * @details   Mirrored ring buffer data is a shared memory file (`memfd_create`) of `size` items,
+ *            mapped twice, back to back. Location `size + i` is location `i`, so:
+ *              - Block read/write addresses are valid for all readable/free locations
+ *              (RingBuffer_enBlockReadCount(), RingBuffer_enBlockWriteCount() don't stop at the end of data)
+ *              - Multiple items functions copy items using a single `memcpy`
+ *              - Reserve/acquire functions return a single span
+ *
+ *            A mirrored ring buffer is a #RingBuffer_t, and is used with ring buffer functions.
+ *
+ * @note      Requires #RING_BUFFER_MIRROR, and Linux (`memfd_create`, `mmap`).
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_MIRROR_H__
+#define __RING_BUFFER_MIRROR_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#if RING_BUFFER_MIRROR && defined(__linux__)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferMirror Mirrored ring buffer data (Linux)
+ * @brief Ring buffer data mapped twice back to back, so blocks of items never wrap
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Allocate mirrored ring buffer data, and initialize ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ * @param [in] size         : size of ring buffer data, `size * sizeof(RingBuffer_Item_t)` must be a multiple of the page size,
+ *                            and meet ring buffer size requirements (RingBuffer_enInit())
+ *
+ * @pre @p ring_buffer is not null
+ *
+ * @post @p ring_buffer instance is initialized with mirrored data, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size is not a multiple of the page size, or is invalid for RingBuffer_enInit()
+ *         - #RING_BUFFER_ERROR_SYSTEM          : mirrored data allocation failed, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferMirror_enCreate(RingBuffer_t * ring_buffer, RingBuffer_Counter_t size);
+
+
+/** @brief Free mirrored ring buffer data allocated using RingBufferMirror_enCreate()
+ *
+ * @param [in] ring_buffer  : pointer to ring buffer object
+ *
+ * @pre @p ring_buffer was initialized using RingBufferMirror_enCreate()
+ *
+ * @post @p ring_buffer data is unmapped, and @p ring_buffer is not initialized
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p ring_buffer data is not mirrored
+ *         - #RING_BUFFER_ERROR_SYSTEM          : unmapping data failed, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferMirror_enDestroy(RingBuffer_t * ring_buffer);
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /*  RING_BUFFER_MIRROR && __linux__  */
+
+#endif /* __RING_BUFFER_MIRROR_H__ */
@@ -0,0 +1,228 @@
+/******************************************************************************
+ * @file      ring_buffer_mpmc.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mpmc/ring_buffer_mpmc.h"
+
+#if RING_BUFFER_MPMC
+
+/* ---------------------------------------------------------------------------
+ *
+ * MPMC ring buffer positions (free running counters, slot = pos & (size - 1)):
+ * - enqueue : next position to be written, claimed by producers
+ * - dequeue : next position to be read, claimed by consumers
+ *
+ * Slot sequence, for a slot at position pos:
+ * - sequence == pos            : slot is free, ready to be written at pos
+ * - sequence == pos + 1        : slot holds the item written at pos, ready to be read
+ * - sequence == pos + size     : slot was read, ready to be written at the next lap
+ *
+ * A producer/consumer that sees a sequence behind its position knows the ring buffer is full/empty,
+ * a sequence ahead of its position means another thread claimed the position, so it reloads the counter.
+ *
+ * ------------------------------------------------------------------------- */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Compare ring buffer counters @p a and @p b, as free running counters.
+ *
+ * @return difference `a - b`: 0 when equal, `< 0` when @p a is before @p b, `> 0` otherwise
+ */
+static inline int32_t RingBufferMPMC_xCompare(RingBuffer_Counter_t a, RingBuffer_Counter_t b)
+{
+    RingBuffer_Counter_t difference = (RingBuffer_Counter_t)(a - b);
+
+    if(difference == 0)
+    {
+        return 0;
+    }
+
+    /*  differences in the upper half of counter range are negative  */
+    if(difference > (RingBuffer_Counter_t)(((RingBuffer_Counter_t)~(RingBuffer_Counter_t)0) >> 1))
+    {
+        return -1;
+    }
+
+    return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPMC_enInit(RingBufferMPMC_t * ring_buffer, RingBufferMPMC_Slot_t * const slots, RingBuffer_Counter_t size)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(slots))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if((size < 2) || (size & (size - 1)) || (size > (RingBuffer_Counter_t)(((RingBuffer_Counter_t)~(RingBuffer_Counter_t)0) >> 1)))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    /*  each slot is ready to be written at its first lap position  */
+    for(RingBuffer_Counter_t i = 0; i < size; i++)
+    {
+        atomic_store_explicit(&slots[i].sequence, i, memory_order_relaxed);
+    }
+
+    ring_buffer->slots = slots;
+    ring_buffer->size = size;
+    atomic_store_explicit(&ring_buffer->enqueue, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring_buffer->dequeue, 0, memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPMC_enPutItem(RingBufferMPMC_t * const ring_buffer, RingBuffer_Item_t const * const item)
+{
+    RingBufferMPMC_Slot_t * slot;
+    RingBuffer_Counter_t position;
+    int32_t compare;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->slots) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    position = atomic_load_explicit(&ring_buffer->enqueue, memory_order_relaxed);
+
+    for(;;)
+    {
+        slot = &ring_buffer->slots[position & (ring_buffer->size - 1)];
+
+        /*  acquire: consumer of the previous lap is done reading the slot  */
+        compare = RingBufferMPMC_xCompare(atomic_load_explicit(&slot->sequence, memory_order_acquire), position);
+
+        if(compare == 0)
+        {
+            /*  slot is free, claim position (position is reloaded on failure)  */
+            if(atomic_compare_exchange_weak_explicit(&ring_buffer->enqueue, &position, (RingBuffer_Counter_t)(position + 1), memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(compare < 0)
+        {
+            /*  slot still holds an item of the previous lap  */
+            return RING_BUFFER_ERROR_FULL;
+        }
+        else
+        {
+            /*  position was claimed by another producer  */
+            position = atomic_load_explicit(&ring_buffer->enqueue, memory_order_relaxed);
+        }
+    }
+
+    slot->item = (*item);
+
+    /*  release: item is written before the slot is handed over to consumers  */
+    atomic_store_explicit(&slot->sequence, (RingBuffer_Counter_t)(position + 1), memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPMC_enGetItem(RingBufferMPMC_t * const ring_buffer, RingBuffer_Item_t * const item)
+{
+    RingBufferMPMC_Slot_t * slot;
+    RingBuffer_Counter_t position;
+    int32_t compare;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->slots) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    position = atomic_load_explicit(&ring_buffer->dequeue, memory_order_relaxed);
+
+    for(;;)
+    {
+        slot = &ring_buffer->slots[position & (ring_buffer->size - 1)];
+
+        /*  acquire: item is visible once its slot is handed over  */
+        compare = RingBufferMPMC_xCompare(atomic_load_explicit(&slot->sequence, memory_order_acquire), (RingBuffer_Counter_t)(position + 1));
+
+        if(compare == 0)
+        {
+            /*  slot holds an item, claim position (position is reloaded on failure)  */
+            if(atomic_compare_exchange_weak_explicit(&ring_buffer->dequeue, &position, (RingBuffer_Counter_t)(position + 1), memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(compare < 0)
+        {
+            /*  slot wasn't written yet  */
+            return RING_BUFFER_ERROR_EMPTY;
+        }
+        else
+        {
+            /*  position was claimed by another consumer  */
+            position = atomic_load_explicit(&ring_buffer->dequeue, memory_order_relaxed);
+        }
+    }
+
+    (*item) = slot->item;
+
+    /*  release: item is read before the slot is handed over to producers of the next lap  */
+    atomic_store_explicit(&slot->sequence, (RingBuffer_Counter_t)(position + ring_buffer->size), memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPMC_enItemCount(RingBufferMPMC_t * const ring_buffer, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Counter_t dequeue;
+    RingBuffer_Counter_t enqueue;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->slots) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    dequeue = atomic_load_explicit(&ring_buffer->dequeue, memory_order_acquire);
+    enqueue = atomic_load_explicit(&ring_buffer->enqueue, memory_order_acquire);
+
+    /*  dequeue is loaded first so it can't pass enqueue, but both can move between the loads  */
+    (*item_count) = MIN((RingBuffer_Counter_t)(enqueue - dequeue), ring_buffer->size);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_MPMC  */
@@ -0,0 +1,197 @@
+/******************************************************************************
+ * @file      ring_buffer_mpmc.h
+ * @brief     A Lock free, MPMC (Multiple Producers Multiple Consumers),
+ *            bounded FIFO (First In, First Out) queue.
+ *
+ * @details   MPMC ring buffer is a bounded queue of ring buffer items, where each
+ *            location (slot) holds an item and a sequence number:
+ *              - A producer can write slot `i` at enqueue position `pos` when
+ *              its sequence is `pos`, it claims the position with a compare and swap
+ *              on the enqueue counter, writes the item, then sets sequence to `pos + 1`
+ *              - A consumer can read slot `i` at dequeue position `pos` when
+ *              its sequence is `pos + 1`, it claims the position with a compare and swap
+ *              on the dequeue counter, reads the item, then sets sequence to `pos + size`
+ *
+ *            Producers and consumers only contend on their own counter and the slot they
+ *            claimed, there are no locks and no shared pointer waiting for slower threads.
+ *
+ *            Uses ring buffer item & counter types (#RING_BUFFER_ITEM_DATA_TYPE,
+ *            #RING_BUFFER_COUNTER_DATA_TYPE). Slots and counters are always padded
+ *            to cache lines (#RING_BUFFER_MPMC_CACHE_LINE_SIZE).
+ *
+ *            Requires #RING_BUFFER_ATOMIC, MPMC ring buffer functions are not available otherwise.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_MPMC_H__
+#define __RING_BUFFER_MPMC_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferMPMC Lock free MPMC (Multiple Producers, Multiple Consumers) bounded queue
+ * @brief Lock free MPMC (Multiple Producers, Multiple Consumers) bounded queue
+ * @details   Per slot sequence numbers bounded queue, producers and consumers claim
+ *            positions with a compare and swap and hand over slots using slot sequence numbers.
+ * @{
+ * */
+
+/**
+ * @brief MPMC ring buffer is available, it needs atomic ring buffer counters
+ * */
+#define RING_BUFFER_MPMC                RING_BUFFER_ATOMIC
+
+#if RING_BUFFER_MPMC
+
+/**
+ * @brief Cache line size MPMC slots and counters are padded to.
+ *
+ * Every slot is written by producers and consumers of different threads, so slots are
+ * always padded, defaults to #RING_BUFFER_CACHE_LINE_SIZE when it's set, 64 bytes otherwise.
+ *
+ * @note Can be set during build: `-DRING_BUFFER_MPMC_CACHE_LINE_SIZE=128`
+ * */
+#ifndef RING_BUFFER_MPMC_CACHE_LINE_SIZE
+#if RING_BUFFER_CACHE_LINE_SIZE
+#define RING_BUFFER_MPMC_CACHE_LINE_SIZE    RING_BUFFER_CACHE_LINE_SIZE
+#else
+#define RING_BUFFER_MPMC_CACHE_LINE_SIZE    64
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+#endif /*  RING_BUFFER_MPMC_CACHE_LINE_SIZE  */
+
+#if (RING_BUFFER_MPMC_CACHE_LINE_SIZE <= 0)
+#error "RING_BUFFER_MPMC_CACHE_LINE_SIZE must be a positive power of 2"
+#endif /*  (RING_BUFFER_MPMC_CACHE_LINE_SIZE <= 0)  */
+
+#if defined(__cplusplus)
+#define RING_BUFFER_MPMC_CACHE_ALIGNED      alignas(RING_BUFFER_MPMC_CACHE_LINE_SIZE)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define RING_BUFFER_MPMC_CACHE_ALIGNED      _Alignas(RING_BUFFER_MPMC_CACHE_LINE_SIZE)
+#else
+#define RING_BUFFER_MPMC_CACHE_ALIGNED      __attribute__((aligned(RING_BUFFER_MPMC_CACHE_LINE_SIZE)))
+#endif /*  __cplusplus  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief MPMC ring buffer slot, an item and its sequence number
+ *
+ * @note Slots are aligned (padded) to #RING_BUFFER_MPMC_CACHE_LINE_SIZE,
+ *       so threads accessing adjacent slots don't share cache lines.
+ */
+typedef struct RingBufferMPMC_Slot_t {
+    RING_BUFFER_MPMC_CACHE_ALIGNED
+    RingBuffer_SharedCounter_t sequence;    /**<  position the slot is ready for: `pos` to be written, `pos + 1` to be read  */
+    RingBuffer_Item_t item;                 /**<  slot item  */
+} RingBufferMPMC_Slot_t;
+
+/**
+ * @brief MPMC ring buffer structure
+ */
+typedef struct RingBufferMPMC_t {
+    RingBufferMPMC_Slot_t * slots;          /**<  pointer to ring buffer slots  */
+    RingBuffer_Counter_t size;              /**<  number of slots, maximum number of items ring buffer can hold  */
+    /*  producers cache line  */
+    RING_BUFFER_MPMC_CACHE_ALIGNED
+    RingBuffer_SharedCounter_t enqueue;     /**<  free running enqueue position, next position to be claimed by a producer  */
+    /*  consumers cache line  */
+    RING_BUFFER_MPMC_CACHE_ALIGNED
+    RingBuffer_SharedCounter_t dequeue;     /**<  free running dequeue position, next position to be claimed by a consumer  */
+} RingBufferMPMC_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize MPMC ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to MPMC ring buffer object
+ * @param [in] slots        : pointer to an array of @p size slots used for ring buffer's storage
+ * @param [in] size         : number of slots, must be a power of 2 > 1, and at most half the range of #RingBuffer_Counter_t
+ *
+ * @pre @p ring_buffer and @p slots are not null
+ *
+ * @post @p ring_buffer instance is initialized, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p slots is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1, @p size is not a power of 2 or is too large
+ *
+ */
+RingBuffer_Error_t RingBufferMPMC_enInit(RingBufferMPMC_t * ring_buffer, RingBufferMPMC_Slot_t * const slots, RingBuffer_Counter_t size);
+
+
+/** @brief Put an item into MPMC ring buffer, can be called from multiple producers at the same time
+ *
+ * @param [in] ring_buffer  : pointer to MPMC ring buffer object
+ * @param [in] item         : pointer to ring buffer item to put into ring buffer
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @post @p item is added to @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE    : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_FULL    : @p ring_buffer is full
+ *
+ */
+RingBuffer_Error_t RingBufferMPMC_enPutItem(RingBufferMPMC_t * const ring_buffer, RingBuffer_Item_t const * const item);
+
+
+/** @brief Get an item from MPMC ring buffer, can be called from multiple consumers at the same time
+ *
+ * @param [in] ring_buffer  : pointer to MPMC ring buffer object
+ * @param [out] item        : pointer to ring buffer item variable to store item taken from ring buffer
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @post @p item contains the oldest item in @p ring_buffer that was not taken by another consumer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE    : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY   : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferMPMC_enGetItem(RingBufferMPMC_t * const ring_buffer, RingBuffer_Item_t * const item);
+
+
+/** @brief Get number of items in MPMC ring buffer
+ *
+ * @param [in] ring_buffer  : pointer to MPMC ring buffer object
+ * @param [out] item_count  : pointer to RingBuffer_Counter_t variable
+ *
+ * @note The count is a snapshot, it can be outdated as soon as it's returned when other threads use @p ring_buffer.
+ *
+ * @pre @p ring_buffer instance is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p item_count is NULL, or @p ring_buffer was not initialized
+ *
+ */
+RingBuffer_Error_t RingBufferMPMC_enItemCount(RingBufferMPMC_t * const ring_buffer, RingBuffer_Counter_t * const item_count);
+
+#endif /*  RING_BUFFER_MPMC  */
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_MPMC_H__ */
@@ -0,0 +1,264 @@
+/******************************************************************************
+ * @file      ring_buffer_mpsc.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mpsc/ring_buffer_mpsc.h"
+
+#if RING_BUFFER_MPSC
+
+/* ---------------------------------------------------------------------------
+ *
+ * MPSC ring buffer counters (all free running):
+ * - head  : number of items read by the consumer (ring_buffer.head)
+ * - tail  : number of items published to the consumer (ring_buffer.tail)
+ * - claim : number of locations claimed by producers, head <= tail <= claim <= head + size
+ *
+ * Put:
+ * 1 - claim [claim, claim + n) with a compare & swap on claim, n limited to free locations (head + size - claim)
+ * 2 - copy items into the claimed locations
+ * 3 - commit each location i by storing its counter value in commit[i & (size - 1)] (release)
+ * 4 - publish: move tail over the committed locations that follow it (compare & swap, release).
+ *     Any producer can publish items committed by other producers, so a producer doesn't wait
+ *     for slower producers that claimed locations before it.
+ *
+ * A full fence between commit (3) and publish (4) guarantees that when two producers
+ * commit at the same time, at least one of them sees the other's commit flags,
+ * so committed items are never left unpublished.
+ *
+ * Commit flags hold counter values, so they never need to be cleared: location i is committed
+ * for counter c only when commit[i] == c. Commit flags are initialized to the previous lap (i - size).
+ *
+ * ------------------------------------------------------------------------- */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Claim up to @p len free locations in MPSC ring buffer, in a single atomic operation.
+ *
+ * @param [out] claimed : number of claimed locations, 0 if MPSC ring buffer is full
+ *
+ * @return counter value of first claimed location
+ */
+static inline RingBuffer_Counter_t RingBufferMPSC_xClaim(RingBufferMPSC_t * const ring_buffer, RingBuffer_Counter_t len, RingBuffer_Counter_t * const claimed)
+{
+    RingBuffer_Counter_t claim;
+    RingBuffer_Counter_t head;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t count;
+
+    claim = atomic_load_explicit(&ring_buffer->claim, memory_order_relaxed);
+
+    do
+    {
+        /*  acquire: consumer is done reading locations before head  */
+        head = atomic_load_explicit(&ring_buffer->ring_buffer.head, memory_order_acquire);
+        free_count = (RingBuffer_Counter_t)(ring_buffer->ring_buffer.size - (RingBuffer_Counter_t)(claim - head));
+
+        if(free_count == 0)
+        {
+            (*claimed) = 0;
+            return claim;
+        }
+
+        count = MIN(free_count, len);
+    }
+    while(!atomic_compare_exchange_weak_explicit(&ring_buffer->claim, &claim, (RingBuffer_Counter_t)(claim + count), memory_order_relaxed, memory_order_relaxed));
+
+    (*claimed) = count;
+
+    return claim;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Commit @p count locations starting at counter value @p start.
+ */
+static inline void RingBufferMPSC_xCommit(RingBufferMPSC_t * const ring_buffer, RingBuffer_Counter_t start, RingBuffer_Counter_t count)
+{
+    RingBuffer_Counter_t mask = (RingBuffer_Counter_t)(ring_buffer->ring_buffer.size - 1);
+
+    for(RingBuffer_Counter_t i = 0; i < count; i++)
+    {
+        RingBuffer_Counter_t counter = (RingBuffer_Counter_t)(start + i);
+
+        /*  release: items are written before the location is committed  */
+        atomic_store_explicit(&ring_buffer->commit[counter & mask], counter, memory_order_release);
+    }
+
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Move ring buffer tail over committed locations, publish them to the consumer.
+ */
+static inline void RingBufferMPSC_xPublish(RingBufferMPSC_t * const ring_buffer)
+{
+    RingBuffer_Counter_t size = ring_buffer->ring_buffer.size;
+    RingBuffer_Counter_t mask = (RingBuffer_Counter_t)(size - 1);
+    RingBuffer_Counter_t tail;
+    RingBuffer_Counter_t committed;
+
+    tail = atomic_load_explicit(&ring_buffer->ring_buffer.tail, memory_order_relaxed);
+
+    for(;;)
+    {
+        committed = tail;
+
+        /*  acquire: items of committed locations are visible to the producer that publishes them  */
+        while(((RingBuffer_Counter_t)(committed - tail) < size) &&
+              (atomic_load_explicit(&ring_buffer->commit[committed & mask], memory_order_acquire) == committed))
+        {
+            committed++;
+        }
+
+        if(committed == tail)
+        {
+            /*  nothing to publish, or tail was already moved by another producer  */
+            return;
+        }
+
+        /*  release: consumer reading tail sees the published items  */
+        if(atomic_compare_exchange_weak_explicit(&ring_buffer->ring_buffer.tail, &tail, committed, memory_order_release, memory_order_relaxed))
+        {
+            tail = committed;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPSC_enInit(RingBufferMPSC_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_SharedCounter_t * const commit, RingBuffer_Counter_t size)
+{
+    RingBuffer_Error_t error;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(commit))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    error = RingBuffer_enInit(&ring_buffer->ring_buffer, data, size);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        return error;
+    }
+
+    /*  all locations are committed for the previous lap  */
+    for(RingBuffer_Counter_t i = 0; i < size; i++)
+    {
+        atomic_store_explicit(&commit[i], (RingBuffer_Counter_t)(i - size), memory_order_relaxed);
+    }
+
+    ring_buffer->commit = commit;
+    atomic_store_explicit(&ring_buffer->claim, 0, memory_order_release);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPSC_enPutItem(RingBufferMPSC_t * const ring_buffer, RingBuffer_Item_t const * const item)
+{
+    RingBuffer_Counter_t claim;
+    RingBuffer_Counter_t claimed;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(ring_buffer->commit) || IS_NULLPTR(item))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    claim = RingBufferMPSC_xClaim(ring_buffer, 1, &claimed);
+
+    if(claimed == 0)
+    {
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    memcpy(&ring_buffer->ring_buffer.data[claim & (ring_buffer->ring_buffer.size - 1)], item, sizeof(RingBuffer_Item_t));
+
+    RingBufferMPSC_xCommit(ring_buffer, claim, 1);
+    RingBufferMPSC_xPublish(ring_buffer);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferMPSC_enPutItems(RingBufferMPSC_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Counter_t claim;
+    RingBuffer_Counter_t claimed;
+    RingBuffer_Counter_t index;
+    RingBuffer_Counter_t write_count;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(ring_buffer->commit) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    claim = RingBufferMPSC_xClaim(ring_buffer, len, &claimed);
+
+    if(claimed == 0)
+    {
+        (*item_count) = 0;
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    /*  copy items into claimed locations, up to the end of ring buffer data, then from its start  */
+    index = (RingBuffer_Counter_t)(claim & (ring_buffer->ring_buffer.size - 1));
+    write_count = MIN(claimed, (RingBuffer_Counter_t)(ring_buffer->ring_buffer.size - index));
+
+    memcpy(&ring_buffer->ring_buffer.data[index], items, write_count * sizeof(RingBuffer_Item_t));
+
+    if(claimed > write_count)
+    {
+        memcpy(ring_buffer->ring_buffer.data, &items[write_count], (claimed - write_count) * sizeof(RingBuffer_Item_t));
+    }
+
+    RingBufferMPSC_xCommit(ring_buffer, claim, claimed);
+    RingBufferMPSC_xPublish(ring_buffer);
+
+    (*item_count) = claimed;
+
+    if(claimed != len)
+    {
+        return RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_MPSC  */
@@ -0,0 +1,151 @@
+/******************************************************************************
+ * @file      ring_buffer_mpsc.h
+ * @brief     A Lock free, MPSC (Multiple Producers Single Consumer),
+ *            FIFO (First In, First Out) ring buffer.
+ *
+ * @details   MPSC ring buffer is a ring buffer (#RingBuffer_t) that can be
+ *            written by multiple producer threads without locks:
+ *              - A producer claims free locations by moving a shared claim
+ *              counter ahead with a single compare and swap (a batch of items
+ *              is claimed in one atomic operation)
+ *              - The producer copies its items into the claimed locations,
+ *              and marks each location as committed (per location commit flags)
+ *              - Ring buffer tail is only moved over committed locations, so the
+ *              consumer never reads items that are not completely written
+ *
+ *            The consumer uses the ring buffer functions (RingBuffer_enGetItems(),
+ *            RingBuffer_enBlockReadCount(), RingBuffer_enSkipItems(), ...) on the
+ *            #RingBufferMPSC_t::ring_buffer member, as for an SPSC ring buffer.
+ *
+ *            Requires #RING_BUFFER_ATOMIC and #RING_BUFFER_FREE_RUNNING,
+ *            MPSC ring buffer functions are not available otherwise.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_MPSC_H__
+#define __RING_BUFFER_MPSC_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferMPSC Lock free MPSC (Multiple Producers, Single Consumer) ring buffer
+ * @brief Lock free MPSC (Multiple Producers, Single Consumer) ring buffer
+ * @details   Producers claim free locations with a compare and swap on a shared claim counter,
+ *            and publish them using per location commit flags. The consumer uses ring buffer
+ *            functions on #RingBufferMPSC_t::ring_buffer.
+ * @{
+ * */
+
+/**
+ * @brief MPSC ring buffer is available, it needs atomic free running ring buffer pointers
+ * */
+#define RING_BUFFER_MPSC                (RING_BUFFER_ATOMIC && RING_BUFFER_FREE_RUNNING)
+
+#if RING_BUFFER_MPSC
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief MPSC ring buffer structure
+ */
+typedef struct RingBufferMPSC_t {
+    RingBuffer_t ring_buffer;               /**<  ring buffer, used by the consumer to read items  */
+    RingBuffer_SharedCounter_t * commit;    /**<  per location commit flags, location `i` holds the counter value of the last item committed at `i`  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  producers cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t claim;       /**<  number of locations claimed by producers, ahead of ring buffer tail by claimed but unpublished items  */
+} RingBufferMPSC_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize MPSC ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to MPSC ring buffer object
+ * @param [in] data         : pointer to an array of items used for ring buffer's data storage
+ * @param [in] commit       : pointer to an array of @p size commit flags, one for each item in @p data
+ * @param [in] size         : size of ring buffer data, must be a power of 2 > 1
+ *
+ * @pre @p ring_buffer, @p data and @p commit are not null
+ *
+ * @post @p ring_buffer instance is initialized, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p data or @p commit is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size <= 1, or @p size is not a power of 2
+ *
+ */
+RingBuffer_Error_t RingBufferMPSC_enInit(RingBufferMPSC_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_SharedCounter_t * const commit, RingBuffer_Counter_t size);
+
+
+/** @brief Put an item into MPSC ring buffer, can be called from multiple producers at the same time
+ *
+ * @param [in] ring_buffer  : pointer to MPSC ring buffer object
+ * @param [in] item         : pointer to ring buffer item to put into ring buffer
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @post @p item is added to @p ring_buffer, it's visible to the consumer once the items claimed before it are committed
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE    : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_FULL    : @p ring_buffer is full
+ *
+ */
+RingBuffer_Error_t RingBufferMPSC_enPutItem(RingBufferMPSC_t * const ring_buffer, RingBuffer_Item_t const * const item);
+
+
+/** @brief Put multiple items into MPSC ring buffer, can be called from multiple producers at the same time
+ *
+ * @param [in] ring_buffer  : pointer to MPSC ring buffer object
+ * @param [in] items        : pointer to an array of ring buffer items
+ * @param [in] len          : number of items to put into ring buffer
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items successfully put into the ring buffer.
+ *
+ * @note Free locations for all the items are claimed in one atomic operation, so items put by one call
+ *       are contiguous in the ring buffer (not interleaved with items of other producers).
+ *
+ * @note If @p ring_buffer has free space less than @p len, only some of the items will be put into @p ring_buffer,
+ *       and @p item_count will contain then number of items put into @p ring_buffer.
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @post @p item_count items are added to @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p ring_buffer or @p items is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p len is 0
+ *         - #RING_BUFFER_ERROR_FULL                : @p ring_buffer is full
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : only some of the items were put into @p ring_buffer,
+ *                                                    as @p ring_buffer didn't have enough free space to put all the items
+ *
+ */
+RingBuffer_Error_t RingBufferMPSC_enPutItems(RingBufferMPSC_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count);
+
+#endif /*  RING_BUFFER_MPSC  */
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_MPSC_H__ */
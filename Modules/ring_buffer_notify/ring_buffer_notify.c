@@ -0,0 +1,206 @@
+/******************************************************************************
+ * @file      ring_buffer_notify.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_notify/ring_buffer_notify.h"
+
+#if RING_BUFFER_NOTIFY
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/* ---------------------------------------------------------------------------
+ *
+ * Signaling:
+ * - producer   : put items, fence, if items >= threshold and signaled is clear: set signaled, write eventfd
+ * - consumer   : read eventfd, clear signaled, fence, get items
+ *
+ * Both fences are sequentially consistent, so either the consumer gets the items put before the
+ * producer checked signaled, or the producer sees signaled cleared and signals again.
+ *
+ * ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferNotify_enInit(RingBufferNotify_t * notify, RingBuffer_t * const ring_buffer, RingBuffer_Counter_t threshold)
+{
+    RingBuffer_Counter_t item_count = 0;
+    RingBuffer_Counter_t free_count = 0;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(notify) || IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (void)RingBuffer_enItemCount(ring_buffer, &item_count);
+    (void)RingBuffer_enFreeCount(ring_buffer, &free_count);
+
+    if(IS_ZERO(threshold) || (threshold > (RingBuffer_Counter_t)(item_count + free_count)))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    notify->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if(notify->fd < 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    notify->ring_buffer = ring_buffer;
+    notify->threshold = threshold;
+    atomic_store_explicit(&notify->signaled, 0, memory_order_relaxed);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferNotify_enDeinit(RingBufferNotify_t * const notify)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(notify))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    if(notify->fd >= 0)
+    {
+        (void)close(notify->fd);
+    }
+
+    notify->fd = -1;
+    notify->ring_buffer = NULL;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferNotify_enPutItems(RingBufferNotify_t * const notify, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count)
+{
+    RingBuffer_Error_t error;
+    RingBuffer_Error_t signal_error;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(notify) || IS_NULLPTR(notify->ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    error = RingBuffer_enPutItems(notify->ring_buffer, items, len, item_count);
+
+    if((error != RING_BUFFER_ERROR_NONE) && (error != RING_BUFFER_ERROR_INSUFFICIENT_ITEMS))
+    {
+        return error;
+    }
+
+    signal_error = RingBufferNotify_enSignal(notify);
+
+    return (signal_error != RING_BUFFER_ERROR_NONE) ? signal_error : error;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferNotify_enSignal(RingBufferNotify_t * const notify)
+{
+    RingBuffer_Counter_t item_count = 0;
+    uint64_t value = 1;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(notify) || IS_NULLPTR(notify->ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (void)RingBuffer_enItemCount(notify->ring_buffer, &item_count);
+
+    if(item_count < notify->threshold)
+    {
+        return RING_BUFFER_ERROR_NONE;
+    }
+
+    /*  items are published before signaled is checked  */
+    atomic_thread_fence(memory_order_seq_cst);
+
+    /*  coalesce: only the first signal after an acknowledge writes the eventfd  */
+    if(atomic_load_explicit(&notify->signaled, memory_order_relaxed) ||
+       atomic_exchange_explicit(&notify->signaled, 1, memory_order_relaxed))
+    {
+        return RING_BUFFER_ERROR_NONE;
+    }
+
+    while(write(notify->fd, &value, sizeof(value)) < 0)
+    {
+        if(errno != EINTR)
+        {
+            return RING_BUFFER_ERROR_SYSTEM;
+        }
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferNotify_enAcknowledge(RingBufferNotify_t * const notify)
+{
+    uint64_t value;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(notify) || IS_NULLPTR(notify->ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    while(read(notify->fd, &value, sizeof(value)) < 0)
+    {
+        if(errno == EAGAIN)
+        {
+            /*  not signaled, or the signal is being written  */
+            break;
+        }
+
+        if(errno != EINTR)
+        {
+            return RING_BUFFER_ERROR_SYSTEM;
+        }
+    }
+
+    atomic_store_explicit(&notify->signaled, 0, memory_order_relaxed);
+
+    /*  signaled is cleared before items are checked  */
+    atomic_thread_fence(memory_order_seq_cst);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_NOTIFY  */
@@ -0,0 +1,177 @@
+/******************************************************************************
+ * @file      ring_buffer_notify.h
+ * @brief     Ring buffer eventfd notifier (Linux), so a consumer can wait for items
+ *            in an event loop (epoll, poll, select), alongside sockets and timers.
+ *
+ * @details   The notifier attaches an eventfd to a ring buffer (#RingBuffer_t):
+ *              - The producer signals the eventfd when the ring buffer has at least `threshold`
+ *              items after a put: threshold 1 signals on the empty to non-empty transition
+ *              - Signals are coalesced: once signaled, the producer doesn't write the eventfd again
+ *              until the consumer acknowledges it, so a burst of puts costs at most one `write`
+ *              - The consumer adds the eventfd to its epoll set (`EPOLLIN`), acknowledges it when
+ *              it's readable, then gets items
+ *
+ *            The producer and the consumer follow the usual SPSC rules, the producer uses
+ *            RingBufferNotify_enPutItems() or signals after its own puts using RingBufferNotify_enSignal().
+ *
+ * @note      Requires #RING_BUFFER_ATOMIC and Linux (eventfd).
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_NOTIFY_H__
+#define __RING_BUFFER_NOTIFY_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferNotify Ring buffer eventfd notifier (Linux)
+ * @brief Ring buffer eventfd notifier, for epoll based consumers
+ * @details   Coalesced eventfd signals on empty to non-empty, or item threshold crossing.
+ * @{
+ * */
+
+/**
+ * @brief Ring buffer notifier is available, it needs atomic ring buffer pointers and Linux eventfd
+ * */
+#if RING_BUFFER_ATOMIC && defined(__linux__)
+#define RING_BUFFER_NOTIFY              1
+#else
+#define RING_BUFFER_NOTIFY              0
+#endif /*  RING_BUFFER_ATOMIC && __linux__  */
+
+#if RING_BUFFER_NOTIFY
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Ring buffer notifier structure
+ */
+typedef struct RingBufferNotify_t {
+    RingBuffer_t * ring_buffer;             /**<  ring buffer the notifier is attached to  */
+    int fd;                                 /**<  eventfd, readable when the consumer is signaled (add it to an epoll set)  */
+    RingBuffer_Counter_t threshold;         /**<  number of items that signals the consumer  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  shared cache line, only written once per signal  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBuffer_SharedCounter_t signaled;    /**<  set by the producer when it writes the eventfd, cleared by the consumer's acknowledge  */
+} RingBufferNotify_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Attach a notifier to @p ring_buffer, creating its eventfd.
+ *
+ * @param [in] notify       : pointer to notifier object
+ * @param [in] ring_buffer  : pointer to initialized ring buffer
+ * @param [in] threshold    : number of items that signals the consumer, 1 signals when @p ring_buffer becomes non-empty
+ *
+ * @note With a threshold above 1, items below the threshold don't signal the consumer,
+ *       it should also get items on its own (timer, or when handling other events).
+ *
+ * @pre @p ring_buffer is initialized, and empty or with less than @p threshold items
+ *
+ * @post @p notify is attached to @p ring_buffer, and its eventfd is not readable
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p notify or @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p threshold is 0, or more than @p ring_buffer can hold
+ *         - #RING_BUFFER_ERROR_SYSTEM          : eventfd can't be created, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferNotify_enInit(RingBufferNotify_t * notify, RingBuffer_t * const ring_buffer, RingBuffer_Counter_t threshold);
+
+
+/** @brief Detach notifier, closing its eventfd.
+ *
+ * @param [in] notify       : pointer to notifier object
+ *
+ * @pre @p notify is initialized, and its eventfd was removed from epoll sets
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p notify is NULL
+ *
+ */
+RingBuffer_Error_t RingBufferNotify_enDeinit(RingBufferNotify_t * const notify);
+
+
+/** @brief Put items into the ring buffer, and signal the consumer when needed (producer)
+ *
+ * @param [in] notify       : pointer to notifier object
+ * @param [in] items        : pointer to an array of items
+ * @param [in] len          : number of items to put
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items added
+ *
+ * @note Same as RingBuffer_enPutItems() followed by RingBufferNotify_enSignal().
+ *
+ * @pre @p notify is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - Errors of RingBuffer_enPutItems()
+ *         - #RING_BUFFER_ERROR_SYSTEM          : eventfd can't be written, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferNotify_enPutItems(RingBufferNotify_t * const notify, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const item_count);
+
+
+/** @brief Signal the consumer if the ring buffer reached the threshold, and the consumer isn't signaled yet (producer)
+ *
+ * @param [in] notify       : pointer to notifier object
+ *
+ * @note Call after items were added by other ring buffer functions (RingBuffer_enCommit(), RingBuffer_enReadFromFd()...).
+ *       It doesn't make a system call when the consumer is already signaled, or when the threshold isn't reached.
+ *
+ * @pre @p notify is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p notify is NULL, or @p notify was not initialized
+ *         - #RING_BUFFER_ERROR_SYSTEM          : eventfd can't be written, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferNotify_enSignal(RingBufferNotify_t * const notify);
+
+
+/** @brief Acknowledge a signal, when the eventfd is readable (consumer)
+ *
+ * @param [in] notify       : pointer to notifier object
+ *
+ * @note Acknowledge before getting items: items added after the acknowledge signal the consumer again,
+ *       so no signal is lost (a signal can find the items already taken).
+ *
+ * @pre @p notify is initialized
+ *
+ * @post @p notify eventfd is not readable, until the producer signals it again
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error (also when @p notify wasn't signaled)
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p notify is NULL, or @p notify was not initialized
+ *         - #RING_BUFFER_ERROR_SYSTEM          : eventfd can't be read, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferNotify_enAcknowledge(RingBufferNotify_t * const notify);
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  RING_BUFFER_NOTIFY  */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_NOTIFY_H__ */
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * @file      ring_buffer_reader.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_find/ring_buffer_find.h"
+#include "ring_buffer_reader/ring_buffer_reader.h"
+
+/* ---------------------------------------------------------------------------
+ *
+ * Frames:
+ * - next       : find the delimiter from scanned, the frame is items up to the end of the delimiter.
+ *                When the delimiter isn't found, scanned moves to where it can still start
+ *                (the last len - 1 items), so the next search only covers new items.
+ *                When found, scanned stays at the delimiter, so the same frame is found right away
+ * - consume    : remove items, and move scanned back by the removed items
+ *
+ * ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferReader_enInit(RingBufferReader_t * reader, RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const delimiter, RingBuffer_Counter_t len)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(reader) || IS_NULLPTR(ring_buffer) || IS_NULLPTR(delimiter))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    reader->ring_buffer = ring_buffer;
+    reader->delimiter = delimiter;
+    reader->len = len;
+    reader->scanned = 0;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferReader_enNext(RingBufferReader_t * const reader, RingBuffer_Span_t * const first, RingBuffer_Span_t * const second, RingBuffer_Counter_t * const frame_len)
+{
+    RingBuffer_Counter_t position;
+    RingBuffer_Counter_t acquired;
+    RingBuffer_Error_t error;
+    uint8_t is_full = FALSE;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(reader) || IS_NULLPTR(reader->ring_buffer) || IS_NULLPTR(first) || IS_NULLPTR(second) || IS_NULLPTR(frame_len))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*frame_len) = 0;
+    first->data = NULL;
+    first->count = 0;
+    second->data = NULL;
+    second->count = 0;
+
+    error = RingBuffer_enFindPattern(reader->ring_buffer, reader->delimiter, reader->len, reader->scanned, &position);
+
+    if(error == RING_BUFFER_ERROR_INSUFFICIENT_ITEMS)
+    {
+        /*  partial frame, search its new items only next time  */
+        reader->scanned = position;
+
+        (void)RingBuffer_enIsFull(reader->ring_buffer, &is_full);
+
+        return is_full ? RING_BUFFER_ERROR_FULL : RING_BUFFER_ERROR_INSUFFICIENT_ITEMS;
+    }
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        /*  empty, nothing left to skip when items arrive  */
+        reader->scanned = 0;
+        return error;
+    }
+
+    reader->scanned = position;
+
+    /*  frame items are in the ring buffer, acquiring them can't fail  */
+    (void)RingBuffer_enAcquire(reader->ring_buffer, (RingBuffer_Counter_t)(position + reader->len), first, second, &acquired);
+    (*frame_len) = acquired;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferReader_enConsume(RingBufferReader_t * const reader, RingBuffer_Counter_t count)
+{
+    RingBuffer_Counter_t skipped = 0;
+    RingBuffer_Error_t error;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(reader) || IS_NULLPTR(reader->ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    error = RingBuffer_enSkipItems(reader->ring_buffer, count, &skipped);
+
+    reader->scanned = (reader->scanned > skipped) ? (RingBuffer_Counter_t)(reader->scanned - skipped) : 0;
+
+    return error;
+}
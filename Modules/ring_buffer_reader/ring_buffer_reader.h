@@ -0,0 +1,130 @@
+/******************************************************************************
+ * @file      ring_buffer_reader.h
+ * @brief     Zero copy line and delimited frame reader, returning frames as spans
+ *            of the ring buffer data.
+ *
+ * @details   The reader finds the next complete frame (a line, or items up to a delimiter)
+ *            in a ring buffer (#RingBuffer_t), without copying it:
+ *              - RingBufferReader_enNext() returns the frame, delimiter included, as one span,
+ *              or two when it wraps around the end of ring buffer data
+ *              - RingBufferReader_enConsume() removes the frame once it's processed,
+ *              like RingBuffer_enSkipItems()
+ *
+ *            A partial frame stays in the ring buffer until its delimiter arrives, and the reader
+ *            remembers how far it searched, so items of a partial frame are searched once.
+ *            The reader is used by the consumer side, it follows the usual SPSC rules.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_READER_H__
+#define __RING_BUFFER_READER_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferReader Ring buffer zero copy line and frame reader
+ * @brief Ring buffer line and delimited frame reader, returning frames in place
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Ring buffer reader structure
+ */
+typedef struct RingBufferReader_t {
+    RingBuffer_t * ring_buffer;             /**<  ring buffer the reader gets frames from  */
+    RingBuffer_Item_t const * delimiter;    /**<  items ending a frame, not copied (must outlive the reader)  */
+    RingBuffer_Counter_t len;               /**<  number of delimiter items  */
+    RingBuffer_Counter_t scanned;           /**<  offset from the oldest item where the next search starts  */
+} RingBufferReader_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize a reader of frames ended by @p delimiter in @p ring_buffer
+ *
+ * @param [in] reader       : pointer to reader object
+ * @param [in] ring_buffer  : pointer to initialized ring buffer
+ * @param [in] delimiter    : pointer to an array of items ending a frame, for example `"\n"` or `"\r\n"` (not copied)
+ * @param [in] len          : number of items in @p delimiter
+ *
+ * @pre @p len > 0
+ *
+ * @post @p reader searches from the oldest item of @p ring_buffer
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p reader, @p ring_buffer or @p delimiter is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0
+ *
+ */
+RingBuffer_Error_t RingBufferReader_enInit(RingBufferReader_t * reader, RingBuffer_t * const ring_buffer, RingBuffer_Item_t const * const delimiter, RingBuffer_Counter_t len);
+
+
+/** @brief Get the next complete frame, in place (consumer)
+ *
+ * @param [in] reader       : pointer to reader object
+ * @param [out] first       : pointer to ring buffer span variable, to store the first block of the frame (from the oldest item)
+ * @param [out] second      : pointer to ring buffer span variable, to store the second block of the frame (from the start of ring buffer data),
+ *                            its count is 0 when the frame doesn't wrap around the end of ring buffer data
+ * @param [out] frame_len   : pointer to ring buffer counter variable to store number of frame items, delimiter included
+ *
+ * @note The frame stays in the ring buffer, getting the next frame again before consuming it returns the same frame.
+ *
+ * @pre @p reader is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error, the frame is @p frame_len items in @p first and @p second
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p reader, @p first, @p second or @p frame_len is NULL, or @p reader was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY               : the ring buffer is empty
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : the frame is partial, its delimiter wasn't added yet
+ *         - #RING_BUFFER_ERROR_FULL                : the frame is partial and the ring buffer is full, it's longer than the ring buffer
+ *                                                    can hold (consume items to drop it)
+ *
+ */
+RingBuffer_Error_t RingBufferReader_enNext(RingBufferReader_t * const reader, RingBuffer_Span_t * const first, RingBuffer_Span_t * const second, RingBuffer_Counter_t * const frame_len);
+
+
+/** @brief Remove @p count items (a frame) from the ring buffer, once processed (consumer)
+ *
+ * @param [in] reader       : pointer to reader object
+ * @param [in] count        : number of items to remove, usually the frame length of RingBufferReader_enNext()
+ *
+ * @note Items are removed the same way as RingBuffer_enSkipItems(), consuming more items than the frame
+ *       drops the start of the next frames.
+ *
+ * @pre @p reader is initialized
+ *
+ * @post @p count oldest items are removed, the next frame starts after them
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE                : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR             : @p reader is NULL, or @p reader was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM       : @p count is 0
+ *         - #RING_BUFFER_ERROR_EMPTY               : the ring buffer is empty
+ *         - #RING_BUFFER_ERROR_INSUFFICIENT_ITEMS  : the ring buffer had less than @p count items, all its items are removed
+ *
+ */
+RingBuffer_Error_t RingBufferReader_enConsume(RingBufferReader_t * const reader, RingBuffer_Counter_t count);
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_READER_H__ */
@@ -0,0 +1,289 @@
+/******************************************************************************
+ * @file      ring_buffer_record.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_record/ring_buffer_record.h"
+
+/* ---------------------------------------------------------------------------
+ *
+ * Record layout in ring buffer data (all sizes are multiples of RING_BUFFER_RECORD_ALIGNMENT):
+ * - header     : RING_BUFFER_RECORD_HEADER_ITEMS items, holding record length (number of record items)
+ * - items      : record items, followed by alignment items up to the next record
+ *
+ * Write pointer is always aligned, so when a record doesn't fit before the end of ring buffer data,
+ * the remaining locations are padding:
+ * - when a header fits, it's a padding header, with length #RING_BUFFER_RECORD_PADDING
+ * - otherwise, the consumer skips the remaining locations, as they can't hold a record header
+ *
+ * Padding and the record that follows it are committed together, so the consumer never
+ * sees padding without a record after it.
+ *
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Record length of padding headers
+ */
+#define RING_BUFFER_RECORD_PADDING      ((RingBuffer_Counter_t)~(RingBuffer_Counter_t)0)
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get number of ring buffer items used by a record of @p len items (header, items and alignment)
+ */
+static inline RingBuffer_Counter_t RingBufferRecord_xRecordItems(RingBuffer_Counter_t len)
+{
+    return (RingBuffer_Counter_t)RING_BUFFER_RECORD_ALIGN(RING_BUFFER_RECORD_HEADER_ITEMS + len);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Read record length from record @p header
+ */
+static inline RingBuffer_Counter_t RingBufferRecord_xLength(RingBuffer_Item_t const * const header)
+{
+    RingBuffer_Counter_t len;
+
+    /*  header may not be aligned for counter access  */
+    memcpy(&len, header, sizeof(RingBuffer_Counter_t));
+
+    return len;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get the oldest record, and the number of padding locations before it
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE    : @p header points to the oldest record header, @p padding is its padding
+ *         - #RING_BUFFER_ERROR_EMPTY   : ring buffer is empty
+ */
+static inline RingBuffer_Error_t RingBufferRecord_xFront(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t ** const header, RingBuffer_Counter_t * const padding)
+{
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t count;
+
+    /*  all items in ring buffer, errors other than empty are expected (less items than size)  */
+    (void)RingBuffer_enAcquire(&ring_buffer->ring_buffer, ring_buffer->ring_buffer.size, &first, &second, &count);
+
+    if(count == 0)
+    {
+        return RING_BUFFER_ERROR_EMPTY;
+    }
+
+    if((first.count < RING_BUFFER_RECORD_HEADER_ITEMS) || (RingBufferRecord_xLength(first.data) == RING_BUFFER_RECORD_PADDING))
+    {
+        /*  padding up to the end of ring buffer data, record is at the start  */
+        (*header) = second.data;
+        (*padding) = first.count;
+    }
+    else
+    {
+        (*header) = first.data;
+        (*padding) = 0;
+    }
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferRecord_enInit(RingBufferRecord_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    /*  at least a record of 1 item, in half the ring buffer  */
+    if((size & (RING_BUFFER_RECORD_ALIGNMENT - 1)) || (size < (2 * RING_BUFFER_RECORD_ALIGN(RING_BUFFER_RECORD_HEADER_ITEMS + 1))))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    return RingBuffer_enInit(&ring_buffer->ring_buffer, data, size);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferRecord_enPutRecord(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len)
+{
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Item_t * header;
+    RingBuffer_Counter_t record_items;
+    RingBuffer_Counter_t padding;
+    RingBuffer_Counter_t reserved;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(items))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    /*  a record up to half the ring buffer always fits once the consumer reads older records, even with padding before it  */
+    if(IS_ZERO(len) || (len > (ring_buffer->ring_buffer.size / 2)) || (RingBufferRecord_xRecordItems(len) > (ring_buffer->ring_buffer.size / 2)))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    record_items = RingBufferRecord_xRecordItems(len);
+
+    (void)RingBuffer_enReserve(&ring_buffer->ring_buffer, record_items, &first, &second, &reserved);
+
+    if(reserved < record_items)
+    {
+        return RING_BUFFER_ERROR_FULL;
+    }
+
+    if(first.count >= record_items)
+    {
+        header = first.data;
+        padding = 0;
+    }
+    else
+    {
+        /*  record doesn't fit before the end of ring buffer data, reserve padding up to the end too  */
+        padding = first.count;
+
+        (void)RingBuffer_enReserve(&ring_buffer->ring_buffer, (RingBuffer_Counter_t)(padding + record_items), &first, &second, &reserved);
+
+        if(reserved < (RingBuffer_Counter_t)(padding + record_items))
+        {
+            return RING_BUFFER_ERROR_FULL;
+        }
+
+        if(padding >= RING_BUFFER_RECORD_HEADER_ITEMS)
+        {
+            RingBuffer_Counter_t padding_length = RING_BUFFER_RECORD_PADDING;
+
+            memcpy(first.data, &padding_length, sizeof(RingBuffer_Counter_t));
+        }
+
+        header = second.data;
+    }
+
+    memcpy(header, &len, sizeof(RingBuffer_Counter_t));
+    memcpy(&header[RING_BUFFER_RECORD_HEADER_ITEMS], items, len * sizeof(RingBuffer_Item_t));
+
+    return RingBuffer_enCommit(&ring_buffer->ring_buffer, (RingBuffer_Counter_t)(padding + record_items));
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferRecord_enGetRecord(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const record_len)
+{
+    RingBuffer_Item_t * header;
+    RingBuffer_Counter_t padding;
+    RingBuffer_Counter_t length;
+    RingBuffer_Error_t error;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(items) || IS_NULLPTR(record_len))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    error = RingBufferRecord_xFront(ring_buffer, &header, &padding);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        (*record_len) = 0;
+        return error;
+    }
+
+    length = RingBufferRecord_xLength(header);
+    (*record_len) = length;
+
+    if(len < length)
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(items, &header[RING_BUFFER_RECORD_HEADER_ITEMS], length * sizeof(RingBuffer_Item_t));
+
+    return RingBuffer_enRelease(&ring_buffer->ring_buffer, (RingBuffer_Counter_t)(padding + RingBufferRecord_xRecordItems(length)));
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferRecord_enPeekRecord(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t ** const record, RingBuffer_Counter_t * const record_len)
+{
+    RingBuffer_Item_t * header;
+    RingBuffer_Counter_t padding;
+    RingBuffer_Error_t error;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(record) || IS_NULLPTR(record_len))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    error = RingBufferRecord_xFront(ring_buffer, &header, &padding);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        (*record_len) = 0;
+        return error;
+    }
+
+    (*record) = &header[RING_BUFFER_RECORD_HEADER_ITEMS];
+    (*record_len) = RingBufferRecord_xLength(header);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferRecord_enSkipRecord(RingBufferRecord_t * const ring_buffer)
+{
+    RingBuffer_Item_t * header;
+    RingBuffer_Counter_t padding;
+    RingBuffer_Error_t error;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    error = RingBufferRecord_xFront(ring_buffer, &header, &padding);
+
+    if(error != RING_BUFFER_ERROR_NONE)
+    {
+        return error;
+    }
+
+    return RingBuffer_enRelease(&ring_buffer->ring_buffer, (RingBuffer_Counter_t)(padding + RingBufferRecord_xRecordItems(RingBufferRecord_xLength(header))));
+}
@@ -0,0 +1,190 @@
+/******************************************************************************
+ * @file      ring_buffer_record.h
+ * @brief     A Lock free, SPSC (Single Producer Single Consumer),
+ *            variable length records FIFO (First In, First Out) ring buffer.
+ *
+ * @details   Record ring buffer is a ring buffer (#RingBuffer_t) of variable length
+ *            records (messages), instead of single items:
+ *              - Each record is stored as a length header, followed by the record items
+ *              - A record is always contiguous in ring buffer data: when a record doesn't
+ *              fit before the end of ring buffer data, the remaining locations are filled
+ *              with padding, and the record is stored at the start of ring buffer data
+ *              - Records start at a multiple of #RING_BUFFER_RECORD_ALIGNMENT items
+ *
+ *            The consumer reads a record in place, with a single pointer to its items
+ *            (RingBufferRecord_enPeekRecord()), or copies it (RingBufferRecord_enGetRecord()).
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_RECORD_H__
+#define __RING_BUFFER_RECORD_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferRecord Lock free SPSC (Single Producer, Single Consumer) records ring buffer
+ * @brief Lock free SPSC (Single Producer, Single Consumer) variable length records ring buffer
+ * @details   Length prefixed records, kept contiguous in ring buffer data using wrap padding.
+ * @{
+ * */
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------- Configuration Macros ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Record alignment, in ring buffer items.
+ *
+ * Record items start at a multiple of #RING_BUFFER_RECORD_ALIGNMENT items from the start of ring buffer data,
+ * so records can be accessed in place as larger types (when ring buffer data is aligned).
+ *
+ * @note Must be a power of 2, ring buffer size must be a multiple of #RING_BUFFER_RECORD_ALIGNMENT
+ *
+ * @note 1 (no alignment) by default, can be set during build: `-DRING_BUFFER_RECORD_ALIGNMENT=8`
+ *
+ * */
+#ifndef RING_BUFFER_RECORD_ALIGNMENT
+#define RING_BUFFER_RECORD_ALIGNMENT    1
+#endif /*  RING_BUFFER_RECORD_ALIGNMENT  */
+
+/**
+ * @brief Number of items used by a record header (record length), rounded up to #RING_BUFFER_RECORD_ALIGNMENT
+ * */
+#define RING_BUFFER_RECORD_HEADER_ITEMS     RING_BUFFER_RECORD_ALIGN((sizeof(RingBuffer_Counter_t) + sizeof(RingBuffer_Item_t) - 1) / sizeof(RingBuffer_Item_t))
+
+/**
+ * @brief Round @p count up to a multiple of #RING_BUFFER_RECORD_ALIGNMENT
+ * */
+#define RING_BUFFER_RECORD_ALIGN(count)     (((count) + (RING_BUFFER_RECORD_ALIGNMENT - 1)) & ~(RING_BUFFER_RECORD_ALIGNMENT - 1))
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Record ring buffer structure
+ */
+typedef struct RingBufferRecord_t {
+    RingBuffer_t ring_buffer;               /**<  ring buffer, holding records headers, items and padding  */
+} RingBufferRecord_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize record ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to record ring buffer object
+ * @param [in] data         : pointer to an array of items used for ring buffer's data storage
+ * @param [in] size         : size of ring buffer data, must be a multiple of #RING_BUFFER_RECORD_ALIGNMENT,
+ *                            and meet ring buffer size requirements (RingBuffer_enInit())
+ *
+ * @pre @p ring_buffer and @p data are not null
+ *
+ * @post @p ring_buffer instance is initialized, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p data is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size can't hold a record of 1 item in half of it, or is not a multiple of #RING_BUFFER_RECORD_ALIGNMENT
+ *
+ */
+RingBuffer_Error_t RingBufferRecord_enInit(RingBufferRecord_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size);
+
+
+/** @brief Put a record into record ring buffer
+ *
+ * @param [in] ring_buffer  : pointer to record ring buffer object
+ * @param [in] items        : pointer to record items
+ * @param [in] len          : number of record items
+ *
+ * @note A record uses `RING_BUFFER_RECORD_ALIGN(RING_BUFFER_RECORD_HEADER_ITEMS + len)` items of ring buffer data,
+ *       plus padding up to the end of ring buffer data when it doesn't fit before the end.
+ *       It can use at most half of ring buffer data, so it always fits once older records are read.
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @post the record is added to @p ring_buffer, or nothing is added if it doesn't fit
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p items is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0, or the record uses more than half of ring buffer data
+ *         - #RING_BUFFER_ERROR_FULL            : @p ring_buffer doesn't have enough contiguous free space for the record
+ *
+ */
+RingBuffer_Error_t RingBufferRecord_enPutRecord(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len);
+
+
+/** @brief Get the oldest record from record ring buffer
+ *
+ * @param [in] ring_buffer  : pointer to record ring buffer object
+ * @param [out] items       : pointer to an array of items to copy record items into
+ * @param [in] len          : number of items in @p items
+ * @param [out] record_len  : pointer to ring buffer counter variable to store number of record items
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @post the oldest record is copied into @p items and removed from @p ring_buffer
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p items or @p record_len is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is less than the record length, the record is not removed,
+ *                                                and @p record_len contains its length
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferRecord_enGetRecord(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len, RingBuffer_Counter_t * const record_len);
+
+
+/** @brief Get the oldest record in record ring buffer, in place (zero copy read)
+ *
+ * @param [in] ring_buffer  : pointer to record ring buffer object
+ * @param [out] record      : pointer to pointer to RingBuffer_Item_t to store address of record items, in ring buffer data
+ * @param [out] record_len  : pointer to ring buffer counter variable to store number of record items
+ *
+ * @note Record items are contiguous, they're valid until the record is removed using RingBufferRecord_enSkipRecord()
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p record or @p record_len is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferRecord_enPeekRecord(RingBufferRecord_t * const ring_buffer, RingBuffer_Item_t ** const record, RingBuffer_Counter_t * const record_len);
+
+
+/** @brief Remove the oldest record from record ring buffer
+ *
+ * @param [in] ring_buffer  : pointer to record ring buffer object
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer is empty
+ *
+ */
+RingBuffer_Error_t RingBufferRecord_enSkipRecord(RingBufferRecord_t * const ring_buffer);
+
+/* ------------------------------------------------------------------------- */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_RECORD_H__ */
@@ -0,0 +1,448 @@
+/******************************************************************************
+ * @file      ring_buffer_uring.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_uring/ring_buffer_uring.h"
+
+#if RING_BUFFER_URING
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* ---------------------------------------------------------------------------
+ *
+ * io_uring queues are shared with the kernel:
+ * - the engine writes submission queue entries, then publishes the submission queue tail with release ordering
+ * - the kernel publishes the completion queue tail, the engine loads it with acquire ordering before reading
+ *   completion queue entries, then publishes the completion queue head with release ordering
+ *
+ * Each channel has at most one request in flight, so its ring buffer spans are reserved/acquired when
+ * the request is queued, and committed/released when it completes, like a single producer/consumer.
+ * Request user data is the channel index.
+ *
+ * Only whole items are committed/released. When a request ends in the middle of an item, the channel keeps
+ * the bytes of the item already transferred (partial), they stay in the free location (read) or in the oldest
+ * item (write), owned by the engine, and the next request starts after them.
+ *
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief io_uring_setup() system call
+ */
+static inline int RingBufferUring_xSetup(uint32_t entries, struct io_uring_params * const params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief io_uring_enter() system call, retried when interrupted
+ */
+static inline int RingBufferUring_xEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags)
+{
+    int result;
+
+    do
+    {
+        result = (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, NULL, 0);
+    } while((result < 0) && (errno == EINTR));
+
+    return result;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get address of @p offset bytes in mapping @p base
+ */
+static inline void * RingBufferUring_xAt(void * const base, uint32_t offset)
+{
+    return &((uint8_t *)base)[offset];
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Unmap engine queues
+ */
+static void RingBufferUring_xUnmap(RingBufferUring_t * const engine)
+{
+    if(engine->sqes != NULL)
+    {
+        (void)munmap(engine->sqes, engine->sqes_size);
+    }
+
+    if(engine->cq_ring_size && (engine->cq_ring != NULL))
+    {
+        (void)munmap(engine->cq_ring, engine->cq_ring_size);
+    }
+
+    if(engine->sq_ring != NULL)
+    {
+        (void)munmap(engine->sq_ring, engine->sq_ring_size);
+    }
+
+    engine->sqes = NULL;
+    engine->cq_ring = NULL;
+    engine->sq_ring = NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Queue a request for channel @p index, when its ring buffer has free locations (read) or items (write),
+ *        after @p queued entries queued by the current submit
+ *
+ * @return 1 when a request is queued, 0 otherwise
+ */
+static uint8_t RingBufferUring_xQueue(RingBufferUring_t * const engine, uint32_t index, uint32_t queued)
+{
+    RingBufferUring_Channel_t * channel = &engine->channels[index];
+    RingBuffer_t * ring_buffer = channel->ring_buffer;
+    struct io_uring_sqe * sqe;
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t count;
+    uint32_t tail;
+    uint32_t slot;
+
+    if(channel->in_flight || channel->eof || channel->error)
+    {
+        return 0;
+    }
+
+    /*  all free locations or all items, errors other than full/empty are expected  */
+    if(channel->direction == RING_BUFFER_URING_READ)
+    {
+        (void)RingBuffer_enReserve(ring_buffer, ring_buffer->size, &first, &second, &count);
+    }
+    else
+    {
+        (void)RingBuffer_enAcquire(ring_buffer, ring_buffer->size, &first, &second, &count);
+    }
+
+    if(IS_ZERO(count))
+    {
+        return 0;
+    }
+
+    /*  resume after the bytes of a partial item, at the start of the first span  */
+    channel->iov[0].iov_base = (uint8_t *)first.data + channel->partial;
+    channel->iov[0].iov_len = ((size_t)first.count * sizeof(RingBuffer_Item_t)) - channel->partial;
+    channel->iov[1].iov_base = second.data;
+    channel->iov[1].iov_len = (size_t)second.count * sizeof(RingBuffer_Item_t);
+
+    /*  the engine is the only submission queue producer, queue depth is the number of channels  */
+    tail = (*engine->sq_tail) + queued;
+    slot = tail & engine->sq_mask;
+    sqe = &((struct io_uring_sqe *)engine->sqes)[slot];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = (channel->direction == RING_BUFFER_URING_READ) ? IORING_OP_READV : IORING_OP_WRITEV;
+    sqe->fd = channel->fd;
+    sqe->off = (uint64_t)channel->offset;
+    sqe->addr = (uint64_t)(uintptr_t)channel->iov;
+    sqe->len = IS_ZERO(second.count) ? 1 : 2;
+    sqe->user_data = index;
+
+    engine->sq_array[slot] = slot;
+    engine->to_submit++;
+    channel->in_flight = 1;
+
+    return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Process completion of @p channel request, with result @p result (bytes transferred, or -errno)
+ */
+static void RingBufferUring_xCompleted(RingBufferUring_Channel_t * const channel, int32_t result)
+{
+    RingBuffer_Counter_t count;
+    size_t bytes;
+
+    channel->in_flight = 0;
+
+    if(result < 0)
+    {
+        channel->error = -result;
+        return;
+    }
+
+    if(IS_ZERO(result) && (channel->direction == RING_BUFFER_URING_READ))
+    {
+        channel->eof = 1;
+        return;
+    }
+
+    /*  whole items only, the rest of a partial item is transferred by the next request  */
+    bytes = channel->partial + (size_t)result;
+    count = (RingBuffer_Counter_t)(bytes / sizeof(RingBuffer_Item_t));
+    channel->partial = bytes % sizeof(RingBuffer_Item_t);
+
+    if(channel->offset >= 0)
+    {
+        channel->offset += (int64_t)result;
+    }
+
+    if(channel->direction == RING_BUFFER_URING_READ)
+    {
+        (void)RingBuffer_enCommit(channel->ring_buffer, count);
+    }
+    else
+    {
+        (void)RingBuffer_enRelease(channel->ring_buffer, count);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferUring_enChannelInit(RingBufferUring_Channel_t * channel, RingBuffer_t * ring_buffer, int fd, RingBufferUring_Direction_t direction, int64_t offset)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(channel) || IS_NULLPTR(ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if((direction != RING_BUFFER_URING_READ) && (direction != RING_BUFFER_URING_WRITE))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    memset(channel, 0, sizeof(RingBufferUring_Channel_t));
+    channel->ring_buffer = ring_buffer;
+    channel->fd = fd;
+    channel->direction = direction;
+    channel->offset = (offset < 0) ? -1 : offset;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferUring_enInit(RingBufferUring_t * engine, RingBufferUring_Channel_t * const channels, uint32_t channel_count)
+{
+    struct io_uring_params params;
+    int saved_errno;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(engine) || IS_NULLPTR(channels))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(channel_count))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    memset(engine, 0, sizeof(RingBufferUring_t));
+    memset(&params, 0, sizeof(params));
+
+    engine->ring_fd = RingBufferUring_xSetup(channel_count, &params);
+
+    if(engine->ring_fd < 0)
+    {
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    engine->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    engine->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    engine->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        /*  completion queue ring shares submission queue ring mapping  */
+        engine->sq_ring_size = MAX(engine->sq_ring_size, engine->cq_ring_size);
+        engine->cq_ring_size = 0;
+    }
+
+    engine->sq_ring = mmap(NULL, engine->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, engine->ring_fd, IORING_OFF_SQ_RING);
+    engine->sq_ring = (engine->sq_ring == MAP_FAILED) ? NULL : engine->sq_ring;
+
+    if(engine->cq_ring_size)
+    {
+        engine->cq_ring = mmap(NULL, engine->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, engine->ring_fd, IORING_OFF_CQ_RING);
+        engine->cq_ring = (engine->cq_ring == MAP_FAILED) ? NULL : engine->cq_ring;
+    }
+    else
+    {
+        engine->cq_ring = engine->sq_ring;
+    }
+
+    engine->sqes = mmap(NULL, engine->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, engine->ring_fd, IORING_OFF_SQES);
+    engine->sqes = (engine->sqes == MAP_FAILED) ? NULL : engine->sqes;
+
+    if(IS_NULLPTR(engine->sq_ring) || IS_NULLPTR(engine->cq_ring) || IS_NULLPTR(engine->sqes))
+    {
+        saved_errno = errno;
+        RingBufferUring_xUnmap(engine);
+        (void)close(engine->ring_fd);
+        engine->ring_fd = -1;
+        errno = saved_errno;
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    engine->sq_head = (uint32_t *)RingBufferUring_xAt(engine->sq_ring, params.sq_off.head);
+    engine->sq_tail = (uint32_t *)RingBufferUring_xAt(engine->sq_ring, params.sq_off.tail);
+    engine->sq_array = (uint32_t *)RingBufferUring_xAt(engine->sq_ring, params.sq_off.array);
+    engine->sq_mask = *(uint32_t *)RingBufferUring_xAt(engine->sq_ring, params.sq_off.ring_mask);
+    engine->cq_head = (uint32_t *)RingBufferUring_xAt(engine->cq_ring, params.cq_off.head);
+    engine->cq_tail = (uint32_t *)RingBufferUring_xAt(engine->cq_ring, params.cq_off.tail);
+    engine->cqes = RingBufferUring_xAt(engine->cq_ring, params.cq_off.cqes);
+    engine->cq_mask = *(uint32_t *)RingBufferUring_xAt(engine->cq_ring, params.cq_off.ring_mask);
+
+    engine->channels = channels;
+    engine->channel_count = channel_count;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferUring_enSubmit(RingBufferUring_t * const engine)
+{
+    uint32_t queued = 0;
+    int submitted;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(engine) || IS_NULLPTR(engine->sq_ring))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    for(uint32_t i = 0; i < engine->channel_count; i++)
+    {
+        queued += RingBufferUring_xQueue(engine, i, queued);
+    }
+
+    if(IS_ZERO(engine->to_submit))
+    {
+        return RING_BUFFER_ERROR_NONE;
+    }
+
+    /*  publish queued entries to the kernel  */
+    __atomic_store_n(engine->sq_tail, (*engine->sq_tail) + queued, __ATOMIC_RELEASE);
+    engine->in_flight += queued;
+
+    submitted = RingBufferUring_xEnter(engine->ring_fd, engine->to_submit, 0, 0);
+
+    if(submitted < 0)
+    {
+        /*  entries stay published, they're submitted by the next call  */
+        return RING_BUFFER_ERROR_SYSTEM;
+    }
+
+    engine->to_submit -= (uint32_t)submitted;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferUring_enComplete(RingBufferUring_t * const engine, uint32_t wait_count, uint32_t * const complete_count)
+{
+    struct io_uring_cqe * cqe;
+    uint32_t head;
+    uint32_t tail;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(engine) || IS_NULLPTR(engine->cq_ring) || IS_NULLPTR(complete_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    (*complete_count) = 0;
+    wait_count = MIN(wait_count, engine->in_flight);
+
+    if(wait_count || engine->to_submit)
+    {
+        int submitted = RingBufferUring_xEnter(engine->ring_fd, engine->to_submit, wait_count, wait_count ? IORING_ENTER_GETEVENTS : 0);
+
+        if(submitted < 0)
+        {
+            return RING_BUFFER_ERROR_SYSTEM;
+        }
+
+        engine->to_submit -= (uint32_t)submitted;
+    }
+
+    head = (*engine->cq_head);
+    tail = __atomic_load_n(engine->cq_tail, __ATOMIC_ACQUIRE);
+
+    while(head != tail)
+    {
+        cqe = &((struct io_uring_cqe *)engine->cqes)[head & engine->cq_mask];
+
+        if(cqe->user_data < engine->channel_count)
+        {
+            RingBufferUring_xCompleted(&engine->channels[cqe->user_data], cqe->res);
+        }
+
+        head++;
+        engine->in_flight--;
+        (*complete_count)++;
+    }
+
+    __atomic_store_n(engine->cq_head, head, __ATOMIC_RELEASE);
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferUring_enDeinit(RingBufferUring_t * const engine)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(engine) || IS_NULLPTR(engine->sq_ring))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    if(engine->in_flight)
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+    RingBufferUring_xUnmap(engine);
+    (void)close(engine->ring_fd);
+    engine->ring_fd = -1;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_URING  */
@@ -0,0 +1,209 @@
+/******************************************************************************
+ * @file      ring_buffer_uring.h
+ * @brief     io_uring asynchronous I/O engine (Linux), feeding and draining ring buffers.
+ *
+ * @details   The engine keeps an io_uring read or write request in flight for each channel,
+ *            a ring buffer (#RingBuffer_t) bound to a file descriptor:
+ *              - Read channels (file descriptor -> ring buffer) read into the free locations of the
+ *              ring buffer (`IORING_OP_READV`, one `iovec` per free span), and add the items read on
+ *              completion, like RingBuffer_enAdvance()
+ *              - Write channels (ring buffer -> file descriptor) write the items of the ring buffer
+ *              (`IORING_OP_WRITEV`, one `iovec` per readable span), and remove the items written on
+ *              completion, like RingBuffer_enSkipItems()
+ *
+ *            Data is transferred in place, the engine thread is the producer of read channels' ring buffers,
+ *            and the consumer of write channels' ring buffers. It replaces a blocking thread per file
+ *            with one thread for all channels, and a single system call per submit/complete cycle.
+ *
+ * @note      Uses the kernel io_uring interface directly (`<linux/io_uring.h>`), liburing is not needed.
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_URING_H__
+#define __RING_BUFFER_URING_H__
+
+#include "ring_buffer/ring_buffer.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RING_BUFFER_URING_HEADER        1
+#endif /*  __has_include(<linux/io_uring.h>)  */
+#endif /*  __linux__ && __has_include  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferUring io_uring ring buffer I/O engine (Linux)
+ * @brief Asynchronous file descriptor ingest/drain of ring buffers, using io_uring
+ * @{
+ * */
+
+/**
+ * @brief io_uring engine is available, it needs Linux io_uring headers
+ * */
+#ifdef RING_BUFFER_URING_HEADER
+#define RING_BUFFER_URING               1
+#else
+#define RING_BUFFER_URING               0
+#endif /*  RING_BUFFER_URING_HEADER  */
+
+#if RING_BUFFER_URING
+
+#include <sys/uio.h>
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Channel direction
+ */
+typedef enum RingBufferUring_Direction_t {
+    RING_BUFFER_URING_READ,                 /**<  read from file descriptor into ring buffer  */
+    RING_BUFFER_URING_WRITE,                /**<  write from ring buffer to file descriptor  */
+} RingBufferUring_Direction_t;
+
+/**
+ * @brief Channel, a ring buffer bound to a file descriptor
+ */
+typedef struct RingBufferUring_Channel_t {
+    RingBuffer_t * ring_buffer;             /**<  ring buffer fed (read) or drained (write) by the channel  */
+    int fd;                                 /**<  file descriptor  */
+    RingBufferUring_Direction_t direction;  /**<  channel direction  */
+    int64_t offset;                         /**<  file offset of the next request, -1 for streams (pipes, sockets) and the current file position  */
+    struct iovec iov [2];                   /**<  request's ring buffer spans, valid while the request is in flight  */
+    size_t partial;                         /**<  bytes of the next item transferred by previous requests, the next request resumes after them  */
+    uint8_t in_flight;                      /**<  a request is in flight  */
+    uint8_t eof;                            /**<  end of file was reached (read channels)  */
+    int error;                              /**<  last request's error (`errno` value), 0 when there's no error  */
+} RingBufferUring_Channel_t;
+
+/**
+ * @brief io_uring engine structure
+ */
+typedef struct RingBufferUring_t {
+    int ring_fd;                            /**<  io_uring file descriptor  */
+    RingBufferUring_Channel_t * channels;   /**<  pointer to an array of channels  */
+    uint32_t channel_count;                 /**<  number of channels  */
+    uint32_t in_flight;                     /**<  number of requests in flight  */
+    uint32_t to_submit;                     /**<  number of queued requests, not submitted yet  */
+    void * sq_ring;                         /**<  submission queue ring mapping  */
+    void * cq_ring;                         /**<  completion queue ring mapping  */
+    void * sqes;                            /**<  submission queue entries mapping  */
+    size_t sq_ring_size;                    /**<  submission queue ring mapping size  */
+    size_t cq_ring_size;                    /**<  completion queue ring mapping size (0 when shared with submission queue ring)  */
+    size_t sqes_size;                       /**<  submission queue entries mapping size  */
+    uint32_t * sq_head;                     /**<  submission queue head (kernel)  */
+    uint32_t * sq_tail;                     /**<  submission queue tail (engine)  */
+    uint32_t * sq_array;                    /**<  submission queue index array  */
+    uint32_t sq_mask;                       /**<  submission queue mask  */
+    uint32_t * cq_head;                     /**<  completion queue head (engine)  */
+    uint32_t * cq_tail;                     /**<  completion queue tail (kernel)  */
+    void * cqes;                            /**<  completion queue entries  */
+    uint32_t cq_mask;                       /**<  completion queue mask  */
+} RingBufferUring_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize a channel
+ *
+ * @param [in] channel      : pointer to channel object
+ * @param [in] ring_buffer  : pointer to an initialized ring buffer
+ * @param [in] fd           : file descriptor
+ * @param [in] direction    : channel direction
+ * @param [in] offset       : file offset of the first request, -1 for streams (pipes, sockets) and the current file position
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p channel or @p ring_buffer is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p direction is invalid
+ *
+ */
+RingBuffer_Error_t RingBufferUring_enChannelInit(RingBufferUring_Channel_t * channel, RingBuffer_t * ring_buffer, int fd, RingBufferUring_Direction_t direction, int64_t offset);
+
+
+/** @brief Initialize io_uring engine instance.
+ *
+ * @param [in] engine           : pointer to engine object
+ * @param [in] channels         : pointer to an array of initialized channels
+ * @param [in] channel_count    : number of channels, sets io_uring queue depth
+ *
+ * @post @p engine io_uring is created, no request is in flight
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p engine or @p channels is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p channel_count is 0
+ *         - #RING_BUFFER_ERROR_SYSTEM          : io_uring setup failed, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferUring_enInit(RingBufferUring_t * engine, RingBufferUring_Channel_t * const channels, uint32_t channel_count);
+
+
+/** @brief Queue and submit a request for each idle channel
+ *
+ * @param [in] engine   : pointer to engine object
+ *
+ * @note A read channel gets a request when its ring buffer has free locations, and a write channel
+ *       gets a request when its ring buffer has items. Channels at end of file or with an error are idle.
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p engine is NULL, or @p engine was not initialized
+ *         - #RING_BUFFER_ERROR_SYSTEM          : submitting failed, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferUring_enSubmit(RingBufferUring_t * const engine);
+
+
+/** @brief Wait for at least @p wait_count completions, then process all completions
+ *
+ * @param [in] engine           : pointer to engine object
+ * @param [in] wait_count       : number of completions to wait for (0 doesn't wait), limited to requests in flight
+ * @param [out] complete_count  : pointer to variable to store number of processed completions
+ *
+ * @post ring buffers of completed requests are updated: items read are added, items written are removed.
+ *       A channel's end of file and errors are stored in the channel.
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p engine or @p complete_count is NULL, or @p engine was not initialized
+ *         - #RING_BUFFER_ERROR_SYSTEM          : waiting failed, `errno` holds the reason
+ *
+ */
+RingBuffer_Error_t RingBufferUring_enComplete(RingBufferUring_t * const engine, uint32_t wait_count, uint32_t * const complete_count);
+
+
+/** @brief Deinitialize io_uring engine instance.
+ *
+ * @param [in] engine   : pointer to engine object
+ *
+ * @pre no request is in flight (all completions were processed using RingBufferUring_enComplete())
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p engine is NULL, or @p engine was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : requests are in flight
+ *
+ */
+RingBuffer_Error_t RingBufferUring_enDeinit(RingBufferUring_t * const engine);
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  RING_BUFFER_URING  */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_URING_H__ */
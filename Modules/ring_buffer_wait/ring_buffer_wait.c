@@ -0,0 +1,366 @@
+/******************************************************************************
+ * @file      ring_buffer_wait.c
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright
+ *
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_wait/ring_buffer_wait.h"
+
+#if RING_BUFFER_WAIT
+
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+/* ---------------------------------------------------------------------------
+ *
+ * Parking (RING_BUFFER_WAIT_PARK), for the consumer (the producer is the same, with full/get):
+ * - consumer   : set consumer_parked, fence, check empty again, futex wait while consumer_parked is set
+ * - producer   : put items, fence, if consumer_parked is set, clear it and futex wake
+ *
+ * Both fences are sequentially consistent, so either the consumer sees the new items when it checks
+ * again, or the producer sees the consumer parked. A consumer only parks on an empty ring buffer,
+ * so only the put that makes it non-empty makes a system call.
+ *
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Deadline of operations that don't wait (timeout 0)
+ */
+#define RING_BUFFER_WAIT_NO_WAIT        0
+
+/**
+ * @brief Number of spins between deadline checks of the spin strategy
+ */
+#define RING_BUFFER_WAIT_CLOCK_SPINS    64
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Hint the processor that the caller is spinning
+ */
+static inline void RingBufferWait_xPause(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif /*  __x86_64__ || __i386__  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get monotonic time in nanoseconds
+ */
+static inline uint64_t RingBufferWait_xNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get deadline of an operation waiting up to @p timeout_ns
+ */
+static inline uint64_t RingBufferWait_xDeadline(uint64_t timeout_ns)
+{
+    uint64_t now;
+
+    if((timeout_ns == RING_BUFFER_WAIT_NO_WAIT) || (timeout_ns == RING_BUFFER_WAIT_FOREVER))
+    {
+        return timeout_ns;
+    }
+
+    now = RingBufferWait_xNow();
+
+    return (timeout_ns < (RING_BUFFER_WAIT_FOREVER - now)) ? (now + timeout_ns) : RING_BUFFER_WAIT_FOREVER;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Check whether the caller can continue: free locations for the producer, items for the consumer
+ */
+static inline uint8_t RingBufferWait_xReady(RingBufferWait_t * const ring_buffer, uint8_t producer)
+{
+    uint8_t blocked = TRUE;
+
+    if(producer)
+    {
+        (void)RingBuffer_enIsFull(&ring_buffer->ring_buffer, &blocked);
+    }
+    else
+    {
+        (void)RingBuffer_enIsEmpty(&ring_buffer->ring_buffer, &blocked);
+    }
+
+    return !blocked;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Park on @p parked until woken up by the other side, or until @p deadline
+ */
+static inline void RingBufferWait_xPark(RingBufferWait_t * const ring_buffer, RingBufferWait_Futex_t * const parked, uint8_t producer, uint64_t deadline)
+{
+    struct timespec timeout;
+    struct timespec * timeout_ptr = NULL;
+
+    atomic_store_explicit(parked, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if(RingBufferWait_xReady(ring_buffer, producer))
+    {
+        atomic_store_explicit(parked, 0, memory_order_relaxed);
+        return;
+    }
+
+    if(deadline != RING_BUFFER_WAIT_FOREVER)
+    {
+        uint64_t now = RingBufferWait_xNow();
+        uint64_t remaining = (deadline > now) ? (deadline - now) : 0;
+
+        timeout.tv_sec = (time_t)(remaining / 1000000000ULL);
+        timeout.tv_nsec = (long)(remaining % 1000000000ULL);
+        timeout_ptr = &timeout;
+    }
+
+    /*  returns right away if the other side already cleared parked, errors (timeout, interrupted) are checked by the caller  */
+    (void)syscall(SYS_futex, (uint32_t *)parked, FUTEX_WAIT_PRIVATE, 1, timeout_ptr, NULL, 0);
+
+    atomic_store_explicit(parked, 0, memory_order_relaxed);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Wake the other side up when it's parked on @p parked
+ */
+static inline void RingBufferWait_xWake(RingBufferWait_t * const ring_buffer, RingBufferWait_Futex_t * const parked)
+{
+    if(ring_buffer->strategy != RING_BUFFER_WAIT_PARK)
+    {
+        return;
+    }
+
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if(atomic_load_explicit(parked, memory_order_relaxed) && atomic_exchange_explicit(parked, 0, memory_order_relaxed))
+    {
+        (void)syscall(SYS_futex, (uint32_t *)parked, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Wait once, using the wait strategy of @p ring_buffer
+ *
+ * @param [in] spins    : number of times the caller already waited
+ *
+ * @return TRUE when the caller should check again, FALSE when @p deadline passed
+ */
+static uint8_t RingBufferWait_xWait(RingBufferWait_t * const ring_buffer, RingBufferWait_Futex_t * const parked, uint8_t producer, uint32_t spins, uint64_t deadline)
+{
+    if(deadline == RING_BUFFER_WAIT_NO_WAIT)
+    {
+        return FALSE;
+    }
+
+    if((ring_buffer->strategy == RING_BUFFER_WAIT_SPIN) || (spins < ring_buffer->spin_count))
+    {
+        RingBufferWait_xPause();
+
+        /*  reading the clock costs more than a check, read it once in a while  */
+        if((deadline == RING_BUFFER_WAIT_FOREVER) || ((spins % RING_BUFFER_WAIT_CLOCK_SPINS) != 0))
+        {
+            return TRUE;
+        }
+    }
+
+    if((deadline != RING_BUFFER_WAIT_FOREVER) && (RingBufferWait_xNow() >= deadline))
+    {
+        return FALSE;
+    }
+
+    if(spins >= ring_buffer->spin_count)
+    {
+        if(ring_buffer->strategy == RING_BUFFER_WAIT_YIELD)
+        {
+            sched_yield();
+        }
+        else if(ring_buffer->strategy == RING_BUFFER_WAIT_PARK)
+        {
+            RingBufferWait_xPark(ring_buffer, parked, producer, deadline);
+        }
+    }
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferWait_enInit(RingBufferWait_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size,
+                                         RingBufferWait_Strategy_t strategy, uint32_t spin_count)
+{
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(strategy > RING_BUFFER_WAIT_PARK)
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    ring_buffer->strategy = strategy;
+    ring_buffer->spin_count = spin_count;
+    atomic_store_explicit(&ring_buffer->consumer_parked, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring_buffer->producer_parked, 0, memory_order_relaxed);
+
+    return RingBuffer_enInit(&ring_buffer->ring_buffer, data, size);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferWait_enPutItem(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t const * const item, uint64_t timeout_ns)
+{
+    RingBuffer_Counter_t item_count;
+
+    return RingBufferWait_enPutItems(ring_buffer, item, 1, &item_count, timeout_ns);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferWait_enPutItems(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len,
+                                             RingBuffer_Counter_t * const item_count, uint64_t timeout_ns)
+{
+    RingBuffer_Counter_t total = 0;
+    RingBuffer_Counter_t count;
+    uint64_t deadline;
+    uint32_t spins = 0;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    deadline = RingBufferWait_xDeadline(timeout_ns);
+
+    for(;;)
+    {
+        (void)RingBuffer_enPutItems(&ring_buffer->ring_buffer, &items[total], (RingBuffer_Counter_t)(len - total), &count);
+
+        if(count)
+        {
+            total = (RingBuffer_Counter_t)(total + count);
+            RingBufferWait_xWake(ring_buffer, &ring_buffer->consumer_parked);
+
+            if(total == len)
+            {
+                break;
+            }
+
+            spins = 0;
+        }
+        else if(!RingBufferWait_xWait(ring_buffer, &ring_buffer->producer_parked, TRUE, spins++, deadline))
+        {
+            (*item_count) = total;
+            return RING_BUFFER_ERROR_FULL;
+        }
+    }
+
+    (*item_count) = total;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferWait_enGetItem(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t * const item, uint64_t timeout_ns)
+{
+    RingBuffer_Counter_t item_count;
+
+    return RingBufferWait_enGetItems(ring_buffer, item, 1, &item_count, timeout_ns);
+}
+
+/* ------------------------------------------------------------------------- */
+
+RingBuffer_Error_t RingBufferWait_enGetItems(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len,
+                                             RingBuffer_Counter_t * const item_count, uint64_t timeout_ns)
+{
+    RingBuffer_Counter_t count;
+    uint64_t deadline;
+    uint32_t spins = 0;
+
+#ifdef DEBUG_RING_BUFFER
+
+    if(IS_NULLPTR(ring_buffer) || IS_NULLPTR(ring_buffer->ring_buffer.data) || IS_NULLPTR(items) || IS_NULLPTR(item_count))
+    {
+        return RING_BUFFER_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(len))
+    {
+        return RING_BUFFER_ERROR_INVALID_PARAM;
+    }
+
+#endif /*  DEBUG_RING_BUFFER  */
+
+    deadline = RingBufferWait_xDeadline(timeout_ns);
+
+    for(;;)
+    {
+        (void)RingBuffer_enGetItems(&ring_buffer->ring_buffer, items, len, &count);
+
+        if(count)
+        {
+            RingBufferWait_xWake(ring_buffer, &ring_buffer->producer_parked);
+            break;
+        }
+
+        if(!RingBufferWait_xWait(ring_buffer, &ring_buffer->consumer_parked, FALSE, spins++, deadline))
+        {
+            (*item_count) = 0;
+            return RING_BUFFER_ERROR_EMPTY;
+        }
+    }
+
+    (*item_count) = count;
+
+    return RING_BUFFER_ERROR_NONE;
+}
+
+#endif /*  RING_BUFFER_WAIT  */
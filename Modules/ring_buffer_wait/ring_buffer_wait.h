@@ -0,0 +1,231 @@
+/******************************************************************************
+ * @file      ring_buffer_wait.h
+ * @brief     Blocking and timed SPSC (Single Producer Single Consumer) ring buffer,
+ *            with spin, spin then yield and spin then park (futex) wait strategies.
+ *
+ * @details   Wait ring buffer is a ring buffer (#RingBuffer_t) where put and get wait
+ *            for free locations or items, up to a timeout, instead of returning right away:
+ *              - #RING_BUFFER_WAIT_SPIN        : busy waits, with a pause instruction between checks,
+ *              lowest latency, uses a whole core while waiting
+ *              - #RING_BUFFER_WAIT_YIELD       : spins, then yields the processor between checks
+ *              - #RING_BUFFER_WAIT_PARK        : spins, then sleeps in the kernel (futex) until woken up
+ *
+ *            A parked consumer is woken up by the put that makes the ring buffer non-empty
+ *            (empty to non-empty transition), and a parked producer by the get that makes it
+ *            non-full, so puts and gets don't make system calls when the other side isn't parked.
+ *
+ *            Ring buffer functions can still be used on the embedded ring buffer, but they don't
+ *            wake the other side up.
+ *
+ * @note      Requires #RING_BUFFER_ATOMIC and Linux (futex).
+ *
+ * @version   1.0
+ * @date      Oct 16, 2026
+ * @copyright Licensed under The MIT License (MIT)
+ *
+ *****************************************************************************/
+#ifndef __RING_BUFFER_WAIT_H__
+#define __RING_BUFFER_WAIT_H__
+
+#include <stdint.h>
+#include "ring_buffer/ring_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RingBufferWait Blocking SPSC (Single Producer, Single Consumer) ring buffer
+ * @brief Blocking and timed SPSC (Single Producer, Single Consumer) ring buffer
+ * @details   Put/get wait using spin, spin then yield or spin then park (futex) strategies.
+ * @{
+ * */
+
+/**
+ * @brief Wait ring buffer is available, it needs atomic ring buffer pointers and Linux futexes
+ * */
+#if RING_BUFFER_ATOMIC && defined(__linux__)
+#define RING_BUFFER_WAIT                1
+#else
+#define RING_BUFFER_WAIT                0
+#endif /*  RING_BUFFER_ATOMIC && __linux__  */
+
+#if RING_BUFFER_WAIT
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------- Configuration Macros ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Timeout value to wait without a timeout
+ * */
+#define RING_BUFFER_WAIT_FOREVER        UINT64_MAX
+
+/**
+ * @brief Default number of checks before yield and park strategies stop spinning
+ *
+ * @note Can be set during build: `-DRING_BUFFER_WAIT_SPIN_COUNT=1000`
+ * */
+#ifndef RING_BUFFER_WAIT_SPIN_COUNT
+#define RING_BUFFER_WAIT_SPIN_COUNT     100
+#endif /*  RING_BUFFER_WAIT_SPIN_COUNT  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Type Definitions ---------------------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Wait strategies
+ */
+typedef enum RingBufferWait_Strategy_t {
+    RING_BUFFER_WAIT_SPIN = 0,              /**<  spin, with a pause instruction between checks  */
+    RING_BUFFER_WAIT_YIELD,                 /**<  spin, then yield the processor between checks  */
+    RING_BUFFER_WAIT_PARK,                  /**<  spin, then park (futex) until woken up by the other side  */
+} RingBufferWait_Strategy_t;
+
+/**
+ * @brief Futex word, a parked side waits on it while it's set
+ */
+#ifdef __cplusplus
+typedef std::atomic<uint32_t> RingBufferWait_Futex_t;
+#else
+typedef _Atomic uint32_t RingBufferWait_Futex_t;
+#endif /* __cplusplus */
+
+/**
+ * @brief Wait ring buffer structure
+ */
+typedef struct RingBufferWait_t {
+    RingBuffer_t ring_buffer;               /**<  ring buffer, holding items  */
+    RingBufferWait_Strategy_t strategy;     /**<  wait strategy, of both sides  */
+    uint32_t spin_count;                    /**<  number of checks before yielding or parking  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  consumer wait cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBufferWait_Futex_t consumer_parked; /**<  set while the consumer is parked, waiting for items  */
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  producer wait cache line  */
+    RING_BUFFER_CACHE_ALIGNED
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+    RingBufferWait_Futex_t producer_parked; /**<  set while the producer is parked, waiting for free locations  */
+} RingBufferWait_t;
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Function Declarations ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+
+/** @brief Initialize wait ring buffer instance.
+ *
+ * @param [in] ring_buffer  : pointer to wait ring buffer object
+ * @param [in] data         : pointer to an array of items used for ring buffer's data storage
+ * @param [in] size         : size of ring buffer data, must meet ring buffer size requirements (RingBuffer_enInit())
+ * @param [in] strategy     : wait strategy
+ * @param [in] spin_count   : number of checks before yielding or parking, #RING_BUFFER_WAIT_SPIN_COUNT is a good default
+ *
+ * @pre @p ring_buffer and @p data are not null
+ *
+ * @post @p ring_buffer instance is initialized, and is empty
+ *
+ * @return RingBuffer_Error_t :
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p data is NULL
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p size is not a valid ring buffer size, or @p strategy is not a wait strategy
+ *
+ */
+RingBuffer_Error_t RingBufferWait_enInit(RingBufferWait_t * ring_buffer, RingBuffer_Item_t const * const data, RingBuffer_Counter_t size,
+                                         RingBufferWait_Strategy_t strategy, uint32_t spin_count);
+
+
+/** @brief Put an item into wait ring buffer, waiting up to @p timeout_ns for a free location (producer)
+ *
+ * @param [in] ring_buffer  : pointer to wait ring buffer object
+ * @param [in] item         : pointer to item to put
+ * @param [in] timeout_ns   : maximum time to wait in nanoseconds, 0 doesn't wait, #RING_BUFFER_WAIT_FOREVER waits without a timeout
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_FULL            : @p ring_buffer stayed full until the timeout, the item is not added
+ *
+ */
+RingBuffer_Error_t RingBufferWait_enPutItem(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t const * const item, uint64_t timeout_ns);
+
+
+/** @brief Put @p len items into wait ring buffer, waiting up to @p timeout_ns for free locations (producer)
+ *
+ * @param [in] ring_buffer  : pointer to wait ring buffer object
+ * @param [in] items        : pointer to an array of items
+ * @param [in] len          : number of items to put
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items added
+ * @param [in] timeout_ns   : maximum time to wait in nanoseconds, 0 doesn't wait, #RING_BUFFER_WAIT_FOREVER waits without a timeout
+ *
+ * @note Items are added as free locations become available, the consumer can get the first items
+ *       before the last ones are added.
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error, all items are added
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p items or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0
+ *         - #RING_BUFFER_ERROR_FULL            : only @p item_count items were added until the timeout
+ *
+ */
+RingBuffer_Error_t RingBufferWait_enPutItems(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t const * const items, RingBuffer_Counter_t len,
+                                             RingBuffer_Counter_t * const item_count, uint64_t timeout_ns);
+
+
+/** @brief Get the oldest item from wait ring buffer, waiting up to @p timeout_ns for an item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to wait ring buffer object
+ * @param [out] item        : pointer to item to copy the oldest item into
+ * @param [in] timeout_ns   : maximum time to wait in nanoseconds, 0 doesn't wait, #RING_BUFFER_WAIT_FOREVER waits without a timeout
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer or @p item is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer stayed empty until the timeout
+ *
+ */
+RingBuffer_Error_t RingBufferWait_enGetItem(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t * const item, uint64_t timeout_ns);
+
+
+/** @brief Get up to @p len items from wait ring buffer, waiting up to @p timeout_ns for at least one item (consumer)
+ *
+ * @param [in] ring_buffer  : pointer to wait ring buffer object
+ * @param [out] items       : pointer to an array of items to copy items into
+ * @param [in] len          : maximum number of items to get
+ * @param [out] item_count  : pointer to ring buffer counter variable to store number of items copied
+ * @param [in] timeout_ns   : maximum time to wait in nanoseconds, 0 doesn't wait, #RING_BUFFER_WAIT_FOREVER waits without a timeout
+ *
+ * @note Returns as soon as items are available, like `read`, it doesn't wait for @p len items.
+ *
+ * @pre @p ring_buffer is initialized
+ *
+ * @return RingBuffer_Error_t
+ *         - #RING_BUFFER_ERROR_NONE            : no error, at least one item was copied
+ *         - #RING_BUFFER_ERROR_NULLPTR         : @p ring_buffer, @p items or @p item_count is NULL, or @p ring_buffer was not initialized
+ *         - #RING_BUFFER_ERROR_INVALID_PARAM   : @p len is 0
+ *         - #RING_BUFFER_ERROR_EMPTY           : @p ring_buffer stayed empty until the timeout
+ *
+ */
+RingBuffer_Error_t RingBufferWait_enGetItems(RingBufferWait_t * const ring_buffer, RingBuffer_Item_t * const items, RingBuffer_Counter_t len,
+                                             RingBuffer_Counter_t * const item_count, uint64_t timeout_ns);
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  RING_BUFFER_WAIT  */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __RING_BUFFER_WAIT_H__ */
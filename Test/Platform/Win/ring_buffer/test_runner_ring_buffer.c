@@ -5,6 +5,23 @@
 #include "utils/utils.h"
 #include "unity.h"
 #include "test_ring_buffer.h"
+#include "test_ring_buffer_mpsc.h"
+#include "test_ring_buffer_mpmc.h"
+#include "test_ring_buffer_broadcast.h"
+#include "test_ring_buffer_record.h"
+#include "test_ring_buffer_bip.h"
+#include "test_ring_buffer_mirror.h"
+#include "test_ring_buffer_fd.h"
+#include "test_ring_buffer_uring.h"
+#include "test_ring_buffer_lossy.h"
+#include "test_ring_buffer_wait.h"
+#include "test_ring_buffer_notify.h"
+#include "test_ring_buffer_find.h"
+#include "test_ring_buffer_reader.h"
+#include "test_ring_buffer_checksum.h"
+#include "test_ring_buffer_define.h"
+#include "test_ring_buffer_copy.h"
+#include "test_ring_buffer_cpp.h"
 
 
 void setUp(void)
@@ -20,6 +37,23 @@ int main(void)
     UNITY_BEGIN();
 
     test_ring_buffer();
+    test_ring_buffer_mpsc();
+    test_ring_buffer_mpmc();
+    test_ring_buffer_broadcast();
+    test_ring_buffer_record();
+    test_ring_buffer_bip();
+    test_ring_buffer_mirror();
+    test_ring_buffer_fd();
+    test_ring_buffer_uring();
+    test_ring_buffer_lossy();
+    test_ring_buffer_wait();
+    test_ring_buffer_notify();
+    test_ring_buffer_find();
+    test_ring_buffer_reader();
+    test_ring_buffer_checksum();
+    test_ring_buffer_define();
+    test_ring_buffer_copy();
+    test_ring_buffer_cpp();
 
     return UNITY_END();
 }
@@ -10,6 +10,65 @@
 
 #define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof(RingBuffer_Item_t))
 
+/*
+ * most test cases set ring buffer head & tail directly, producer & consumer
+ * cached copies of them (RING_BUFFER_CACHE_LINE_SIZE) must follow them.
+ * Free running counters (RING_BUFFER_FREE_RUNNING) are set as locations, a tail behind head is one lap ahead of it
+ * */
+static void test_RingBuffer_vSyncPointers(RingBuffer_t * const ring_buffer)
+{
+#if RING_BUFFER_FREE_RUNNING
+    if((RingBuffer_Counter_t)(ring_buffer->tail - ring_buffer->head) > ring_buffer->size)
+    {
+        ring_buffer->tail = ring_buffer->head + (RingBuffer_Counter_t)(ring_buffer->tail - ring_buffer->head) % ring_buffer->size;
+    }
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+
+#if RING_BUFFER_CACHE_LINE_SIZE
+    ring_buffer->head_cache = ring_buffer->head;
+    ring_buffer->tail_cache = ring_buffer->tail;
+#else
+    (void)ring_buffer;
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+}
+
+/*  location of ring buffer pointer @p pointer in ring buffer data (free running counters aren't wrapped)  */
+static RingBuffer_Counter_t test_RingBuffer_xLocation(RingBuffer_t const * const ring_buffer, RingBuffer_Counter_t pointer)
+{
+    return pointer % ring_buffer->size;
+}
+
+/*  full ring buffer, tail at location @p tail: head is one location after tail, or one lap behind it (free running counters)  */
+static void test_RingBuffer_vSetFull(RingBuffer_t * const ring_buffer, RingBuffer_Counter_t tail)
+{
+    ring_buffer->tail = tail;
+#if RING_BUFFER_FREE_RUNNING
+    ring_buffer->head = tail - ring_buffer->size;
+#else
+    ring_buffer->head = (tail + 1) % ring_buffer->size;
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+    test_RingBuffer_vSyncPointers(ring_buffer);
+}
+
+
+/*
+ * test cases for ring buffer pointers wrapping, most test cases use a ring buffer of TEST_RING_BUFFER_SIZE locations:
+ * 10 (not a power of 2), or 8 when ring buffer size must be a power of 2 (RING_BUFFER_POWER_OF_TWO)
+ * */
+#if RING_BUFFER_POWER_OF_TWO
+#define TEST_RING_BUFFER_SIZE   8
+#define TEST_RING_BUFFER_ITEMS  "abcdefg"
+#else
+#define TEST_RING_BUFFER_SIZE   10
+#define TEST_RING_BUFFER_ITEMS  "abcdefghi"
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+
+/*  number of items in a full ring buffer of @p size locations: a location is kept free, unless pointers are free running  */
+#if RING_BUFFER_FREE_RUNNING
+#define TEST_RING_BUFFER_CAPACITY(size)     (size)
+#else
+#define TEST_RING_BUFFER_CAPACITY(size)     ((size) - 1)
+#endif /*  RING_BUFFER_FREE_RUNNING  */
 
 /* ------------------------------------------------------------------------- */
 /* ------------------------ Test RingBuffer_enInit() ----------------------- */
@@ -18,7 +77,7 @@
 
 static void test_RingBuffer_enInit_NULL_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10];
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE];
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(NULL, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -141,9 +200,9 @@ static void test_RingBuffer_enPutItem_NULL_item(void)
 
 static void test_RingBuffer_enPutItem_head_lt_tail(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t items [10] = {0};
+    RingBuffer_Item_t items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     // initialize ring buffer
@@ -162,9 +221,11 @@ static void test_RingBuffer_enPutItem_head_lt_tail(void)
         {
             /*  tail [1:9]  */
             ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             uint32_t free_count = ring_buffer.size - ring_buffer.tail + ring_buffer.head - 1;
 
@@ -172,8 +233,8 @@ static void test_RingBuffer_enPutItem_head_lt_tail(void)
             {
                 error = RingBuffer_enPutItem(&ring_buffer, &items[i]);
                 TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                TEST_ASSERT_EQUAL(j, ring_buffer.head);
-                TEST_ASSERT_EQUAL((i + k + 1) % ring_buffer.size, ring_buffer.tail);
+                TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                TEST_ASSERT_EQUAL((i + k + 1) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             }
         }
     }
@@ -181,9 +242,9 @@ static void test_RingBuffer_enPutItem_head_lt_tail(void)
 
 static void test_RingBuffer_enPutItem_head_gt_tail(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t items [10] = {0};
+    RingBuffer_Item_t items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     // initialize ring buffer
@@ -203,21 +264,23 @@ static void test_RingBuffer_enPutItem_head_gt_tail(void)
             /*  head [2:9], tail [0:7]  */
             RingBuffer_enReset(&ring_buffer);
             ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enPutItem(&ring_buffer, &items[i]);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i + 1, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i + 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
 
 static void test_RingBuffer_enPutItem_head_eq_tail(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t items [10] = {0};
+    RingBuffer_Item_t items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     // initialize ring buffer
@@ -234,22 +297,23 @@ static void test_RingBuffer_enPutItem_head_eq_tail(void)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < ring_buffer.size - 1; j++)
         {
             error = RingBuffer_enPutItem(&ring_buffer, &items[i]);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL((i + j + 1) % ring_buffer.size, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL((i + j + 1) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
 
 static void test_RingBuffer_enPutItem_full_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t items [10] = {0};
+    RingBuffer_Item_t items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     // initialize ring buffer
@@ -264,13 +328,13 @@ static void test_RingBuffer_enPutItem_full_buffer(void)
 
     for(uint32_t i = 0; i < ring_buffer.size - 1; i++)
     {
-        ring_buffer.head = i + 1;
-        ring_buffer.tail = i;
+        test_RingBuffer_vSetFull(&ring_buffer, i);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enPutItem(&ring_buffer, &items[i]);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
-        TEST_ASSERT_EQUAL(i + 1, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     }
 }
 
@@ -354,8 +418,8 @@ static void test_RingBuffer_enPutItems_zero_items(void)
 
 static void test_RingBuffer_enPutItems_head_lt_tail(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {1, 2};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {1, 2};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Error_t error;
@@ -380,9 +444,11 @@ static void test_RingBuffer_enPutItems_head_lt_tail(void)
         {
             /*  tail [1:9]  */
             ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             uint32_t free_count = ring_buffer.size - ring_buffer.tail + ring_buffer.head - 1;
 
@@ -390,8 +456,8 @@ static void test_RingBuffer_enPutItems_head_lt_tail(void)
             {
                 error = RingBuffer_enPutItems(&ring_buffer, put_items, free_count, &put_count);
                 TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                TEST_ASSERT_EQUAL(j, ring_buffer.head);
-                TEST_ASSERT_EQUAL(((j + ring_buffer.size) - 1) % ring_buffer.size, ring_buffer.tail);
+                TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                TEST_ASSERT_EQUAL(((j + ring_buffer.size) - 1) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                 TEST_ASSERT_EQUAL(free_count, put_count);
             }
         }
@@ -400,8 +466,8 @@ static void test_RingBuffer_enPutItems_head_lt_tail(void)
 
 static void test_RingBuffer_enPutItems_head_gt_tail(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {1, 2};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {1, 2};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Error_t error;
@@ -423,16 +489,18 @@ static void test_RingBuffer_enPutItems_head_gt_tail(void)
     {
         /*  head [2:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i - 1; j++)
         {
             /*  tail [0:7]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enPutItems(&ring_buffer, put_items, i - j - 1, &put_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i - 1, ring_buffer.tail); // j + (i - j - 1) = i - 1
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail)); // j + (i - j - 1) = i - 1
             TEST_ASSERT_EQUAL(i - j - 1, put_count);
         }
     }
@@ -440,8 +508,8 @@ static void test_RingBuffer_enPutItems_head_gt_tail(void)
 
 static void test_RingBuffer_enPutItems_head_eq_tail(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {1, 2};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {1, 2};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Error_t error;
@@ -463,19 +531,20 @@ static void test_RingBuffer_enPutItems_head_eq_tail(void)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enPutItems(&ring_buffer, &put_items[i], ring_buffer.size - 1, &put_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL((ring_buffer.size - 1 + i) % ring_buffer.size, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL((ring_buffer.size - 1 + i) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
     }
 }
 
 static void test_RingBuffer_enPutItems_full_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {1, 2};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {1, 2};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Error_t error;
@@ -497,13 +566,13 @@ static void test_RingBuffer_enPutItems_full_buffer(void)
     for(i = 0; i < ring_buffer.size; i++)
     {
         RingBuffer_enReset(&ring_buffer);
-        ring_buffer.tail = i;
-        ring_buffer.head = (i + 1) % ring_buffer.size;
+        test_RingBuffer_vSetFull(&ring_buffer, i);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enPutItems(&ring_buffer, &put_items[i], ring_buffer.size - 1, &put_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
-        TEST_ASSERT_EQUAL((i + 1) % ring_buffer.size, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, put_count);
     }
 }
@@ -563,8 +632,8 @@ static void test_RingBuffer_enGetItem_NULL_item(void)
 static void test_RingBuffer_enGetItem_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item;
     RingBuffer_Error_t error;
     RingBuffer_Counter_t put_count;
@@ -574,24 +643,26 @@ static void test_RingBuffer_enGetItem_head_lt_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enGetItem(&ring_buffer, &get_item);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j + 1, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j + 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
@@ -599,8 +670,8 @@ static void test_RingBuffer_enGetItem_head_lt_tail(void)
 static void test_RingBuffer_enGetItem_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item;
     RingBuffer_Error_t error;
     RingBuffer_Counter_t put_count;
@@ -610,22 +681,24 @@ static void test_RingBuffer_enGetItem_head_gt_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
     {
         /*  head [1:9], tail [0:8]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
         ring_buffer.tail = i - 1;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < ring_buffer.size - 1; j++)
         {
             error = RingBuffer_enGetItem(&ring_buffer, &get_item);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL((i + j + 1) % ring_buffer.size, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i -1, ring_buffer.tail);
+            TEST_ASSERT_EQUAL((i + j + 1) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i -1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
@@ -633,8 +706,8 @@ static void test_RingBuffer_enGetItem_head_gt_tail(void)
 static void test_RingBuffer_enGetItem_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item;
     RingBuffer_Error_t error;
     RingBuffer_Counter_t put_count;
@@ -644,21 +717,22 @@ static void test_RingBuffer_enGetItem_head_eq_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < ring_buffer.size - 1; j++)
         {
             error = RingBuffer_enGetItem(&ring_buffer, &get_item);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
@@ -666,7 +740,7 @@ static void test_RingBuffer_enGetItem_head_eq_tail(void)
 static void test_RingBuffer_enGetItem_empty_buffer(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Item_t get_item;
     RingBuffer_Error_t error;
 
@@ -675,8 +749,8 @@ static void test_RingBuffer_enGetItem_empty_buffer(void)
 
     error = RingBuffer_enGetItem(&ring_buffer, &get_item);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
 }
 
 /* ------------------------------------------------------------------------- */
@@ -687,9 +761,9 @@ static void test_RingBuffer_enGetItem_empty_buffer(void)
 
 static void test_RingBuffer_enGetItems_NULL_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {0};
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t get_count = 0;
@@ -714,7 +788,7 @@ static void test_RingBuffer_enGetItems_NULL_buffer(void)
 
 static void test_RingBuffer_enGetItems_Uninit_buffer(void)
 {
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t get_count = 0;
     RingBuffer_Error_t error;
@@ -725,9 +799,9 @@ static void test_RingBuffer_enGetItems_Uninit_buffer(void)
 
 static void test_RingBuffer_enGetItems_NULL_items(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {0};
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t get_count = 0;
@@ -752,9 +826,9 @@ static void test_RingBuffer_enGetItems_NULL_items(void)
 
 static void test_RingBuffer_enGetItems_NULL_item_count(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {0};
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Error_t error;
@@ -778,9 +852,9 @@ static void test_RingBuffer_enGetItems_NULL_item_count(void)
 
 static void test_RingBuffer_enGetItems_zero_items(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {0};
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t get_count = 0;
@@ -808,9 +882,9 @@ static void test_RingBuffer_enGetItems_zero_items(void)
 static void test_RingBuffer_enGetItems_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Counter_t get_count;
     RingBuffer_Error_t error;
@@ -820,24 +894,26 @@ static void test_RingBuffer_enGetItems_head_lt_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enGetItems(&ring_buffer, get_items, i - j, &get_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
             TEST_ASSERT_EQUAL(i - j, get_count);
         }
     }
@@ -846,9 +922,9 @@ static void test_RingBuffer_enGetItems_head_lt_tail(void)
 static void test_RingBuffer_enGetItems_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Counter_t get_count;
     RingBuffer_Error_t error;
@@ -858,8 +934,8 @@ static void test_RingBuffer_enGetItems_head_gt_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
@@ -868,12 +944,14 @@ static void test_RingBuffer_enGetItems_head_gt_tail(void)
         {
             /*  head [1:9], tail [0:head - 1]  */
             ring_buffer.head = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enGetItems(&ring_buffer, get_items, ring_buffer.size - ( i - j), &get_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(j, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(ring_buffer.size - (i - j), get_count);
         }
     }
@@ -882,9 +960,9 @@ static void test_RingBuffer_enGetItems_head_gt_tail(void)
 static void test_RingBuffer_enGetItems_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Counter_t get_count;
     RingBuffer_Error_t error;
@@ -894,19 +972,20 @@ static void test_RingBuffer_enGetItems_head_eq_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 0; i < ring_buffer.size - 1; i++)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.tail = ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enGetItems(&ring_buffer, get_items, LOCAL_ARRAY_LEN(get_items) - 1, &get_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, get_count);
     }
 }
@@ -914,8 +993,8 @@ static void test_RingBuffer_enGetItems_head_eq_tail(void)
 static void test_RingBuffer_enGetItems_empty_buffer(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t get_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t get_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t get_count;
     RingBuffer_Error_t error;
 
@@ -924,8 +1003,8 @@ static void test_RingBuffer_enGetItems_empty_buffer(void)
 
     error = RingBuffer_enGetItems(&ring_buffer, get_items, LOCAL_ARRAY_LEN(get_items) - 1, &get_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(0, get_count);
 }
 
@@ -1014,9 +1093,9 @@ static void test_RingBuffer_enPeekItems_Zero_items(void)
 static void test_RingBuffer_enPeekItems_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
-    RingBuffer_Item_t peek_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
+    RingBuffer_Item_t peek_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Counter_t peek_count;
     RingBuffer_Error_t error;
@@ -1026,20 +1105,22 @@ static void test_RingBuffer_enPeekItems_head_lt_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         /*  offset [0:8], len [9:1]  */
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             /*  offset [0:i - j - 1], len [1:i - j]  */
             for(uint32_t offset = 0; offset < i - j; offset++)
@@ -1048,8 +1129,8 @@ static void test_RingBuffer_enPeekItems_head_lt_tail(void)
                 {
                     error = RingBuffer_enPeekItems(&ring_buffer, peek_items, len, offset, &peek_count);
                     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                    TEST_ASSERT_EQUAL(j, ring_buffer.head);
-                    TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                    TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                     TEST_ASSERT_EQUAL(len, peek_count);
                 }
             }
@@ -1060,9 +1141,9 @@ static void test_RingBuffer_enPeekItems_head_lt_tail(void)
 static void test_RingBuffer_enPeekItems_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
-    RingBuffer_Item_t peek_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
+    RingBuffer_Item_t peek_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Counter_t peek_count;
     RingBuffer_Error_t error;
@@ -1072,8 +1153,8 @@ static void test_RingBuffer_enPeekItems_head_gt_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
@@ -1082,7 +1163,9 @@ static void test_RingBuffer_enPeekItems_head_gt_tail(void)
         {
             /*  head [1:9], tail [0:head - 1]  */
             ring_buffer.head = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             /*  offset [0:i - j], len [i - j:1]  */
             for(uint32_t offset = 0; offset < ring_buffer.size - i + j; offset++)
@@ -1091,8 +1174,8 @@ static void test_RingBuffer_enPeekItems_head_gt_tail(void)
                 {
                     error = RingBuffer_enPeekItems(&ring_buffer, peek_items, len, offset, &peek_count);
                     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                    TEST_ASSERT_EQUAL(i, ring_buffer.head);
-                    TEST_ASSERT_EQUAL(j, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                    TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                     TEST_ASSERT_EQUAL(len, peek_count);
                 }
             }
@@ -1103,9 +1186,9 @@ static void test_RingBuffer_enPeekItems_head_gt_tail(void)
 static void test_RingBuffer_enPeekItems_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = "abcdefghi";
-    RingBuffer_Item_t peek_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = TEST_RING_BUFFER_ITEMS;
+    RingBuffer_Item_t peek_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t put_count;
     RingBuffer_Counter_t peek_count;
     RingBuffer_Error_t error;
@@ -1115,13 +1198,14 @@ static void test_RingBuffer_enPeekItems_head_eq_tail(void)
 
     error = RingBuffer_enPutItems(&ring_buffer, put_items, LOCAL_ARRAY_LEN(put_items) - 1, &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL(ring_buffer.size - 1, put_count);
 
     for(uint32_t i = 1; i < ring_buffer.size; i++)
     {
         ring_buffer.tail = ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         /*  offset [0:8], len [9:1]  */
         for(uint32_t j = 0; j < ring_buffer.size - 1; j++)
@@ -1132,8 +1216,8 @@ static void test_RingBuffer_enPeekItems_head_eq_tail(void)
                 {
                     error = RingBuffer_enPeekItems(&ring_buffer, peek_items, len, offset, &peek_count);
                     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-                    TEST_ASSERT_EQUAL(i, ring_buffer.head);
-                    TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                    TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                     TEST_ASSERT_EQUAL(0, peek_count);
                 }
             }
@@ -1144,8 +1228,8 @@ static void test_RingBuffer_enPeekItems_head_eq_tail(void)
 static void test_RingBuffer_enPeekItems_empty_buffer(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t peek_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t peek_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t peek_count;
     RingBuffer_Error_t error;
 
@@ -1157,8 +1241,8 @@ static void test_RingBuffer_enPeekItems_empty_buffer(void)
     {
         error = RingBuffer_enPeekItems(&ring_buffer, peek_items, LOCAL_ARRAY_LEN(peek_items) - j - 1, j, &peek_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-        TEST_ASSERT_EQUAL(0, ring_buffer.head);
-        TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, peek_count);
     }
 }
@@ -1212,8 +1296,8 @@ static void test_RingBuffer_enBlockReadAddress_NULL_address(void)
 
 static void test_RingBuffer_enBlockReadAddress(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Item_t get_item = {0};
     RingBuffer_Counter_t put_count = 0;
@@ -1235,8 +1319,8 @@ static void test_RingBuffer_enBlockReadAddress(void)
     // put items in ring buffer
     error = RingBuffer_enPutItems(&ring_buffer, put_items, (LOCAL_ARRAY_LEN(put_items) - 1), &put_count);
     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-    TEST_ASSERT_EQUAL(0, ring_buffer.head);
-    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+    TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
     TEST_ASSERT_EQUAL((LOCAL_ARRAY_LEN(put_items) - 1), put_count);
 
     for(i = 0; i < ring_buffer.size - 1; i++)
@@ -1244,9 +1328,9 @@ static void test_RingBuffer_enBlockReadAddress(void)
         // get block read address from ring buffer
         error = RingBuffer_enBlockReadAddress(&ring_buffer, &read_address);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
-        TEST_ASSERT_EQUAL((RingBuffer_Item_t *)(ring_buffer.data + ring_buffer.head), read_address);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(ring_buffer.size - 1, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+        TEST_ASSERT_EQUAL((RingBuffer_Item_t *)(ring_buffer.data + test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head)), read_address);
 
         // get an item from ring buffer
         error = RingBuffer_enGetItem(&ring_buffer, &get_item);
@@ -1262,8 +1346,8 @@ static void test_RingBuffer_enBlockReadAddress(void)
 
 static void test_RingBuffer_enBlockReadCount_NULL_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t block_read_count = 0;
     RingBuffer_Counter_t put_count = 0;
@@ -1292,8 +1376,8 @@ static void test_RingBuffer_enBlockReadCount_Uninit_buffer(void)
 
 static void test_RingBuffer_enBlockReadCount_NULL_count(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Error_t error;
@@ -1314,7 +1398,7 @@ static void test_RingBuffer_enBlockReadCount_NULL_count(void)
 static void test_RingBuffer_enBlockReadCount_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t read_count;
     RingBuffer_Error_t error;
 
@@ -1325,16 +1409,18 @@ static void test_RingBuffer_enBlockReadCount_head_lt_tail(void)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enBlockReadCount(&ring_buffer, &read_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(i - j, read_count);
         }
     }
@@ -1343,7 +1429,7 @@ static void test_RingBuffer_enBlockReadCount_head_lt_tail(void)
 static void test_RingBuffer_enBlockReadCount_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t read_count;
     RingBuffer_Error_t error;
 
@@ -1354,16 +1440,18 @@ static void test_RingBuffer_enBlockReadCount_head_gt_tail(void)
     {
         /*  tail [0:8]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = i + 1; j < ring_buffer.size; j++)
         {
             /*  head [1:9]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enBlockReadCount(&ring_buffer, &read_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(ring_buffer.size - j, read_count);
         }
     }
@@ -1372,7 +1460,7 @@ static void test_RingBuffer_enBlockReadCount_head_gt_tail(void)
 static void test_RingBuffer_enBlockReadCount_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t read_count;
     RingBuffer_Error_t error;
 
@@ -1383,11 +1471,12 @@ static void test_RingBuffer_enBlockReadCount_head_eq_tail(void)
     {
         /*  head [0:9], tail [0,9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enBlockReadCount(&ring_buffer, &read_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, read_count);
     }
 }
@@ -1395,7 +1484,7 @@ static void test_RingBuffer_enBlockReadCount_head_eq_tail(void)
 static void test_RingBuffer_enBlockReadCount_empty_buffer(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t read_count;
     RingBuffer_Error_t error;
 
@@ -1406,11 +1495,12 @@ static void test_RingBuffer_enBlockReadCount_empty_buffer(void)
     {
         /*  head [0:9], tail [0,9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enBlockReadCount(&ring_buffer, &read_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, read_count);
     }
 }
@@ -1423,8 +1513,8 @@ static void test_RingBuffer_enBlockReadCount_empty_buffer(void)
 
 static void test_RingBuffer_enBlockWriteAddress_NULL_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Item_t * write_address = NULL;
@@ -1458,8 +1548,8 @@ static void test_RingBuffer_enBlockWriteAddress_Uninit_buffer(void)
 
 static void test_RingBuffer_enBlockWriteAddress_NULL_address(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
@@ -1484,7 +1574,7 @@ static void test_RingBuffer_enBlockWriteAddress_NULL_address(void)
 static void test_RingBuffer_enBlockWriteAddress_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Item_t * write_address;
     RingBuffer_Error_t error;
 
@@ -1495,17 +1585,19 @@ static void test_RingBuffer_enBlockWriteAddress_head_lt_tail(void)
     {
         /*  tail [1: 9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enBlockWriteAddress(&ring_buffer, &write_address);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(&ring_buffer.data[ring_buffer.tail], write_address);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(&ring_buffer.data[test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail)], write_address);
         }
     }
 
@@ -1514,7 +1606,7 @@ static void test_RingBuffer_enBlockWriteAddress_head_lt_tail(void)
 static void test_RingBuffer_enBlockWriteAddress_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Item_t * write_address;
     RingBuffer_Error_t error;
 
@@ -1525,17 +1617,19 @@ static void test_RingBuffer_enBlockWriteAddress_head_gt_tail(void)
     {
         /*  head [1: 9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  tail [0: head - 1]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enBlockWriteAddress(&ring_buffer, &write_address);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL(j, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(&ring_buffer.data[ring_buffer.tail], write_address);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(&ring_buffer.data[test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail)], write_address);
         }
     }
 }
@@ -1543,7 +1637,7 @@ static void test_RingBuffer_enBlockWriteAddress_head_gt_tail(void)
 static void test_RingBuffer_enBlockWriteAddress_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Item_t * write_address;
     RingBuffer_Error_t error;
 
@@ -1554,20 +1648,22 @@ static void test_RingBuffer_enBlockWriteAddress_head_eq_tail(void)
     {
         /*  head [0: 9], tail [0:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enBlockWriteAddress(&ring_buffer, &write_address);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-        TEST_ASSERT_EQUAL(&ring_buffer.data[ring_buffer.tail], write_address);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+        TEST_ASSERT_EQUAL(&ring_buffer.data[test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail)], write_address);
     }
 }
 
 static void test_RingBuffer_enBlockWriteAddress_full_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Item_t * write_address;
     RingBuffer_Error_t error;
 
@@ -1577,14 +1673,14 @@ static void test_RingBuffer_enBlockWriteAddress_full_buffer(void)
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
         /*  head [0: 9], tail = (head + ring_buffer.size - 1) % ring_buffer.size  */
-        ring_buffer.head = i;
-        ring_buffer.tail = (ring_buffer.size + i - 1) % ring_buffer.size;
+        test_RingBuffer_vSetFull(&ring_buffer, (ring_buffer.size + i - 1) % ring_buffer.size);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enBlockWriteAddress(&ring_buffer, &write_address);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(((ring_buffer.size + i - 1) % ring_buffer.size), ring_buffer.tail);
-        TEST_ASSERT_EQUAL(&ring_buffer.data[ring_buffer.tail], write_address);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(((ring_buffer.size + i - 1) % ring_buffer.size), test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+        TEST_ASSERT_EQUAL(&ring_buffer.data[test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail)], write_address);
     }
 }
 
@@ -1596,8 +1692,8 @@ static void test_RingBuffer_enBlockWriteAddress_full_buffer(void)
 
 static void test_RingBuffer_enBlockWriteCount_NULL_buffer(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t block_write_count = 0;
@@ -1630,8 +1726,8 @@ static void test_RingBuffer_enBlockWriteCount_Uninit_buffer(void)
 
 static void test_RingBuffer_enBlockWriteCount_NULL_count(void)
 {
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Item_t get_item = {0};
     RingBuffer_t ring_buffer = {0};
     RingBuffer_Counter_t put_count = 0;
@@ -1656,8 +1752,8 @@ static void test_RingBuffer_enBlockWriteCount_NULL_count(void)
 static void test_RingBuffer_enBlockWriteCount_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t write_count;
     RingBuffer_Error_t error;
@@ -1671,16 +1767,18 @@ static void test_RingBuffer_enBlockWriteCount_head_lt_tail(void)
         {
             /*  tail [1: 9]  */
             ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             /*  head [0: tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enBlockWriteCount(&ring_buffer, &write_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
 
             if(j == 0)
             {
-                TEST_ASSERT_EQUAL(ring_buffer.size - i - 1, write_count);
+                TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size) - i, write_count);
             }
             else
             {
@@ -1692,15 +1790,15 @@ static void test_RingBuffer_enBlockWriteCount_head_lt_tail(void)
                 error = RingBuffer_enPutItems(&ring_buffer, put_items, write_count, &put_count);
                 TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
                 TEST_ASSERT_EQUAL(write_count, put_count);
-                TEST_ASSERT_EQUAL(j, ring_buffer.head);
+                TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
 
                 if(j == 0)
                 {
-                    TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(test_RingBuffer_xLocation(&ring_buffer, TEST_RING_BUFFER_CAPACITY(ring_buffer.size)), test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                 }
                 else
                 {
-                    TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                 }
             }
         }
@@ -1710,8 +1808,8 @@ static void test_RingBuffer_enBlockWriteCount_head_lt_tail(void)
 static void test_RingBuffer_enBlockWriteCount_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t write_count;
     RingBuffer_Error_t error;
@@ -1725,21 +1823,23 @@ static void test_RingBuffer_enBlockWriteCount_head_gt_tail(void)
         {
             /*  tail [1: 9]  */
             ring_buffer.head = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             /*  head [0: head - 1]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enBlockWriteCount(&ring_buffer, &write_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i - j - 1, write_count);
+            TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size) - (ring_buffer.size - i + j), write_count);
 
             if(write_count)
             {
                 error = RingBuffer_enPutItems(&ring_buffer, put_items, write_count, &put_count);
                 TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
                 TEST_ASSERT_EQUAL(write_count, put_count);
-                TEST_ASSERT_EQUAL(i, ring_buffer.head);
-                TEST_ASSERT_EQUAL((i + ring_buffer.size - 1) % ring_buffer.size, ring_buffer.tail);
+                TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                TEST_ASSERT_EQUAL((i + TEST_RING_BUFFER_CAPACITY(ring_buffer.size)) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             }
         }
     }
@@ -1748,8 +1848,8 @@ static void test_RingBuffer_enBlockWriteCount_head_gt_tail(void)
 static void test_RingBuffer_enBlockWriteCount_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t write_count;
     RingBuffer_Error_t error;
@@ -1761,12 +1861,13 @@ static void test_RingBuffer_enBlockWriteCount_head_eq_tail(void)
     {
         /*  head [0: 9], tail [0: 9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enBlockWriteCount(&ring_buffer, &write_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
         if(i == 0)
         {
-            TEST_ASSERT_EQUAL(ring_buffer.size - 1, write_count);
+            TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size), write_count);
         }
         else
         {
@@ -1776,14 +1877,14 @@ static void test_RingBuffer_enBlockWriteCount_head_eq_tail(void)
         error = RingBuffer_enPutItems(&ring_buffer, put_items, write_count, &put_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
         TEST_ASSERT_EQUAL(write_count, put_count);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
         if(i == 0)
         {
-            TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(test_RingBuffer_xLocation(&ring_buffer, TEST_RING_BUFFER_CAPACITY(ring_buffer.size)), test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
         else
         {
-            TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
@@ -1791,8 +1892,8 @@ static void test_RingBuffer_enBlockWriteCount_head_eq_tail(void)
 static void test_RingBuffer_enBlockWriteCount_buffer_empty(void)
 {
 RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
-    RingBuffer_Item_t put_items [] = "abcdefgh";
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
+    RingBuffer_Item_t put_items [] = TEST_RING_BUFFER_ITEMS;
     RingBuffer_Counter_t put_count = 0;
     RingBuffer_Counter_t write_count;
     RingBuffer_Error_t error;
@@ -1804,12 +1905,13 @@ RingBuffer_t ring_buffer = {0};
     {
         /*  head [0: 9], tail [0: 9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enBlockWriteCount(&ring_buffer, &write_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
         if(i == 0)
         {
-            TEST_ASSERT_EQUAL(ring_buffer.size - 1, write_count);
+            TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size), write_count);
         }
         else
         {
@@ -1819,14 +1921,14 @@ RingBuffer_t ring_buffer = {0};
         error = RingBuffer_enPutItems(&ring_buffer, put_items, write_count, &put_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
         TEST_ASSERT_EQUAL(write_count, put_count);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
         if(i == 0)
         {
-            TEST_ASSERT_EQUAL(ring_buffer.size - 1, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(test_RingBuffer_xLocation(&ring_buffer, TEST_RING_BUFFER_CAPACITY(ring_buffer.size)), test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
         else
         {
-            TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(0, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         }
     }
 }
@@ -1834,7 +1936,7 @@ RingBuffer_t ring_buffer = {0};
 static void test_RingBuffer_enBlockWriteCount_buffer_full(void)
 {
 RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t write_count;
     RingBuffer_Error_t error;
 
@@ -1844,8 +1946,7 @@ RingBuffer_t ring_buffer = {0};
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
         /*  tail [0: 9], head = (tail + 1)%ring_buffer.size  */
-        ring_buffer.head = ring_buffer.tail = i;
-        ring_buffer.head = (i + 1) % ring_buffer.size;
+        test_RingBuffer_vSetFull(&ring_buffer, i);
 
         error = RingBuffer_enBlockWriteCount(&ring_buffer, &write_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
@@ -1862,7 +1963,7 @@ RingBuffer_t ring_buffer = {0};
 static void test_RingBuffer_enSkipItems_NULL_skipped(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -1885,7 +1986,7 @@ static void test_RingBuffer_enSkipItems_Uninit_buffer(void)
 static void test_RingBuffer_enSkipItems_NULL_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     RingBuffer_Counter_t skip_count = 0;
 
@@ -1899,7 +2000,7 @@ static void test_RingBuffer_enSkipItems_NULL_buffer(void)
 static void test_RingBuffer_enSkipItems_Zero_Items(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t skip_count = 0;
     RingBuffer_Error_t error;
 
@@ -1915,7 +2016,7 @@ static void test_RingBuffer_enSkipItems_Zero_Items(void)
 static void test_RingBuffer_enSkipItems_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t skip_count;
     RingBuffer_Error_t error;
 
@@ -1926,6 +2027,7 @@ static void test_RingBuffer_enSkipItems_head_lt_tail(void)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
@@ -1933,12 +2035,13 @@ static void test_RingBuffer_enSkipItems_head_lt_tail(void)
             {
                 /*  head [0:tail - 1]  */
                 ring_buffer.head = j;
+                test_RingBuffer_vSyncPointers(&ring_buffer);
 
                 error = RingBuffer_enSkipItems(&ring_buffer, k, &skip_count);
 
                 TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-                TEST_ASSERT_EQUAL((j + k) % ring_buffer.size, ring_buffer.head);
+                TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+                TEST_ASSERT_EQUAL((j + k) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
                 TEST_ASSERT_EQUAL(k, skip_count);
             }
         }
@@ -1948,7 +2051,7 @@ static void test_RingBuffer_enSkipItems_head_lt_tail(void)
 static void test_RingBuffer_enSkipItems_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t skip_count;
     RingBuffer_Error_t error;
 
@@ -1961,6 +2064,7 @@ static void test_RingBuffer_enSkipItems_head_gt_tail(void)
         {
             /*  tail [0:head - 1]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             uint32_t item_count = ring_buffer.size - i + j - 1;
 
@@ -1968,11 +2072,12 @@ static void test_RingBuffer_enSkipItems_head_gt_tail(void)
             {
                 /*  head [1:9]  */
                 ring_buffer.head = i;
+                test_RingBuffer_vSyncPointers(&ring_buffer);
 
                 error = RingBuffer_enSkipItems(&ring_buffer, k, &skip_count);
                 TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                TEST_ASSERT_EQUAL(j, ring_buffer.tail);
-                TEST_ASSERT_EQUAL((i + k) % ring_buffer.size, ring_buffer.head);
+                TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+                TEST_ASSERT_EQUAL((i + k) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
                 TEST_ASSERT_EQUAL(k, skip_count);
             }
         }
@@ -1982,7 +2087,7 @@ static void test_RingBuffer_enSkipItems_head_gt_tail(void)
 static void test_RingBuffer_enSkipItems_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t skip_count;
     RingBuffer_Error_t error;
 
@@ -1993,13 +2098,14 @@ static void test_RingBuffer_enSkipItems_head_eq_tail(void)
     {
         /*  head = tail [0:9]  */
         ring_buffer.tail = ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t k = 1; k < ring_buffer.size; k++)
         {
             error = RingBuffer_enSkipItems(&ring_buffer, k, &skip_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
             TEST_ASSERT_EQUAL(0, skip_count);
         }
     }
@@ -2008,7 +2114,7 @@ static void test_RingBuffer_enSkipItems_head_eq_tail(void)
 static void test_RingBuffer_enSkipItems_empty_buffer(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t skip_count;
     RingBuffer_Error_t error;
 
@@ -2019,13 +2125,14 @@ static void test_RingBuffer_enSkipItems_empty_buffer(void)
     {
         /*  head = tail [0:9]  */
         ring_buffer.tail = ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t k = 1; k < ring_buffer.size; k++)
         {
             error = RingBuffer_enSkipItems(&ring_buffer, k, &skip_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
             TEST_ASSERT_EQUAL(0, skip_count);
         }
     }
@@ -2034,7 +2141,7 @@ static void test_RingBuffer_enSkipItems_empty_buffer(void)
 static void test_RingBuffer_enSkipItems_full_buffer(void)
 {
     RingBuffer_t ring_buffer;
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t skip_count;
     RingBuffer_Error_t error;
 
@@ -2045,16 +2152,18 @@ static void test_RingBuffer_enSkipItems_full_buffer(void)
     {
         /*  tail [0:9] */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t k = 1; k < ring_buffer.size; k++)
         {
             /* head = (tail + 1) % ring_buffer.size  */
-            ring_buffer.head = (i + 1) % ring_buffer.size;
+            test_RingBuffer_vSetFull(&ring_buffer, i);
+            RingBuffer_Counter_t head = ring_buffer.head;
 
             error = RingBuffer_enSkipItems(&ring_buffer, k, &skip_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-            TEST_ASSERT_EQUAL((i + 1 + k) % ring_buffer.size, ring_buffer.head);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(test_RingBuffer_xLocation(&ring_buffer, (RingBuffer_Counter_t)(head + k)), test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
             TEST_ASSERT_EQUAL(k, skip_count);
         }
     }
@@ -2069,7 +2178,7 @@ static void test_RingBuffer_enSkipItems_full_buffer(void)
 static void test_RingBuffer_enAdvance_NULL_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     RingBuffer_Counter_t advance_count = 0;
 
@@ -2092,7 +2201,7 @@ static void test_RingBuffer_enAdvance_Uninit_buffer(void)
 static void test_RingBuffer_enAdvance_NULL_advanced(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -2105,7 +2214,7 @@ static void test_RingBuffer_enAdvance_NULL_advanced(void)
 static void test_RingBuffer_enAdvance_Zero_Items(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     RingBuffer_Counter_t advance_count = 0;
 
@@ -2121,7 +2230,7 @@ static void test_RingBuffer_enAdvance_Zero_Items(void)
 static void test_RingBuffer_enAdvance_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t advance_count;
     RingBuffer_Error_t error;
 
@@ -2136,6 +2245,7 @@ static void test_RingBuffer_enAdvance_head_lt_tail(void)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             uint32_t free_count = ring_buffer.size - i + j - 1;
 
@@ -2145,11 +2255,12 @@ static void test_RingBuffer_enAdvance_head_lt_tail(void)
                 {
                     /*  tail [1:9]  */
                     ring_buffer.tail = i;
+                    test_RingBuffer_vSyncPointers(&ring_buffer);
 
                     error = RingBuffer_enAdvance(&ring_buffer, k, &advance_count);
                     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                    TEST_ASSERT_EQUAL(j, ring_buffer.head);
-                    TEST_ASSERT_EQUAL((i + k + ring_buffer.size) % ring_buffer.size, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                    TEST_ASSERT_EQUAL((i + k + ring_buffer.size) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                     TEST_ASSERT_EQUAL(k, advance_count);
                 }
             }
@@ -2160,7 +2271,7 @@ static void test_RingBuffer_enAdvance_head_lt_tail(void)
 static void test_RingBuffer_enAdvance_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t advance_count;
     RingBuffer_Error_t error;
 
@@ -2173,6 +2284,7 @@ static void test_RingBuffer_enAdvance_head_gt_tail(void)
     {
         /*  head [1:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for (uint32_t j = 0; j < i; j++)
         {
@@ -2184,11 +2296,12 @@ static void test_RingBuffer_enAdvance_head_gt_tail(void)
                 {
                     /*  tail [0: head - 1]  */
                     ring_buffer.tail = j;
+                    test_RingBuffer_vSyncPointers(&ring_buffer);
 
                     error = RingBuffer_enAdvance(&ring_buffer, k, &advance_count);
                     TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-                    TEST_ASSERT_EQUAL(i, ring_buffer.head);
-                    TEST_ASSERT_EQUAL((j + k + ring_buffer.size) % ring_buffer.size, ring_buffer.tail);
+                    TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+                    TEST_ASSERT_EQUAL((j + k + ring_buffer.size) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
                     TEST_ASSERT_EQUAL(k, advance_count);
                 }
             }
@@ -2199,7 +2312,7 @@ static void test_RingBuffer_enAdvance_head_gt_tail(void)
 static void test_RingBuffer_enAdvance_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t advance_count;
     RingBuffer_Error_t error;
 
@@ -2212,16 +2325,18 @@ static void test_RingBuffer_enAdvance_head_eq_tail(void)
     {
         /*  head [0:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t k = 1; k < ring_buffer.size; k++)
         {
             /*  tail [0: 9]  */
             ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enAdvance(&ring_buffer, k, &advance_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL((i + k + ring_buffer.size) % ring_buffer.size, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL((i + k + ring_buffer.size) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(k, advance_count);
         }
     }
@@ -2230,7 +2345,7 @@ static void test_RingBuffer_enAdvance_head_eq_tail(void)
 static void test_RingBuffer_enAdvance_empty_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t advance_count;
     RingBuffer_Error_t error;
 
@@ -2243,16 +2358,18 @@ static void test_RingBuffer_enAdvance_empty_buffer(void)
     {
         /*  head [0:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t k = 1; k < ring_buffer.size; k++)
         {
             /*  tail [0: 9]  */
             ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enAdvance(&ring_buffer, k, &advance_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL((i + k + ring_buffer.size) % ring_buffer.size, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL((i + k + ring_buffer.size) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(k, advance_count);
         }
     }
@@ -2261,7 +2378,7 @@ static void test_RingBuffer_enAdvance_empty_buffer(void)
 static void test_RingBuffer_enAdvance_full_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t advance_count;
     RingBuffer_Error_t error;
 
@@ -2272,15 +2389,14 @@ static void test_RingBuffer_enAdvance_full_buffer(void)
     // put items in ring buffer (fill ring buffer)
     for(uint32_t i = 1; i < ring_buffer.size; i++)
     {
-        /*  head [1:9]  */
-        ring_buffer.head = i;
-        /*  tail = ((head - 1) + ring_buffer.size) % ring_buffer.size  */
-        ring_buffer.tail = (ring_buffer.size + i - 1) % ring_buffer.size;
+        /*  head [1:9], tail = ((head - 1) + ring_buffer.size) % ring_buffer.size  */
+        test_RingBuffer_vSetFull(&ring_buffer, (ring_buffer.size + i - 1) % ring_buffer.size);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enAdvance(&ring_buffer, 1, &advance_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL((ring_buffer.size + i - 1) % ring_buffer.size, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL((ring_buffer.size + i - 1) % ring_buffer.size, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, advance_count);
     }
 }
@@ -2296,7 +2412,7 @@ static void test_RingBuffer_enAdvance_full_buffer(void)
 static void test_RingBuffer_enItemCount_NULL_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     RingBuffer_Counter_t item_count = 0;
 
@@ -2319,7 +2435,7 @@ static void test_RingBuffer_enItemCount_Uninit_buffer(void)
 static void test_RingBuffer_enItemCount_NULL_result(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -2334,7 +2450,7 @@ static void test_RingBuffer_enItemCount_NULL_result(void)
 static void test_RingBuffer_enItemCount_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t item_count = 0;
     RingBuffer_Error_t error;
 
@@ -2345,16 +2461,18 @@ static void test_RingBuffer_enItemCount_head_lt_tail(void)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0: tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enItemCount(&ring_buffer, &item_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(i - j, item_count);
         }
     }
@@ -2363,7 +2481,7 @@ static void test_RingBuffer_enItemCount_head_lt_tail(void)
 static void test_RingBuffer_enItemCount_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t item_count = 0;
     RingBuffer_Error_t error;
 
@@ -2374,11 +2492,12 @@ static void test_RingBuffer_enItemCount_head_gt_tail(void)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enItemCount(&ring_buffer, &item_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, item_count);
     }
 }
@@ -2386,7 +2505,7 @@ static void test_RingBuffer_enItemCount_head_gt_tail(void)
 static void test_RingBuffer_enItemCount_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t item_count = 0;
     RingBuffer_Error_t error;
 
@@ -2397,11 +2516,12 @@ static void test_RingBuffer_enItemCount_head_eq_tail(void)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enItemCount(&ring_buffer, &item_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, item_count);
     }
 }
@@ -2409,7 +2529,7 @@ static void test_RingBuffer_enItemCount_head_eq_tail(void)
 static void test_RingBuffer_enItemCount_buffer_empty(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     RingBuffer_Counter_t item_count = 0;
 
@@ -2419,6 +2539,7 @@ static void test_RingBuffer_enItemCount_buffer_empty(void)
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
         error = RingBuffer_enItemCount(&ring_buffer, &item_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
         TEST_ASSERT_EQUAL(0, item_count);
@@ -2428,7 +2549,7 @@ static void test_RingBuffer_enItemCount_buffer_empty(void)
 static void test_RingBuffer_enItemCount_buffer_full(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t item_count = 0;
     RingBuffer_Error_t error;
 
@@ -2437,16 +2558,15 @@ static void test_RingBuffer_enItemCount_buffer_full(void)
 
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
-        /*  tail [0:9]  */
-        ring_buffer.tail = i;
-        /*  head = r(ring_buffer.tail + 1)%ring_buffer.size  */
-        ring_buffer.head = (i + 1) % ring_buffer.size;
+        /*  tail [0:9], head = r(ring_buffer.tail + 1)%ring_buffer.size  */
+        test_RingBuffer_vSetFull(&ring_buffer, i);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enItemCount(&ring_buffer, &item_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL((i + 1) % ring_buffer.size, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-        TEST_ASSERT_EQUAL(ring_buffer.size - 1, item_count);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+        TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size), item_count);
     }
 }
 
@@ -2459,7 +2579,7 @@ static void test_RingBuffer_enItemCount_buffer_full(void)
 static void test_RingBuffer_enFreeCount_NULL_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t free_count = 0;
     RingBuffer_Error_t error;
 
@@ -2482,7 +2602,7 @@ static void test_RingBuffer_enFreeCount_Uninit_buffer(void)
 static void test_RingBuffer_enFreeCount_NULL_result(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -2497,7 +2617,7 @@ static void test_RingBuffer_enFreeCount_NULL_result(void)
 static void test_RingBuffer_enFreeCount_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t free_count = 0;
     RingBuffer_Error_t error;
 
@@ -2508,17 +2628,19 @@ static void test_RingBuffer_enFreeCount_head_lt_tail(void)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(ring_buffer.size - i + j - 1, free_count);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size) - (i - j), free_count);
         }
     }
 }
@@ -2526,7 +2648,7 @@ static void test_RingBuffer_enFreeCount_head_lt_tail(void)
 static void test_RingBuffer_enFreeCount_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t free_count = 0;
     RingBuffer_Error_t error;
 
@@ -2537,17 +2659,19 @@ static void test_RingBuffer_enFreeCount_head_gt_tail(void)
     {
         /*  head [1:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  tail [0:head - 1]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL(j, ring_buffer.tail);
-            TEST_ASSERT_EQUAL(i - j - 1, free_count);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+            TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size) - (ring_buffer.size - i + j), free_count);
         }
     }
 }
@@ -2555,7 +2679,7 @@ static void test_RingBuffer_enFreeCount_head_gt_tail(void)
 static void test_RingBuffer_enFreeCount_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t free_count = 0;
     RingBuffer_Error_t error;
 
@@ -2566,19 +2690,20 @@ static void test_RingBuffer_enFreeCount_head_eq_tail(void)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-        TEST_ASSERT_EQUAL(ring_buffer.size - 1, free_count);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+        TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size), free_count);
     }
 }
 
 static void test_RingBuffer_enFreeCount_buffer_empty(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t free_count = 0;
     RingBuffer_Error_t error;
 
@@ -2589,19 +2714,20 @@ static void test_RingBuffer_enFreeCount_buffer_empty(void)
     {
         /*  head [0:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
-        TEST_ASSERT_EQUAL(ring_buffer.size - 1, free_count);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
+        TEST_ASSERT_EQUAL(TEST_RING_BUFFER_CAPACITY(ring_buffer.size), free_count);
     }
 }
 
 static void test_RingBuffer_enFreeCount_buffer_full(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Counter_t free_count = 0;
     RingBuffer_Error_t error;
 
@@ -2610,16 +2736,14 @@ static void test_RingBuffer_enFreeCount_buffer_full(void)
 
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
-        /*  tail [0:9]  */
-        ring_buffer.tail = i;
-
-        /* head = (ring_buffer.tail + 1) % ring_buffer.size  */
-        ring_buffer.head = (i + 1) % ring_buffer.size;
+        /*  tail [0:9], head = (ring_buffer.tail + 1) % ring_buffer.size  */
+        test_RingBuffer_vSetFull(&ring_buffer, i);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL((i + 1) % ring_buffer.size, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(0, free_count);
     }
 }
@@ -2633,7 +2757,7 @@ static void test_RingBuffer_enFreeCount_buffer_full(void)
 static void test_RingBuffer_enIsEmpty_NULL_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     uint8_t is_empty = FALSE;
 
@@ -2656,7 +2780,7 @@ static void test_RingBuffer_enIsEmpty_Uninit_buffer(void)
 static void test_RingBuffer_enIsEmpty_NULL_result(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -2671,7 +2795,7 @@ static void test_RingBuffer_enIsEmpty_NULL_result(void)
 static void test_RingBuffer_enIsEmpty_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_empty = 0;
     RingBuffer_Error_t error;
 
@@ -2682,16 +2806,18 @@ static void test_RingBuffer_enIsEmpty_head_lt_tail(void)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enIsEmpty(&ring_buffer, &is_empty);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(FALSE, is_empty);
         }
     }
@@ -2700,7 +2826,7 @@ static void test_RingBuffer_enIsEmpty_head_lt_tail(void)
 static void test_RingBuffer_enIsEmpty_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_empty = 0;
     RingBuffer_Error_t error;
 
@@ -2711,16 +2837,18 @@ static void test_RingBuffer_enIsEmpty_head_gt_tail(void)
     {
         /*  head [1:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  tail [0:head - 1]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
 
             error = RingBuffer_enIsEmpty(&ring_buffer, &is_empty);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL(j, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
             TEST_ASSERT_EQUAL(FALSE, is_empty);
         }
     }
@@ -2729,7 +2857,7 @@ static void test_RingBuffer_enIsEmpty_head_gt_tail(void)
 static void test_RingBuffer_enIsEmpty_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_empty = 0;
     RingBuffer_Error_t error;
 
@@ -2740,11 +2868,12 @@ static void test_RingBuffer_enIsEmpty_head_eq_tail(void)
     {
         /*  head [1:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enIsEmpty(&ring_buffer, &is_empty);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(TRUE, is_empty);
     }
 }
@@ -2752,7 +2881,7 @@ static void test_RingBuffer_enIsEmpty_head_eq_tail(void)
 static void test_RingBuffer_enIsEmpty_empty_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_empty = 0;
     RingBuffer_Error_t error;
 
@@ -2763,11 +2892,12 @@ static void test_RingBuffer_enIsEmpty_empty_buffer(void)
     {
         /*  head [1:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enIsEmpty(&ring_buffer, &is_empty);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(TRUE, is_empty);
     }
 }
@@ -2775,7 +2905,7 @@ static void test_RingBuffer_enIsEmpty_empty_buffer(void)
 static void test_RingBuffer_enIsEmpty_full_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_empty = 0;
     RingBuffer_Error_t error;
 
@@ -2785,13 +2915,13 @@ static void test_RingBuffer_enIsEmpty_full_buffer(void)
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
         /*  tail [0:9], head = (ring_buffer.tail + 1) % ring_buffer.size  */
-        ring_buffer.tail = i;
-        ring_buffer.head = (i + 1)%ring_buffer.size;
+        test_RingBuffer_vSetFull(&ring_buffer, i);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enIsEmpty(&ring_buffer, &is_empty);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL((i + 1)%ring_buffer.size, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(FALSE, is_empty);
     }
 }
@@ -2805,7 +2935,7 @@ static void test_RingBuffer_enIsEmpty_full_buffer(void)
 static void test_RingBuffer_enIsFull_NULL_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
     uint8_t is_full = FALSE;
 
@@ -2828,7 +2958,7 @@ static void test_RingBuffer_enIsFull_Uninit_buffer(void)
 static void test_RingBuffer_enIsFull_NULL_result(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     RingBuffer_Error_t error;
 
     error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
@@ -2843,7 +2973,7 @@ static void test_RingBuffer_enIsFull_NULL_result(void)
 static void test_RingBuffer_enIsFull_head_lt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint32_t item_count = 0;
     uint8_t is_full = 0;
     RingBuffer_Error_t error;
@@ -2855,19 +2985,21 @@ static void test_RingBuffer_enIsFull_head_lt_tail(void)
     {
         /*  tail [1:9]  */
         ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  head [0:tail - 1]  */
             ring_buffer.head = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
             item_count = i - j;
 
             error = RingBuffer_enIsFull(&ring_buffer, &is_full);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(j, ring_buffer.head);
-            TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
 
-            if(item_count == (ring_buffer.size - 1))
+            if(item_count == TEST_RING_BUFFER_CAPACITY(ring_buffer.size))
             {
                 TEST_ASSERT_EQUAL(TRUE, is_full);
             }
@@ -2882,7 +3014,7 @@ static void test_RingBuffer_enIsFull_head_lt_tail(void)
 static void test_RingBuffer_enIsFull_head_gt_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint32_t item_count = 0;
     uint8_t is_full = 0;
     RingBuffer_Error_t error;
@@ -2894,19 +3026,21 @@ static void test_RingBuffer_enIsFull_head_gt_tail(void)
     {
         /*  head [1:9]  */
         ring_buffer.head = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         for(uint32_t j = 0; j < i; j++)
         {
             /*  tail [0:head - 1]  */
             ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
             item_count = ring_buffer.size - i + j;
 
             error = RingBuffer_enIsFull(&ring_buffer, &is_full);
             TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-            TEST_ASSERT_EQUAL(i, ring_buffer.head);
-            TEST_ASSERT_EQUAL(j, ring_buffer.tail);
+            TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+            TEST_ASSERT_EQUAL(j, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
 
-            if(item_count == (ring_buffer.size - 1))
+            if(item_count == TEST_RING_BUFFER_CAPACITY(ring_buffer.size))
             {
                 TEST_ASSERT_EQUAL(TRUE, is_full);
             }
@@ -2921,7 +3055,7 @@ static void test_RingBuffer_enIsFull_head_gt_tail(void)
 static void test_RingBuffer_enIsFull_head_eq_tail(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_full = 0;
     RingBuffer_Error_t error;
 
@@ -2932,11 +3066,12 @@ static void test_RingBuffer_enIsFull_head_eq_tail(void)
     {
         /*  head [1:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enIsFull(&ring_buffer, &is_full);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(FALSE, is_full);
     }
 }
@@ -2944,7 +3079,7 @@ static void test_RingBuffer_enIsFull_head_eq_tail(void)
 static void test_RingBuffer_enIsFull_empty_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_full = 0;
     RingBuffer_Error_t error;
 
@@ -2955,11 +3090,12 @@ static void test_RingBuffer_enIsFull_empty_buffer(void)
     {
         /*  head [1:9], tail [0:9]  */
         ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
 
         error = RingBuffer_enIsFull(&ring_buffer, &is_full);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL(i, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.head));
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(FALSE, is_full);
     }
 }
@@ -2967,7 +3103,7 @@ static void test_RingBuffer_enIsFull_empty_buffer(void)
 static void test_RingBuffer_enIsFull_full_buffer(void)
 {
     RingBuffer_t ring_buffer = {0};
-    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_Item_t ring_buffer_data [TEST_RING_BUFFER_SIZE] = {0};
     uint8_t is_full = 0;
     RingBuffer_Error_t error;
 
@@ -2977,156 +3113,1220 @@ static void test_RingBuffer_enIsFull_full_buffer(void)
     for(uint32_t i = 0; i < ring_buffer.size; i++)
     {
         /*  tail [0:9], head = (ring_buffer.tail + 1) % ring_buffer.size  */
-        ring_buffer.tail = i;
-        ring_buffer.head = (i + 1)%ring_buffer.size;
+        test_RingBuffer_vSetFull(&ring_buffer, i);
+        RingBuffer_Counter_t head = ring_buffer.head;
 
         error = RingBuffer_enIsFull(&ring_buffer, &is_full);
         TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
-        TEST_ASSERT_EQUAL((i + 1)%ring_buffer.size, ring_buffer.head);
-        TEST_ASSERT_EQUAL(i, ring_buffer.tail);
+        TEST_ASSERT_EQUAL(head, ring_buffer.head);
+        TEST_ASSERT_EQUAL(i, test_RingBuffer_xLocation(&ring_buffer, ring_buffer.tail));
         TEST_ASSERT_EQUAL(TRUE, is_full);
     }
 }
 
 /* ------------------------------------------------------------------------- */
-/* --------------------------- End of test cases --------------------------- */
+/* ------------------ Test RING_BUFFER_POWER_OF_TWO mode ------------------- */
 /* ------------------------------------------------------------------------- */
 
-void test_ring_buffer(void)
-{
-
-    /*  TEST_RING_BUFFER_INIT  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enInit_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enInit_NULL_data);
-    RUN_TEST(test_RingBuffer_enInit_Zero_len);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enInit);
+#if RING_BUFFER_POWER_OF_TWO
 
-    /*  TEST_RING_BUFFER_RESET  */
 #ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enReset_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enReset_Uninit_buffer);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enReset);
 
-    /*  TEST_RING_BUFFER_PUT_ITEM  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enPutItem_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enPutItem_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enPutItem_NULL_item);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enPutItem_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enPutItem_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enPutItem_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enPutItem_full_buffer);
+static void test_RingBuffer_enInit_Not_power_of_two(void)
+{
+    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Error_t error;
 
-    /*  TEST_RING_BUFFER_PUT_ITEMS  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enPutItems_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enPutItems_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enPutItems_NULL_items);
-    RUN_TEST(test_RingBuffer_enPutItems_NULL_item_count);
-    RUN_TEST(test_RingBuffer_enPutItems_zero_items);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enPutItems_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enPutItems_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enPutItems_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enPutItems_full_buffer);
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, 10);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
 
-    /*  TEST_RING_BUFFER_GET_ITEM  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enGetItem_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enGetItem_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enGetItem_NULL_item);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enGetItem_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enGetItem_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enGetItem_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enGetItem_empty_buffer);
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, 6);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
 
-    /*  TEST_RING_BUFFER_GET_ITEMS  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enGetItems_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enGetItems_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enGetItems_NULL_items);
-    RUN_TEST(test_RingBuffer_enGetItems_NULL_item_count);
-    RUN_TEST(test_RingBuffer_enGetItems_zero_items);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enGetItems_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enGetItems_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enGetItems_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enGetItems_empty_buffer);
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, 3);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
 
-    /*  TEST_RING_BUFFER_PEEK_ITEMS  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enPeekItems_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enPeekItems_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enPeekItems_NULL_items);
-    RUN_TEST(test_RingBuffer_enPeekItems_Zero_items);
 #endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enPeekItems_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enPeekItems_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enPeekItems_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enPeekItems_empty_buffer);
 
-    /*  TEST_RING_BUFFER_BLOCK_READ_ADDRESS  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enBlockReadAddress_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enBlockReadAddress_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enBlockReadAddress_NULL_address);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enBlockReadAddress);
+static void test_RingBuffer_enInit_power_of_two(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Error_t error;
 
-    /*  TEST_RING_BUFFER_BLOCK_READ_COUNT  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enBlockReadCount_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enBlockReadCount_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enBlockReadCount_NULL_count);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enBlockReadCount_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enBlockReadCount_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enBlockReadCount_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enBlockReadCount_empty_buffer);
+    for(uint32_t size = 2; size <= LOCAL_ARRAY_LEN(ring_buffer_data); size <<= 1)
+    {
+        error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, size);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(size, ring_buffer.size);
+    }
+}
 
-    /*  TEST_RING_BUFFER_BLOCK_WRITE_ADDRESS  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_NULL_address);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enBlockWriteAddress_full_buffer);
+#if (RING_BUFFER_FREE_RUNNING == 0)
 
-    /*  TEST_RING_BUFFER_BLOCK_WRITE_COUNT  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_NULL_count);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_buffer_empty);
-    RUN_TEST(test_RingBuffer_enBlockWriteCount_buffer_full);
+static void test_RingBuffer_PowerOfTwo_counts(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Error_t error;
 
-    /*  TEST_RING_BUFFER_SKIP  */
-#ifdef DEBUG
-    RUN_TEST(test_RingBuffer_enSkipItems_NULL_buffer);
-    RUN_TEST(test_RingBuffer_enSkipItems_Uninit_buffer);
-    RUN_TEST(test_RingBuffer_enSkipItems_NULL_skipped);
-    RUN_TEST(test_RingBuffer_enSkipItems_Zero_Items);
-#endif /*  DEBUG  */
-    RUN_TEST(test_RingBuffer_enSkipItems_head_lt_tail);
-    RUN_TEST(test_RingBuffer_enSkipItems_head_gt_tail);
-    RUN_TEST(test_RingBuffer_enSkipItems_head_eq_tail);
-    RUN_TEST(test_RingBuffer_enSkipItems_empty_buffer);
-    RUN_TEST(test_RingBuffer_enSkipItems_full_buffer);
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
 
-    /*  TEST_RING_BUFFER_ADVANCE  */
-#ifdef DEBUG
+    for(uint32_t i = 0; i < ring_buffer.size; i++)
+    {
+        for(uint32_t j = 0; j < ring_buffer.size; j++)
+        {
+            /*  head [0:7], tail [0:7]  */
+            ring_buffer.head = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
+            ring_buffer.tail = j;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
+
+            error = RingBuffer_enItemCount(&ring_buffer, &item_count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL((j + ring_buffer.size - i) % ring_buffer.size, item_count);
+
+            error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(ring_buffer.size - 1 - item_count, free_count);
+        }
+    }
+}
+
+static void test_RingBuffer_PowerOfTwo_put_get_item_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Item_t item;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 0; i < ring_buffer.size; i++)
+    {
+        /*  head = tail = [0:7]  */
+        ring_buffer.head = ring_buffer.tail = i;
+        test_RingBuffer_vSyncPointers(&ring_buffer);
+
+        /*  fill ring buffer  */
+        for(uint32_t j = 0; j < (ring_buffer.size - 1); j++)
+        {
+            item = (RingBuffer_Item_t)(j + 1);
+            error = RingBuffer_enPutItem(&ring_buffer, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL((i + j + 1) % ring_buffer.size, ring_buffer.tail);
+        }
+
+        error = RingBuffer_enPutItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+        /*  empty ring buffer  */
+        for(uint32_t j = 0; j < (ring_buffer.size - 1); j++)
+        {
+            error = RingBuffer_enGetItem(&ring_buffer, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(j + 1, item);
+            TEST_ASSERT_EQUAL((i + j + 1) % ring_buffer.size, ring_buffer.head);
+        }
+
+        error = RingBuffer_enGetItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    }
+}
+
+static void test_RingBuffer_PowerOfTwo_put_get_items_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Item_t put_items [8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    RingBuffer_Item_t get_items [8] = {0};
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 0; i < ring_buffer.size; i++)
+    {
+        for(uint32_t len = 1; len < ring_buffer.size; len++)
+        {
+            /*  head = tail = [0:7]  */
+            ring_buffer.head = ring_buffer.tail = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
+
+            error = RingBuffer_enPutItems(&ring_buffer, put_items, len, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL((i + len) % ring_buffer.size, ring_buffer.tail);
+
+            memset(get_items, 0, sizeof(get_items));
+            error = RingBuffer_enGetItems(&ring_buffer, get_items, len, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL((i + len) % ring_buffer.size, ring_buffer.head);
+            TEST_ASSERT_EQUAL(0, memcmp(put_items, get_items, len * sizeof(RingBuffer_Item_t)));
+
+            /*  advance & skip across ring buffer end  */
+            error = RingBuffer_enAdvance(&ring_buffer, len, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL((i + 2 * len) % ring_buffer.size, ring_buffer.tail);
+
+            error = RingBuffer_enSkipItems(&ring_buffer, len, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL((i + 2 * len) % ring_buffer.size, ring_buffer.head);
+        }
+    }
+}
+
+#endif /*  (RING_BUFFER_FREE_RUNNING == 0)  */
+
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+
+/* ------------------------------------------------------------------------- */
+/* ------------------ Test RING_BUFFER_FREE_RUNNING mode ------------------- */
+/* ------------------------------------------------------------------------- */
+
+#if RING_BUFFER_FREE_RUNNING
+
+static void test_RingBuffer_FreeRunning_full_capacity(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Counter_t count;
+    RingBuffer_Item_t item = 0;
+    uint8_t is_full;
+    uint8_t is_empty;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  all `size` locations are usable  */
+    for(uint32_t i = 0; i < ring_buffer.size; i++)
+    {
+        item = (RingBuffer_Item_t)(i + 1);
+        error = RingBuffer_enPutItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    error = RingBuffer_enIsFull(&ring_buffer, &is_full);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(TRUE, is_full);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(ring_buffer.size, count);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBuffer_enBlockWriteCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBuffer_enBlockReadCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(ring_buffer.size, count);
+
+    for(uint32_t i = 0; i < ring_buffer.size; i++)
+    {
+        error = RingBuffer_enGetItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(i + 1, item);
+    }
+
+    error = RingBuffer_enGetItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+
+    error = RingBuffer_enIsEmpty(&ring_buffer, &is_empty);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(TRUE, is_empty);
+
+    /*  counters are not wrapped around ring buffer size  */
+    TEST_ASSERT_EQUAL(ring_buffer.size, ring_buffer.head);
+    TEST_ASSERT_EQUAL(ring_buffer.size, ring_buffer.tail);
+}
+
+static void test_RingBuffer_FreeRunning_counter_overflow(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Item_t put_items [8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    RingBuffer_Item_t get_items [8] = {0};
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 1; i <= ring_buffer.size; i++)
+    {
+        for(uint32_t len = 1; len <= ring_buffer.size; len++)
+        {
+            /*  head = tail = [-1:-8], counters overflow while putting items  */
+            ring_buffer.head = ring_buffer.tail = (RingBuffer_Counter_t)(0 - i);
+            test_RingBuffer_vSyncPointers(&ring_buffer);
+
+            error = RingBuffer_enPutItems(&ring_buffer, put_items, len, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL((RingBuffer_Counter_t)(len - i), ring_buffer.tail);
+
+            error = RingBuffer_enItemCount(&ring_buffer, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+
+            error = RingBuffer_enFreeCount(&ring_buffer, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(ring_buffer.size - len, count);
+
+            memset(get_items, 0, sizeof(get_items));
+            error = RingBuffer_enPeekItems(&ring_buffer, get_items, len, 0, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL(0, memcmp(put_items, get_items, len * sizeof(RingBuffer_Item_t)));
+
+            memset(get_items, 0, sizeof(get_items));
+            error = RingBuffer_enGetItems(&ring_buffer, get_items, len, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL((RingBuffer_Counter_t)(len - i), ring_buffer.head);
+            TEST_ASSERT_EQUAL(0, memcmp(put_items, get_items, len * sizeof(RingBuffer_Item_t)));
+        }
+    }
+}
+
+static void test_RingBuffer_FreeRunning_block_count(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 0; i < (2 * ring_buffer.size); i++)
+    {
+        for(uint32_t len = 0; len <= ring_buffer.size; len++)
+        {
+            /*  head [0:15], tail = head + [0:8]  */
+            ring_buffer.head = i;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
+            ring_buffer.tail = i + len;
+            test_RingBuffer_vSyncPointers(&ring_buffer);
+
+            error = RingBuffer_enBlockReadCount(&ring_buffer, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(MIN(len, ring_buffer.size - (i % ring_buffer.size)), count);
+
+            error = RingBuffer_enBlockWriteCount(&ring_buffer, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(MIN(ring_buffer.size - len, ring_buffer.size - ((i + len) % ring_buffer.size)), count);
+        }
+    }
+}
+
+#endif /*  RING_BUFFER_FREE_RUNNING  */
+
+/* ------------------------------------------------------------------------- */
+/* ----------------- Test RING_BUFFER_CACHE_LINE_SIZE mode ----------------- */
+/* ------------------------------------------------------------------------- */
+
+#if RING_BUFFER_CACHE_LINE_SIZE
+
+static void test_RingBuffer_CacheLine_layout(void)
+{
+    /*  producer & consumer pointers are on separate cache lines  */
+    TEST_ASSERT_EQUAL(0, offsetof(RingBuffer_t, head) % RING_BUFFER_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL(0, offsetof(RingBuffer_t, tail) % RING_BUFFER_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL(TRUE, offsetof(RingBuffer_t, head) >= RING_BUFFER_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL(TRUE, offsetof(RingBuffer_t, tail) >= (offsetof(RingBuffer_t, head) + RING_BUFFER_CACHE_LINE_SIZE));
+
+    /*  producer's cached head is on producer's cache line, consumer's cached tail is on consumer's cache line  */
+    TEST_ASSERT_EQUAL(TRUE, offsetof(RingBuffer_t, head_cache) > offsetof(RingBuffer_t, tail));
+    TEST_ASSERT_EQUAL(TRUE, offsetof(RingBuffer_t, tail_cache) < offsetof(RingBuffer_t, tail));
+}
+
+static void test_RingBuffer_CacheLine_put_get_item(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Counter_t capacity;
+    RingBuffer_Item_t put_item = 0;
+    RingBuffer_Item_t get_item = 0;
+    RingBuffer_Item_t expected_item = 0;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &capacity);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 0; i < (4 * ring_buffer.size); i++)
+    {
+        /*  fill ring buffer  */
+        for(uint32_t j = 0; j < capacity; j++)
+        {
+            error = RingBuffer_enPutItem(&ring_buffer, &put_item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            put_item++;
+        }
+
+        error = RingBuffer_enPutItem(&ring_buffer, &put_item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+        /*  get some of the items, so that pointers move around ring buffer  */
+        for(uint32_t j = 0; j <= (i % capacity); j++)
+        {
+            error = RingBuffer_enGetItem(&ring_buffer, &get_item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(expected_item, get_item);
+            expected_item++;
+        }
+
+        /*  empty ring buffer  */
+        while(RingBuffer_enGetItem(&ring_buffer, &get_item) == RING_BUFFER_ERROR_NONE)
+        {
+            TEST_ASSERT_EQUAL(expected_item, get_item);
+            expected_item++;
+        }
+
+        TEST_ASSERT_EQUAL(put_item, expected_item);
+    }
+}
+
+static void test_RingBuffer_CacheLine_put_get_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Item_t put_items [8] = {0};
+    RingBuffer_Item_t get_items [8] = {0};
+    RingBuffer_Item_t next_item = 0;
+    RingBuffer_Item_t expected_item = 0;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 0; i < (8 * ring_buffer.size); i++)
+    {
+        /*  put 3 items, get 2 items, until ring buffer is full  */
+        for(uint32_t j = 0; j < 3; j++)
+        {
+            put_items[j] = next_item++;
+        }
+
+        error = RingBuffer_enPutItems(&ring_buffer, put_items, 3, &count);
+
+        if(error == RING_BUFFER_ERROR_NONE)
+        {
+            TEST_ASSERT_EQUAL(3, count);
+
+            error = RingBuffer_enPeekItems(&ring_buffer, get_items, 2, 0, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(2, count);
+            TEST_ASSERT_EQUAL(expected_item, get_items[0]);
+
+            error = RingBuffer_enGetItems(&ring_buffer, get_items, 2, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(2, count);
+            TEST_ASSERT_EQUAL(expected_item, get_items[0]);
+            TEST_ASSERT_EQUAL((RingBuffer_Item_t)(expected_item + 1), get_items[1]);
+            expected_item += 2;
+        }
+        else
+        {
+            /*  ring buffer is (almost) full, empty it  */
+            next_item -= (RingBuffer_Item_t)(3 - count);
+
+            while(RingBuffer_enGetItems(&ring_buffer, get_items, 1, &count) == RING_BUFFER_ERROR_NONE)
+            {
+                TEST_ASSERT_EQUAL(expected_item, get_items[0]);
+                expected_item++;
+            }
+
+            TEST_ASSERT_EQUAL(next_item, expected_item);
+        }
+    }
+}
+
+static void test_RingBuffer_CacheLine_refresh(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Counter_t capacity;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &capacity);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  fill ring buffer, producer's cached head is refreshed when it's full  */
+    error = RingBuffer_enAdvance(&ring_buffer, capacity, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(capacity, count);
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  consumer's cached tail is refreshed when it's empty  */
+    error = RingBuffer_enSkipItems(&ring_buffer, 2, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, count);
+
+    /*  producer sees the freed locations  */
+    error = RingBuffer_enBlockWriteCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(TRUE, count > 0);
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  consumer sees all items  */
+    error = RingBuffer_enBlockReadCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(TRUE, count > 0);
+
+    error = RingBuffer_enSkipItems(&ring_buffer, capacity, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(capacity, count);
+
+    error = RingBuffer_enGetItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+}
+
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+
+/*
+ * test cases for atomic ring buffer pointers (RING_BUFFER_ATOMIC),
+ * run in addition to the test cases of the selected pointers wrapping mode
+ * */
+/* ------------------------------------------------------------------------- */
+/* -------- Test RingBuffer_enReserve() / enCommit() / enAcquire() --------- */
+/* -------------------------- / enRelease() -------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+#ifdef DEBUG
+
+static void test_RingBuffer_enReserve_Zero_len(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enReserve(&ring_buffer, 0, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBuffer_enAcquire(&ring_buffer, 0, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBuffer_enReserve(&ring_buffer, 1, NULL, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enAcquire(&ring_buffer, 1, &first, NULL, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+}
+
+static void test_RingBuffer_enCommit_Too_many_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  committing more than the free space, or releasing more than the items, doesn't move the pointers  */
+    error = RingBuffer_enCommit(&ring_buffer, free_count + 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBuffer_enRelease(&ring_buffer, 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBuffer_enReserve_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  move ring buffer pointers to location 5  */
+    error = RingBuffer_enAdvance(&ring_buffer, 5, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enSkipItems(&ring_buffer, 5, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  reserved locations wrap around the end of ring buffer data  */
+    error = RingBuffer_enReserve(&ring_buffer, 6, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(6, count);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer_data[5], first.data);
+    TEST_ASSERT_EQUAL(3, first.count);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, second.data);
+    TEST_ASSERT_EQUAL(3, second.count);
+
+    /*  write items in place, they're not visible before they're committed  */
+    for(uint32_t i = 0; i < first.count; i++)
+    {
+        first.data[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    for(uint32_t i = 0; i < second.count; i++)
+    {
+        second.data[i] = (RingBuffer_Item_t)(first.count + i + 1);
+    }
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBuffer_enCommit(&ring_buffer, 6);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  acquired items wrap around the end of ring buffer data  */
+    error = RingBuffer_enAcquire(&ring_buffer, 8, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(6, count);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer_data[5], first.data);
+    TEST_ASSERT_EQUAL(3, first.count);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, second.data);
+    TEST_ASSERT_EQUAL(3, second.count);
+
+    for(uint32_t i = 0; i < first.count; i++)
+    {
+        TEST_ASSERT_EQUAL(i + 1, first.data[i]);
+    }
+
+    for(uint32_t i = 0; i < second.count; i++)
+    {
+        TEST_ASSERT_EQUAL(first.count + i + 1, second.data[i]);
+    }
+
+    error = RingBuffer_enRelease(&ring_buffer, 6);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+}
+
+static void test_RingBuffer_enReserve_full_buffer(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  nothing to acquire in an empty ring buffer  */
+    error = RingBuffer_enAcquire(&ring_buffer, 1, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, count);
+    TEST_ASSERT_EQUAL(0, first.count);
+    TEST_ASSERT_EQUAL(0, second.count);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  reservation is limited to free space  */
+    error = RingBuffer_enReserve(&ring_buffer, LOCAL_ARRAY_LEN(ring_buffer_data) + 1, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(free_count, count);
+    TEST_ASSERT_EQUAL(free_count, first.count);
+    TEST_ASSERT_EQUAL(0, second.count);
+
+    error = RingBuffer_enCommit(&ring_buffer, count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enReserve(&ring_buffer, 1, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+    TEST_ASSERT_EQUAL(0, count);
+    TEST_ASSERT_EQUAL(0, first.count);
+    TEST_ASSERT_EQUAL(0, second.count);
+}
+
+static void test_RingBuffer_enCommit_partial(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Item_t item;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  reserve 4 locations, write & commit only 2 items  */
+    error = RingBuffer_enReserve(&ring_buffer, 4, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    first.data[0] = 1;
+    first.data[1] = 2;
+
+    error = RingBuffer_enCommit(&ring_buffer, 2);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  nothing is committed  */
+    error = RingBuffer_enCommit(&ring_buffer, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enAcquire(&ring_buffer, 4, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(2, count);
+
+    /*  release only the first item  */
+    error = RingBuffer_enRelease(&ring_buffer, 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enGetItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, item);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+}
+
+/* ------------------------------------------------------------------------- */
+/* -------------------- Test RingBuffer batch sessions --------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBuffer_Batch_NULL_batch(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Batch_t batch;
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enPutBatchBegin(&ring_buffer, &batch, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enGetBatchBegin(&ring_buffer, NULL, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enPutBatchItem(NULL, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enPutBatchBegin(&ring_buffer, &batch, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutBatchItem(&batch, NULL);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enGetBatchEnd(NULL);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBuffer_Batch_publish_at_end(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Batch_t batch;
+    RingBuffer_Item_t item;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutBatchBegin(&ring_buffer, &batch, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint8_t i = 1; i <= 5; i++)
+    {
+        item = (RingBuffer_Item_t)i;
+
+        error = RingBuffer_enPutBatchItem(&batch, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    /*  the consumer doesn't see batch items before the batch ends  */
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBuffer_enPutBatchEnd(&batch);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(5, count);
+
+    error = RingBuffer_enGetBatchBegin(&ring_buffer, &batch, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint8_t i = 1; i <= 3; i++)
+    {
+        error = RingBuffer_enGetBatchItem(&batch, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(i, item);
+    }
+
+    /*  the producer doesn't see free locations before the batch ends  */
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(5, count);
+
+    error = RingBuffer_enGetBatchEnd(&batch);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, count);
+}
+
+static void test_RingBuffer_Batch_publish_count(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Batch_t batch;
+    RingBuffer_Item_t item = 0;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutBatchBegin(&ring_buffer, &batch, 3);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint8_t i = 0; i < 5; i++)
+    {
+        error = RingBuffer_enPutBatchItem(&batch, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    /*  published after 3 items  */
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, count);
+
+    error = RingBuffer_enGetBatchBegin(&ring_buffer, &batch, 2);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint8_t i = 0; i < 3; i++)
+    {
+        error = RingBuffer_enGetBatchItem(&batch, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    /*  removed after 2 items  */
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, count);
+
+    /*  only published items can be got, pending items are removed when empty  */
+    error = RingBuffer_enGetBatchItem(&batch, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+}
+
+static void test_RingBuffer_Batch_full_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Batch_t put_batch;
+    RingBuffer_Batch_t get_batch;
+    RingBuffer_Item_t item;
+    RingBuffer_Counter_t count;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Error_t error;
+    uint32_t put = 0;
+    uint32_t get = 0;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  fill, pending items are published when full  */
+    error = RingBuffer_enPutBatchBegin(&ring_buffer, &put_batch, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(;;)
+    {
+        item = (RingBuffer_Item_t)put;
+
+        if(RingBuffer_enPutBatchItem(&put_batch, &item) == RING_BUFFER_ERROR_FULL)
+        {
+            break;
+        }
+
+        put++;
+    }
+
+    TEST_ASSERT_EQUAL(free_count, put);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(free_count, count);
+
+    /*  interleaved batches, wrapping around the end of ring buffer data  */
+    error = RingBuffer_enGetBatchBegin(&ring_buffer, &get_batch, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    for(uint32_t i = 0; i < 20; i++)
+    {
+        while(RingBuffer_enGetBatchItem(&get_batch, &item) == RING_BUFFER_ERROR_NONE)
+        {
+            TEST_ASSERT_EQUAL((RingBuffer_Item_t)get, item);
+            get++;
+        }
+
+        for(uint32_t j = 0; j < 3; j++)
+        {
+            item = (RingBuffer_Item_t)put;
+
+            error = RingBuffer_enPutBatchItem(&put_batch, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            put++;
+        }
+
+        error = RingBuffer_enPutBatchEnd(&put_batch);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    error = RingBuffer_enGetBatchEnd(&get_batch);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(put - get, count);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------ Test RingBuffer unchecked functions ------------------ */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBuffer_Unchecked_put_get(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_Item_t items [8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    RingBuffer_Item_t read_items [8] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Item_t item = 9;
+    RingBuffer_Counter_t capacity;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    capacity = RingBuffer_uFreeCount(&ring_buffer);
+
+    TEST_ASSERT_EQUAL(0, RingBuffer_uGetItem(&ring_buffer, &item));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uGetItems(&ring_buffer, read_items, 4));
+
+    /*  counts of partial transfers  */
+    TEST_ASSERT_EQUAL(5, RingBuffer_uPutItems(&ring_buffer, items, 5));
+    TEST_ASSERT_EQUAL(capacity - 5, RingBuffer_uPutItems(&ring_buffer, &items[5], 3));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uPutItem(&ring_buffer, &item));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uPutItems(&ring_buffer, items, 1));
+    TEST_ASSERT_EQUAL(capacity, RingBuffer_uItemCount(&ring_buffer));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uFreeCount(&ring_buffer));
+
+    TEST_ASSERT_EQUAL(1, RingBuffer_uGetItem(&ring_buffer, &item));
+    TEST_ASSERT_EQUAL(1, item);
+
+    /*  wrap around the end of ring buffer data  */
+    TEST_ASSERT_EQUAL(1, RingBuffer_uPutItem(&ring_buffer, &item));
+    TEST_ASSERT_EQUAL(capacity, RingBuffer_uGetItems(&ring_buffer, read_items, 8));
+    TEST_ASSERT_EQUAL_MEMORY(&items[1], read_items, (capacity - 1) * sizeof(RingBuffer_Item_t));
+    TEST_ASSERT_EQUAL(1, read_items[capacity - 1]);
+    TEST_ASSERT_EQUAL(0, RingBuffer_uItemCount(&ring_buffer));
+}
+
+static void test_RingBuffer_Unchecked_peek_skip_advance(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_Item_t items [4] = {1, 2, 3, 4};
+    RingBuffer_Item_t read_items [4] = {0};
+    RingBuffer_t ring_buffer = {0};
+    RingBuffer_Counter_t capacity;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    capacity = RingBuffer_uFreeCount(&ring_buffer);
+
+    TEST_ASSERT_EQUAL(0, RingBuffer_uPeekItems(&ring_buffer, read_items, 1, 0));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uSkipItems(&ring_buffer, 1));
+
+    /*  items wrap around the end of ring buffer data  */
+    TEST_ASSERT_EQUAL(6, RingBuffer_uAdvance(&ring_buffer, 6));
+    TEST_ASSERT_EQUAL(6, RingBuffer_uSkipItems(&ring_buffer, 6));
+    TEST_ASSERT_EQUAL(4, RingBuffer_uPutItems(&ring_buffer, items, 4));
+
+    TEST_ASSERT_EQUAL(3, RingBuffer_uPeekItems(&ring_buffer, read_items, 4, 1));
+    TEST_ASSERT_EQUAL_MEMORY(&items[1], read_items, 3 * sizeof(RingBuffer_Item_t));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uPeekItems(&ring_buffer, read_items, 1, 4));
+
+    TEST_ASSERT_EQUAL(capacity - 4, RingBuffer_uAdvance(&ring_buffer, 8));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uAdvance(&ring_buffer, 1));
+    TEST_ASSERT_EQUAL(capacity, RingBuffer_uSkipItems(&ring_buffer, 8));
+    TEST_ASSERT_EQUAL(0, RingBuffer_uItemCount(&ring_buffer));
+}
+
+#if RING_BUFFER_ATOMIC
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test atomic ring buffer pointers -------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBuffer_Atomic_lock_free(void)
+{
+    RingBuffer_t ring_buffer;
+
+    /*  pointers must not fall back to locks, ring buffer functions can be called from interrupts  */
+    TEST_ASSERT_EQUAL(TRUE, atomic_is_lock_free(&ring_buffer.head));
+    TEST_ASSERT_EQUAL(TRUE, atomic_is_lock_free(&ring_buffer.tail));
+}
+
+static void test_RingBuffer_Atomic_put_get_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    RingBuffer_Error_t error;
+    RingBuffer_Item_t items_in [12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    RingBuffer_Item_t items_out [12] = {0};
+    RingBuffer_Counter_t count = 0;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  wrap pointers around ring buffer size  */
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        error = RingBuffer_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+        error = RingBuffer_enItemCount(&ring_buffer, &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+        error = RingBuffer_enGetItems(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_out), count);
+        TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+    }
+}
+
+#endif /*  RING_BUFFER_ATOMIC  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer(void)
+{
+#if RING_BUFFER_CACHE_LINE_SIZE
+    /*  TEST_RING_BUFFER_CACHE_LINE  */
+    RUN_TEST(test_RingBuffer_CacheLine_layout);
+    RUN_TEST(test_RingBuffer_CacheLine_put_get_item);
+    RUN_TEST(test_RingBuffer_CacheLine_put_get_items);
+    RUN_TEST(test_RingBuffer_CacheLine_refresh);
+#endif /*  RING_BUFFER_CACHE_LINE_SIZE  */
+
+    /*  TEST_RING_BUFFER_INIT  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enInit_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enInit_NULL_data);
+    RUN_TEST(test_RingBuffer_enInit_Zero_len);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enInit);
+
+    /*  TEST_RING_BUFFER_RESET  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enReset_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enReset_Uninit_buffer);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enReset);
+
+    /*  TEST_RING_BUFFER_PUT_ITEM  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enPutItem_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enPutItem_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enPutItem_NULL_item);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enPutItem_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enPutItem_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enPutItem_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enPutItem_full_buffer);
+
+    /*  TEST_RING_BUFFER_PUT_ITEMS  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enPutItems_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enPutItems_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enPutItems_NULL_items);
+    RUN_TEST(test_RingBuffer_enPutItems_NULL_item_count);
+    RUN_TEST(test_RingBuffer_enPutItems_zero_items);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enPutItems_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enPutItems_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enPutItems_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enPutItems_full_buffer);
+
+    /*  TEST_RING_BUFFER_GET_ITEM  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enGetItem_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enGetItem_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enGetItem_NULL_item);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enGetItem_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enGetItem_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enGetItem_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enGetItem_empty_buffer);
+
+    /*  TEST_RING_BUFFER_GET_ITEMS  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enGetItems_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enGetItems_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enGetItems_NULL_items);
+    RUN_TEST(test_RingBuffer_enGetItems_NULL_item_count);
+    RUN_TEST(test_RingBuffer_enGetItems_zero_items);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enGetItems_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enGetItems_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enGetItems_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enGetItems_empty_buffer);
+
+    /*  TEST_RING_BUFFER_PEEK_ITEMS  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enPeekItems_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enPeekItems_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enPeekItems_NULL_items);
+    RUN_TEST(test_RingBuffer_enPeekItems_Zero_items);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enPeekItems_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enPeekItems_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enPeekItems_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enPeekItems_empty_buffer);
+
+    /*  TEST_RING_BUFFER_BLOCK_READ_ADDRESS  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enBlockReadAddress_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enBlockReadAddress_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enBlockReadAddress_NULL_address);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enBlockReadAddress);
+
+    /*  TEST_RING_BUFFER_BLOCK_READ_COUNT  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enBlockReadCount_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enBlockReadCount_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enBlockReadCount_NULL_count);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enBlockReadCount_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enBlockReadCount_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enBlockReadCount_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enBlockReadCount_empty_buffer);
+
+    /*  TEST_RING_BUFFER_BLOCK_WRITE_ADDRESS  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_NULL_address);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enBlockWriteAddress_full_buffer);
+
+    /*  TEST_RING_BUFFER_BLOCK_WRITE_COUNT  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_NULL_count);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_buffer_empty);
+    RUN_TEST(test_RingBuffer_enBlockWriteCount_buffer_full);
+
+    /*  TEST_RING_BUFFER_SKIP  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enSkipItems_NULL_buffer);
+    RUN_TEST(test_RingBuffer_enSkipItems_Uninit_buffer);
+    RUN_TEST(test_RingBuffer_enSkipItems_NULL_skipped);
+    RUN_TEST(test_RingBuffer_enSkipItems_Zero_Items);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enSkipItems_head_lt_tail);
+    RUN_TEST(test_RingBuffer_enSkipItems_head_gt_tail);
+    RUN_TEST(test_RingBuffer_enSkipItems_head_eq_tail);
+    RUN_TEST(test_RingBuffer_enSkipItems_empty_buffer);
+    RUN_TEST(test_RingBuffer_enSkipItems_full_buffer);
+
+    /*  TEST_RING_BUFFER_ADVANCE  */
+#ifdef DEBUG
     RUN_TEST(test_RingBuffer_enAdvance_NULL_buffer);
     RUN_TEST(test_RingBuffer_enAdvance_Uninit_buffer);
     RUN_TEST(test_RingBuffer_enAdvance_NULL_advanced);
@@ -3185,4 +4385,48 @@ void test_ring_buffer(void)
     RUN_TEST(test_RingBuffer_enIsFull_head_eq_tail);
     RUN_TEST(test_RingBuffer_enIsFull_empty_buffer);
     RUN_TEST(test_RingBuffer_enIsFull_full_buffer);
+
+#if RING_BUFFER_POWER_OF_TWO
+    /*  TEST_RING_BUFFER_POWER_OF_TWO  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enInit_Not_power_of_two);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enInit_power_of_two);
+
+#if (RING_BUFFER_FREE_RUNNING == 0)
+    RUN_TEST(test_RingBuffer_PowerOfTwo_counts);
+    RUN_TEST(test_RingBuffer_PowerOfTwo_put_get_item_wrap);
+    RUN_TEST(test_RingBuffer_PowerOfTwo_put_get_items_wrap);
+#else
+    /*  TEST_RING_BUFFER_FREE_RUNNING  */
+    RUN_TEST(test_RingBuffer_FreeRunning_full_capacity);
+    RUN_TEST(test_RingBuffer_FreeRunning_counter_overflow);
+    RUN_TEST(test_RingBuffer_FreeRunning_block_count);
+#endif /*  (RING_BUFFER_FREE_RUNNING == 0)  */
+#endif /*  RING_BUFFER_POWER_OF_TWO  */
+
+    /*  TEST_RING_BUFFER_RESERVE / ACQUIRE  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enReserve_Zero_len);
+    RUN_TEST(test_RingBuffer_enCommit_Too_many_items);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enReserve_wrap);
+    RUN_TEST(test_RingBuffer_enReserve_full_buffer);
+    RUN_TEST(test_RingBuffer_enCommit_partial);
+
+    /*  TEST_RING_BUFFER_BATCH  */
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_Batch_NULL_batch);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_Batch_publish_at_end);
+    RUN_TEST(test_RingBuffer_Batch_publish_count);
+    RUN_TEST(test_RingBuffer_Batch_full_wrap);
+
+    RUN_TEST(test_RingBuffer_Unchecked_put_get);
+    RUN_TEST(test_RingBuffer_Unchecked_peek_skip_advance);
+
+#if RING_BUFFER_ATOMIC
+    RUN_TEST(test_RingBuffer_Atomic_lock_free);
+    RUN_TEST(test_RingBuffer_Atomic_put_get_items);
+#endif /*  RING_BUFFER_ATOMIC  */
 }
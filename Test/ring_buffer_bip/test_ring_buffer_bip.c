@@ -0,0 +1,252 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_bip/ring_buffer_bip.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_bip.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/* ------------------------------------------------------------------------- */
+/* ---------------------- Test RingBufferBip_enInit() ---------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferBip_enInit_Too_small(void)
+{
+    RingBuffer_Item_t ring_buffer_data [1] = {0};
+    RingBufferBip_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBip_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+static void test_RingBufferBip_enCommit_Too_many_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBufferBip_t ring_buffer;
+    RingBuffer_Item_t * block;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBip_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enReserve(&ring_buffer, 0, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferBip_enReserve(&ring_buffer, 4, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enCommit(&ring_buffer, 5);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferBip_enCommit(&ring_buffer, 4);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRelease(&ring_buffer, 5);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------- Test RingBufferBip reserve/commit blocks ---------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferBip_reserve_commit_read(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBufferBip_t ring_buffer;
+    RingBuffer_Item_t * block;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBip_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    /*  whole data can be reserved when empty  */
+    error = RingBufferBip_enReserve(&ring_buffer, 16, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, block);
+
+    /*  partial commit, the rest of the reservation is dropped  */
+    block[0] = 1;
+    block[1] = 2;
+    block[2] = 3;
+
+    error = RingBufferBip_enCommit(&ring_buffer, 3);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, block);
+    TEST_ASSERT_EQUAL(3, count);
+    TEST_ASSERT_EQUAL(1, block[0]);
+    TEST_ASSERT_EQUAL(3, block[2]);
+
+    error = RingBufferBip_enRelease(&ring_buffer, 2);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer_data[2], block);
+    TEST_ASSERT_EQUAL(1, count);
+
+    /*  commit 0 drops the reservation  */
+    error = RingBufferBip_enReserve(&ring_buffer, 4, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enCommit(&ring_buffer, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, count);
+}
+
+static void test_RingBufferBip_reserve_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBufferBip_t ring_buffer;
+    RingBuffer_Item_t * block;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBip_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  first region [6, 12)  */
+    error = RingBufferBip_enReserve(&ring_buffer, 12, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    memset(block, 0xA, 12 * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferBip_enCommit(&ring_buffer, 12);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRelease(&ring_buffer, 6);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  4 locations left before the end, 6 at the start: 6 contiguous items can't be reserved  */
+    error = RingBufferBip_enReserve(&ring_buffer, 6, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  5 contiguous items are reserved at the start of data  */
+    error = RingBufferBip_enReserve(&ring_buffer, 5, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, block);
+    memset(block, 0xB, 5 * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferBip_enCommit(&ring_buffer, 5);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  inverted, write can't reach read  */
+    error = RingBufferBip_enReserve(&ring_buffer, 1, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  first region is read up to the watermark, then the second region  */
+    error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer_data[6], block);
+    TEST_ASSERT_EQUAL(6, count);
+
+    error = RingBufferBip_enRelease(&ring_buffer, 6);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, block);
+    TEST_ASSERT_EQUAL(5, count);
+    TEST_ASSERT_EQUAL(0xB, block[4]);
+
+    /*  locations after the watermark are free again  */
+    error = RingBufferBip_enReserve(&ring_buffer, 11, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer_data[5], block);
+}
+
+static void test_RingBufferBip_blocks_in_order(void)
+{
+    RingBuffer_Item_t ring_buffer_data [37] = {0};
+    RingBufferBip_t ring_buffer;
+    RingBuffer_Item_t * block;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+    uint32_t put = 0;
+    uint32_t get = 0;
+
+    error = RingBufferBip_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  blocks of 1 to 9 items over many laps, consumer lags behind by a block  */
+    for(uint32_t i = 0; i < 200; i++)
+    {
+        RingBuffer_Counter_t len = (RingBuffer_Counter_t)((i % 9) + 1);
+
+        while(RingBufferBip_enReserve(&ring_buffer, len, &block) == RING_BUFFER_ERROR_FULL)
+        {
+            error = RingBufferBip_enRead(&ring_buffer, &block, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+            count = (count > 3) ? 3 : count;
+
+            for(RingBuffer_Counter_t j = 0; j < count; j++)
+            {
+                TEST_ASSERT_EQUAL((RingBuffer_Item_t)get, block[j]);
+                get++;
+            }
+
+            error = RingBufferBip_enRelease(&ring_buffer, count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        }
+
+        TEST_ASSERT_EQUAL(TRUE, (block >= ring_buffer_data) && ((block + len) <= &ring_buffer_data[LOCAL_ARRAY_LEN(ring_buffer_data)]));
+
+        for(RingBuffer_Counter_t j = 0; j < len; j++)
+        {
+            block[j] = (RingBuffer_Item_t)put;
+            put++;
+        }
+
+        error = RingBufferBip_enCommit(&ring_buffer, len);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    while(RingBufferBip_enRead(&ring_buffer, &block, &count) == RING_BUFFER_ERROR_NONE)
+    {
+        for(RingBuffer_Counter_t j = 0; j < count; j++)
+        {
+            TEST_ASSERT_EQUAL((RingBuffer_Item_t)get, block[j]);
+            get++;
+        }
+
+        error = RingBufferBip_enRelease(&ring_buffer, count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    TEST_ASSERT_EQUAL(put, get);
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_bip(void)
+{
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferBip_enInit_Too_small);
+    RUN_TEST(test_RingBufferBip_enCommit_Too_many_items);
+#endif /*  DEBUG  */
+
+    RUN_TEST(test_RingBufferBip_reserve_commit_read);
+    RUN_TEST(test_RingBufferBip_reserve_wrap);
+    RUN_TEST(test_RingBufferBip_blocks_in_order);
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_bip_H_
+#define _test_ring_buffer_bip_H_
+
+void test_ring_buffer_bip(void);
+
+#endif /* _test_ring_buffer_bip_H_    */
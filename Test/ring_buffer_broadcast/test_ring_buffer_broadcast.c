@@ -0,0 +1,335 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_broadcast/ring_buffer_broadcast.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_broadcast.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*
+ * Broadcast ring buffer needs atomic free running ring buffer pointers,
+ * test cases are only built with -DRING_BUFFER_ATOMIC -DRING_BUFFER_FREE_RUNNING
+ * */
+#if RING_BUFFER_BROADCAST
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferBroadcast_enInit() ------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferBroadcast_enInit_NULL_cursors(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), NULL, 2);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+}
+
+static void test_RingBufferBroadcast_enInit_Invalid_param(void)
+{
+    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, 8, cursors, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBufferBroadcast_enInit_Success(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, ring_buffer.data);
+    TEST_ASSERT_EQUAL_PTR(cursors, ring_buffer.cursors);
+    TEST_ASSERT_EQUAL(0, ring_buffer.tail);
+
+    error = RingBufferBroadcast_enFreeCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(ring_buffer_data), count);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------- Test RingBufferBroadcast_enJoin() / enLeave() ------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferBroadcast_enJoin_full(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBufferBroadcast_Consumer_t consumer [3];
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer[0]);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer[1]);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(FALSE, (consumer[0] == consumer[1]));
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer[2]);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  a left cursor can be used by a new consumer  */
+    error = RingBufferBroadcast_enLeave(&ring_buffer, consumer[0]);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer[2]);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(consumer[0], consumer[2]);
+}
+
+static void test_RingBufferBroadcast_enLeave_invalid_consumer(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBufferBroadcast_Consumer_t consumer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enLeave(&ring_buffer, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enLeave(&ring_buffer, consumer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  consumer already left  */
+    error = RingBufferBroadcast_enLeave(&ring_buffer, consumer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferBroadcast_enItemCount(&ring_buffer, consumer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+static void test_RingBufferBroadcast_enJoin_newest_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBufferBroadcast_Consumer_t consumer;
+    RingBuffer_Item_t items_in [] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    RingBuffer_Item_t items_out [8];
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  no consumer is joined, producer overwrites old items  */
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        error = RingBufferBroadcast_enPutItems(&ring_buffer, items_in, 7, &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(7, count);
+    }
+
+    /*  consumer only reads items put after it joined  */
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enItemCount(&ring_buffer, consumer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBufferBroadcast_enGetItems(&ring_buffer, consumer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+
+    error = RingBufferBroadcast_enPutItems(&ring_buffer, &items_in[7], 4, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enGetItems(&ring_buffer, consumer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(4, count);
+    TEST_ASSERT_EQUAL_MEMORY(&items_in[7], items_out, 4 * sizeof(RingBuffer_Item_t));
+}
+
+/* ------------------------------------------------------------------------- */
+/* ---------------- Test RingBufferBroadcast_enPutItems() ------------------ */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferBroadcast_enPutItems_slowest_consumer(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBufferBroadcast_Consumer_t fast;
+    RingBufferBroadcast_Consumer_t slow;
+    RingBuffer_Item_t items_in [] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    RingBuffer_Item_t items_out [8];
+    RingBuffer_Item_t item;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &fast);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &slow);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(8, count);
+
+    /*  fast consumer reads all items, producer is still bounded by the slow consumer  */
+    error = RingBufferBroadcast_enGetItems(&ring_buffer, fast, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, 8 * sizeof(RingBuffer_Item_t));
+
+    item = 9;
+    error = RingBufferBroadcast_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  slow consumer reads 3 items  */
+    error = RingBufferBroadcast_enGetItems(&ring_buffer, slow, items_out, 3, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, 3 * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferBroadcast_enFreeCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, count);
+
+    error = RingBufferBroadcast_enPutItems(&ring_buffer, &items_in[8], 4, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(3, count);
+
+    /*  each consumer reads every item, at its own pace  */
+    error = RingBufferBroadcast_enGetItems(&ring_buffer, fast, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(3, count);
+    TEST_ASSERT_EQUAL_MEMORY(&items_in[8], items_out, 3 * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferBroadcast_enGetItems(&ring_buffer, slow, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(&items_in[3], items_out, 8 * sizeof(RingBuffer_Item_t));
+
+    /*  slow consumer leaves, producer is only bounded by the fast consumer  */
+    error = RingBufferBroadcast_enLeave(&ring_buffer, slow);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enFreeCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(8, count);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------- Test RingBufferBroadcast consumer block read -------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferBroadcast_enBlockRead_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferBroadcast_Cursor_t cursors [2];
+    RingBufferBroadcast_t ring_buffer;
+    RingBufferBroadcast_Consumer_t consumer;
+    RingBuffer_Item_t items_in [] = {1, 2, 3, 4, 5, 6};
+    RingBuffer_Item_t items_out [6];
+    RingBuffer_Item_t * address;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferBroadcast_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), cursors, LOCAL_ARRAY_LEN(cursors));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enJoin(&ring_buffer, &consumer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  move ring buffer pointers to location 5  */
+    error = RingBufferBroadcast_enPutItems(&ring_buffer, items_in, 5, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enSkipItems(&ring_buffer, consumer, 5, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  peek doesn't move consumer's read pointer, items are read across the end of ring buffer data  */
+    error = RingBufferBroadcast_enPeekItems(&ring_buffer, consumer, items_out, LOCAL_ARRAY_LEN(items_out), 0, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(items_in, items_out, LOCAL_ARRAY_LEN(items_in));
+
+    /*  items are read in place, up to the end of ring buffer data  */
+    error = RingBufferBroadcast_enBlockReadAddress(&ring_buffer, consumer, &address);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer_data[5], address);
+
+    error = RingBufferBroadcast_enBlockReadCount(&ring_buffer, consumer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, address, count * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferBroadcast_enSkipItems(&ring_buffer, consumer, count, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferBroadcast_enBlockReadAddress(&ring_buffer, consumer, &address);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(ring_buffer_data, address);
+
+    error = RingBufferBroadcast_enBlockReadCount(&ring_buffer, consumer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, count);
+    TEST_ASSERT_EQUAL_MEMORY(&items_in[3], address, count * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferBroadcast_enSkipItems(&ring_buffer, consumer, 4, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(3, count);
+}
+
+#endif /*  RING_BUFFER_BROADCAST  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_broadcast(void)
+{
+#if RING_BUFFER_BROADCAST
+
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferBroadcast_enInit_NULL_cursors);
+    RUN_TEST(test_RingBufferBroadcast_enInit_Invalid_param);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBufferBroadcast_enInit_Success);
+
+    RUN_TEST(test_RingBufferBroadcast_enJoin_full);
+    RUN_TEST(test_RingBufferBroadcast_enLeave_invalid_consumer);
+    RUN_TEST(test_RingBufferBroadcast_enJoin_newest_items);
+
+    RUN_TEST(test_RingBufferBroadcast_enPutItems_slowest_consumer);
+
+    RUN_TEST(test_RingBufferBroadcast_enBlockRead_wrap);
+
+#endif /*  RING_BUFFER_BROADCAST  */
+}
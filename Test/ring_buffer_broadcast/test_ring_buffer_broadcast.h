@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_broadcast_H_
+#define _test_ring_buffer_broadcast_H_
+
+void test_ring_buffer_broadcast(void);
+
+#endif /* _test_ring_buffer_broadcast_H_    */
@@ -0,0 +1,180 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_checksum/ring_buffer_checksum.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_checksum.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+#define TEST_CHECK_TEXT         "123456789"
+#define TEST_CHECK_CRC32C       0xE3069283UL
+#define TEST_CHECK_CRC16_CCITT  0x29B1U
+#define TEST_CHECK_ADLER32      0x091E01DEUL
+
+/*  move the oldest item of empty @p ring_buffer to @p index of its data, and put string @p text (without its null terminator)  */
+static void test_RingBufferChecksum_xPutAt(RingBuffer_t * ring_buffer, RingBuffer_Counter_t index, char const * text)
+{
+    RingBuffer_Counter_t count;
+
+    if(index)
+    {
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enAdvance(ring_buffer, index, &count));
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enSkipItems(ring_buffer, index, &count));
+    }
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enPutItems(ring_buffer, (RingBuffer_Item_t const *)text, (RingBuffer_Counter_t)strlen(text), &count));
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Test RingBufferChecksum ----------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferChecksum_Invalid_param(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    uint32_t crc32c = RING_BUFFER_CRC32C_INIT;
+    uint16_t crc16 = RING_BUFFER_CRC16_CCITT_INIT;
+    uint32_t adler = RING_BUFFER_ADLER32_INIT;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enCrc32c(NULL, 0, 1, &crc32c);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enCrc16Ccitt(&ring_buffer, 0, 1, NULL);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enAdler32(&ring_buffer, 0, 0, &adler);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    (void)crc16;
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBufferChecksum_check_values_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t index;
+    uint32_t crc32c;
+    uint16_t crc16;
+    uint32_t adler;
+    RingBuffer_Error_t error;
+
+    /*  every split of the check text around the end of ring buffer data  */
+    for(index = 0; index < LOCAL_ARRAY_LEN(ring_buffer_data); index++)
+    {
+        error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        test_RingBufferChecksum_xPutAt(&ring_buffer, index, "ab" TEST_CHECK_TEXT);
+
+        crc32c = RING_BUFFER_CRC32C_INIT;
+        crc16 = RING_BUFFER_CRC16_CCITT_INIT;
+        adler = RING_BUFFER_ADLER32_INIT;
+
+        error = RingBuffer_enCrc32c(&ring_buffer, 2, 9, &crc32c);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL_HEX32(TEST_CHECK_CRC32C, crc32c);
+
+        error = RingBuffer_enCrc16Ccitt(&ring_buffer, 2, 9, &crc16);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL_HEX16(TEST_CHECK_CRC16_CCITT, crc16);
+
+        error = RingBuffer_enAdler32(&ring_buffer, 2, 9, &adler);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL_HEX32(TEST_CHECK_ADLER32, adler);
+    }
+}
+
+static void test_RingBufferChecksum_incremental(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t split;
+    uint32_t crc32c;
+    uint16_t crc16;
+    uint32_t adler;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    test_RingBufferChecksum_xPutAt(&ring_buffer, 11, TEST_CHECK_TEXT);
+
+    /*  checksum of the first items continued over the rest is the checksum of all items  */
+    for(split = 1; split < 9; split++)
+    {
+        crc32c = RING_BUFFER_CRC32C_INIT;
+        crc16 = RING_BUFFER_CRC16_CCITT_INIT;
+        adler = RING_BUFFER_ADLER32_INIT;
+
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enCrc32c(&ring_buffer, 0, split, &crc32c));
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enCrc32c(&ring_buffer, split, 9 - split, &crc32c));
+        TEST_ASSERT_EQUAL_HEX32(TEST_CHECK_CRC32C, crc32c);
+
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enCrc16Ccitt(&ring_buffer, 0, split, &crc16));
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enCrc16Ccitt(&ring_buffer, split, 9 - split, &crc16));
+        TEST_ASSERT_EQUAL_HEX16(TEST_CHECK_CRC16_CCITT, crc16);
+
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enAdler32(&ring_buffer, 0, split, &adler));
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enAdler32(&ring_buffer, split, 9 - split, &adler));
+        TEST_ASSERT_EQUAL_HEX32(TEST_CHECK_ADLER32, adler);
+    }
+}
+
+static void test_RingBufferChecksum_insufficient_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    uint32_t crc32c = RING_BUFFER_CRC32C_INIT;
+    uint16_t crc16 = RING_BUFFER_CRC16_CCITT_INIT;
+    uint32_t adler = RING_BUFFER_ADLER32_INIT;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enCrc32c(&ring_buffer, 0, 1, &crc32c);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL_HEX32(RING_BUFFER_CRC32C_INIT, crc32c);
+
+    test_RingBufferChecksum_xPutAt(&ring_buffer, 0, TEST_CHECK_TEXT);
+
+    /*  checksums are unchanged, the range isn't all in the ring buffer yet  */
+    error = RingBuffer_enCrc32c(&ring_buffer, 0, 10, &crc32c);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL_HEX32(RING_BUFFER_CRC32C_INIT, crc32c);
+
+    error = RingBuffer_enCrc16Ccitt(&ring_buffer, 9, 1, &crc16);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL_HEX16(RING_BUFFER_CRC16_CCITT_INIT, crc16);
+
+    error = RingBuffer_enAdler32(&ring_buffer, 5, 5, &adler);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL_HEX32(RING_BUFFER_ADLER32_INIT, adler);
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_checksum(void)
+{
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferChecksum_Invalid_param);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBufferChecksum_check_values_wrap);
+    RUN_TEST(test_RingBufferChecksum_incremental);
+    RUN_TEST(test_RingBufferChecksum_insufficient_items);
+}
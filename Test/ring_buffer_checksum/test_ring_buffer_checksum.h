@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_checksum_H_
+#define _test_ring_buffer_checksum_H_
+
+void test_ring_buffer_checksum(void);
+
+#endif /* _test_ring_buffer_checksum_H_    */
@@ -0,0 +1,214 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_inline.h"
+#include "ring_buffer_define/ring_buffer_define.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_copy.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  largest copy checked, crosses the inline copy limit  */
+#define TEST_RING_BUFFER_COPY_MAX_BYTES     (2 * RING_BUFFER_COPY_INLINE_MAX + 192)
+
+/*  byte outside the copied bytes  */
+#define TEST_RING_BUFFER_COPY_GUARD         0xA5
+
+/*  items of each width the copy kernel is specialized for  */
+typedef struct test_RingBufferCopy_Item16_t {
+    uint8_t bytes [16];
+} test_RingBufferCopy_Item16_t;
+
+typedef struct test_RingBufferCopy_Item64_t {
+    uint8_t bytes [64];
+} test_RingBufferCopy_Item64_t;
+
+/*  odd item size, copied by words then single bytes  */
+typedef struct test_RingBufferCopy_Item3_t {
+    uint8_t bytes [3];
+} test_RingBufferCopy_Item3_t;
+
+RING_BUFFER_DEFINE(TestCopy1, uint8_t, uint32_t, 12)
+RING_BUFFER_DEFINE(TestCopy2, uint16_t, uint32_t, 12)
+RING_BUFFER_DEFINE(TestCopy3, test_RingBufferCopy_Item3_t, uint32_t, 12)
+RING_BUFFER_DEFINE(TestCopy4, uint32_t, uint32_t, 12)
+RING_BUFFER_DEFINE(TestCopy8, uint64_t, uint32_t, 12)
+RING_BUFFER_DEFINE(TestCopy16, test_RingBufferCopy_Item16_t, uint32_t, 12)
+RING_BUFFER_DEFINE(TestCopy64, test_RingBufferCopy_Item64_t, uint32_t, 12)
+
+/*  fill @p len bytes at @p data with a pattern starting from @p seed  */
+static void test_RingBufferCopy_xFill(void * data, size_t len, uint8_t seed)
+{
+    uint8_t * bytes = (uint8_t *)data;
+
+    for(size_t i = 0; i < len; i++)
+    {
+        bytes[i] = (uint8_t)(seed + (i * 7));
+    }
+}
+
+/*  check @p len bytes at @p data were not written  */
+static void test_RingBufferCopy_xCheckGuard(void const * data, size_t len)
+{
+    uint8_t const * bytes = (uint8_t const *)data;
+
+    for(size_t i = 0; i < len; i++)
+    {
+        TEST_ASSERT_EQUAL(TEST_RING_BUFFER_COPY_GUARD, bytes[i]);
+    }
+}
+
+/*  copy every count of @p item_size items up to TEST_RING_BUFFER_COPY_MAX_BYTES, from and to unaligned addresses  */
+static void test_RingBufferCopy_xCheckWidth(size_t item_size)
+{
+    static uint8_t src [TEST_RING_BUFFER_COPY_MAX_BYTES + 8];
+    static uint8_t dst [TEST_RING_BUFFER_COPY_MAX_BYTES + 8];
+
+    test_RingBufferCopy_xFill(src, sizeof(src), (uint8_t)item_size);
+
+    for(size_t count = 0; (count * item_size) <= TEST_RING_BUFFER_COPY_MAX_BYTES; count++)
+    {
+        size_t size = count * item_size;
+
+        memset(dst, TEST_RING_BUFFER_COPY_GUARD, sizeof(dst));
+
+        RingBuffer_xCopy(&dst[3], &src[1], count, item_size, SIZE_MAX);
+
+        if(size)
+        {
+            TEST_ASSERT_EQUAL_MEMORY(&src[1], &dst[3], size);
+        }
+
+        TEST_ASSERT_EQUAL(TEST_RING_BUFFER_COPY_GUARD, dst[2]);
+        TEST_ASSERT_EQUAL(TEST_RING_BUFFER_COPY_GUARD, dst[3 + size]);
+    }
+}
+
+/*
+ * put then get every number of items, from every start location, into generated ring buffer `name`,
+ * and peek them from the second item
+ * */
+#define TEST_RING_BUFFER_COPY_CHECK_GENERATED(name)                                                     \
+    do {                                                                                                \
+        name##_t ring_buffer;                                                                           \
+        name##_Item_t items [12];                                                                       \
+        name##_Item_t read_items [12];                                                                  \
+                                                                                                        \
+        for(uint32_t start = 0; start < 13; start++)                                                    \
+        {                                                                                               \
+            for(uint32_t len = 1; len <= 12; len++)                                                     \
+            {                                                                                           \
+                TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, name##_enInit(&ring_buffer));                 \
+                TEST_ASSERT_EQUAL(start, name##_uAdvance(&ring_buffer, start));                         \
+                TEST_ASSERT_EQUAL(start, name##_uSkipItems(&ring_buffer, start));                       \
+                                                                                                        \
+                test_RingBufferCopy_xFill(items, sizeof(items), (uint8_t)(start + len));                \
+                memset(read_items, TEST_RING_BUFFER_COPY_GUARD, sizeof(read_items));                    \
+                                                                                                        \
+                TEST_ASSERT_EQUAL(len, name##_uPutItems(&ring_buffer, items, len));                     \
+                TEST_ASSERT_EQUAL(len - 1, name##_uPeekItems(&ring_buffer, read_items, len, 1));        \
+                                                                                                        \
+                if(len > 1)                                                                             \
+                {                                                                                       \
+                    TEST_ASSERT_EQUAL_MEMORY(&items[1], read_items, (len - 1) * sizeof(items[0]));      \
+                }                                                                                       \
+                                                                                                        \
+                TEST_ASSERT_EQUAL(len, name##_uGetItems(&ring_buffer, read_items, len));                \
+                TEST_ASSERT_EQUAL_MEMORY(items, read_items, len * sizeof(items[0]));                    \
+                                                                                                        \
+                if(len < 12)                                                                            \
+                {                                                                                       \
+                    test_RingBufferCopy_xCheckGuard(&read_items[len], (12 - len) * sizeof(items[0]));   \
+                }                                                                                       \
+            }                                                                                           \
+        }                                                                                               \
+    } while(0)
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------- Test RingBufferCopy -------------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferCopy_kernel_widths(void)
+{
+    test_RingBufferCopy_xCheckWidth(1);
+    test_RingBufferCopy_xCheckWidth(2);
+    test_RingBufferCopy_xCheckWidth(3);
+    test_RingBufferCopy_xCheckWidth(4);
+    test_RingBufferCopy_xCheckWidth(8);
+    test_RingBufferCopy_xCheckWidth(12);
+    test_RingBufferCopy_xCheckWidth(16);
+    test_RingBufferCopy_xCheckWidth(24);
+    test_RingBufferCopy_xCheckWidth(64);
+    test_RingBufferCopy_xCheckWidth(sizeof(RingBuffer_Item_t));
+}
+
+static void test_RingBufferCopy_put_get_peek_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [32] = {0};
+    RingBuffer_Item_t items [32];
+    RingBuffer_Item_t read_items [32];
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t capacity;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data)));
+
+    capacity = RingBuffer_uFreeCount(&ring_buffer);
+
+    /*  every start location and number of items, items of any RING_BUFFER_ITEM_DATA_TYPE are compared as bytes  */
+    for(RingBuffer_Counter_t start = 0; start < LOCAL_ARRAY_LEN(ring_buffer_data); start++)
+    {
+        for(RingBuffer_Counter_t len = 1; len <= capacity; len++)
+        {
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enReset(&ring_buffer));
+
+            if(start)
+            {
+                TEST_ASSERT_EQUAL(start, RingBuffer_uAdvance(&ring_buffer, start));
+                TEST_ASSERT_EQUAL(start, RingBuffer_uSkipItems(&ring_buffer, start));
+            }
+
+            test_RingBufferCopy_xFill(items, sizeof(items), (uint8_t)(start + len));
+            memset(read_items, TEST_RING_BUFFER_COPY_GUARD, sizeof(read_items));
+
+            TEST_ASSERT_EQUAL(len, RingBuffer_uPutItems(&ring_buffer, items, len));
+            TEST_ASSERT_EQUAL(len, RingBuffer_uPeekItems(&ring_buffer, read_items, len, 0));
+            TEST_ASSERT_EQUAL_MEMORY(items, read_items, len * sizeof(RingBuffer_Item_t));
+
+            memset(read_items, TEST_RING_BUFFER_COPY_GUARD, sizeof(read_items));
+
+            TEST_ASSERT_EQUAL(len, RingBuffer_uGetItems(&ring_buffer, read_items, len));
+            TEST_ASSERT_EQUAL_MEMORY(items, read_items, len * sizeof(RingBuffer_Item_t));
+
+            if(len < LOCAL_ARRAY_LEN(read_items))
+            {
+                test_RingBufferCopy_xCheckGuard(&read_items[len], (LOCAL_ARRAY_LEN(read_items) - len) * sizeof(RingBuffer_Item_t));
+            }
+        }
+    }
+}
+
+static void test_RingBufferCopy_generated_widths(void)
+{
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy1);
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy2);
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy3);
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy4);
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy8);
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy16);
+    TEST_RING_BUFFER_COPY_CHECK_GENERATED(TestCopy64);
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_copy(void)
+{
+    RUN_TEST(test_RingBufferCopy_kernel_widths);
+    RUN_TEST(test_RingBufferCopy_put_get_peek_items);
+    RUN_TEST(test_RingBufferCopy_generated_widths);
+}
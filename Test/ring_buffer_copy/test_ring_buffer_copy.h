@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_copy_H_
+#define _test_ring_buffer_copy_H_
+
+void test_ring_buffer_copy(void);
+
+#endif /* _test_ring_buffer_copy_H_    */
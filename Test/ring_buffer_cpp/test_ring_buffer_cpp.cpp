@@ -0,0 +1,452 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_cpp/ring_buffer_cpp.hpp"
+#include "utils/utils.h"
+extern "C" {
+#include "unity.h"
+}
+#include "test_ring_buffer_cpp.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  item counting its live copies, to check items are destroyed when they're taken, copies throw when copies_left is 0  */
+struct test_RingBufferCpp_Counted_t {
+    static int live;
+    static int copies_left;
+    int value;
+
+    explicit test_RingBufferCpp_Counted_t(int value) : value(value) { live++; }
+    test_RingBufferCpp_Counted_t(test_RingBufferCpp_Counted_t const & other) : value(other.value)
+    {
+        if(copies_left == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+
+        copies_left--;
+        live++;
+    }
+    test_RingBufferCpp_Counted_t(test_RingBufferCpp_Counted_t && other) noexcept : value(other.value) { other.value = -1; live++; }
+    test_RingBufferCpp_Counted_t & operator=(test_RingBufferCpp_Counted_t const & other) = default;
+    test_RingBufferCpp_Counted_t & operator=(test_RingBufferCpp_Counted_t && other) = default;
+    ~test_RingBufferCpp_Counted_t() { live--; }
+};
+
+int test_RingBufferCpp_Counted_t::live = 0;
+int test_RingBufferCpp_Counted_t::copies_left = -1;
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- Test RingBufferCpp -------------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferCpp_static_capacity(void)
+{
+    RingBuffer<uint32_t, 10> ring_buffer;
+    uint32_t item = 0;
+    uint32_t i;
+
+    TEST_ASSERT_TRUE(ring_buffer.capacity() >= 10);
+    TEST_ASSERT_TRUE(ring_buffer.empty());
+    TEST_ASSERT_FALSE(ring_buffer.pop(item));
+
+    /*  several times around the ring buffer  */
+    for(i = 0; i < 100; i++)
+    {
+        TEST_ASSERT_TRUE(ring_buffer.push(i));
+        TEST_ASSERT_TRUE(ring_buffer.emplace(i + 1));
+
+        TEST_ASSERT_TRUE(ring_buffer.pop(item));
+        TEST_ASSERT_EQUAL(i, item);
+        TEST_ASSERT_TRUE(ring_buffer.pop(item));
+        TEST_ASSERT_EQUAL(i + 1, item);
+    }
+
+    /*  full  */
+    for(i = 0; i < ring_buffer.capacity(); i++)
+    {
+        TEST_ASSERT_TRUE(ring_buffer.push(i));
+    }
+
+    TEST_ASSERT_FALSE(ring_buffer.push(i));
+    TEST_ASSERT_TRUE(ring_buffer.full());
+    TEST_ASSERT_EQUAL(ring_buffer.capacity(), ring_buffer.size());
+    TEST_ASSERT_EQUAL(0, ring_buffer.front());
+    TEST_ASSERT_EQUAL(ring_buffer.capacity() - 1, ring_buffer.back());
+
+    TEST_ASSERT_EQUAL(3, ring_buffer.skip(3));
+    TEST_ASSERT_EQUAL(3, ring_buffer.front());
+
+    ring_buffer.clear();
+    TEST_ASSERT_TRUE(ring_buffer.empty());
+    TEST_ASSERT_FALSE(ring_buffer.pop());
+}
+
+static void test_RingBufferCpp_dynamic_capacity(void)
+{
+    RingBuffer<uint32_t> no_capacity;
+    RingBuffer<uint32_t> ring_buffer(100);
+    uint32_t item = 0;
+    uint32_t i;
+
+    /*  nothing allocated  */
+    TEST_ASSERT_EQUAL(0, no_capacity.capacity());
+    TEST_ASSERT_TRUE(no_capacity.empty());
+    TEST_ASSERT_TRUE(no_capacity.full());
+    TEST_ASSERT_FALSE(no_capacity.push(1));
+    TEST_ASSERT_FALSE(no_capacity.pop(item));
+    TEST_ASSERT_EQUAL(0, no_capacity.readable().first.size());
+
+    TEST_ASSERT_TRUE(ring_buffer.capacity() >= 100);
+    TEST_ASSERT_TRUE(ring_buffer.capacity() <= RingBuffer<uint32_t>::max_size());
+
+    for(i = 0; i < ring_buffer.capacity(); i++)
+    {
+        TEST_ASSERT_TRUE(ring_buffer.push(i));
+    }
+
+    TEST_ASSERT_FALSE(ring_buffer.push(i));
+
+    /*  data is moved, moved from ring buffer has no capacity  */
+    no_capacity = std::move(ring_buffer);
+    TEST_ASSERT_EQUAL(0, ring_buffer.capacity());
+    TEST_ASSERT_TRUE(ring_buffer.empty());
+    TEST_ASSERT_EQUAL(i, no_capacity.size());
+
+    for(i = 0; i < 50; i++)
+    {
+        TEST_ASSERT_TRUE(no_capacity.pop(item));
+        TEST_ASSERT_EQUAL(i, item);
+    }
+
+    /*  items around the end of ring buffer data  */
+    for(i = 0; i < 50; i++)
+    {
+        TEST_ASSERT_TRUE(no_capacity.push(1000 + i));
+    }
+
+    RingBuffer<uint32_t> moved(std::move(no_capacity));
+    RingBuffer<uint32_t> copied(moved);
+
+    TEST_ASSERT_EQUAL(moved.capacity(), copied.capacity());
+    TEST_ASSERT_TRUE(std::equal(moved.begin(), moved.end(), copied.begin(), copied.end()));
+    TEST_ASSERT_EQUAL(50, moved.front());
+    TEST_ASSERT_EQUAL(1049, moved.back());
+}
+
+static void test_RingBufferCpp_move_only_items(void)
+{
+    RingBuffer<std::unique_ptr<int>, 4> pointers;
+    RingBuffer<std::string> strings(3);
+    std::unique_ptr<int> pointer = std::make_unique<int>(7);
+    std::string text;
+    int i;
+
+    TEST_ASSERT_TRUE(pointers.emplace(new int(1)));
+    TEST_ASSERT_TRUE(pointers.push(std::move(pointer)));
+    TEST_ASSERT_TRUE(pointer == nullptr);
+    TEST_ASSERT_TRUE(pointers.emplace(std::make_unique<int>(3)));
+
+    TEST_ASSERT_TRUE(pointers.pop(pointer));
+    TEST_ASSERT_EQUAL(1, *pointer);
+    TEST_ASSERT_EQUAL(7, *pointers.front());
+
+    /*  items are moved to the other ring buffer  */
+    RingBuffer<std::unique_ptr<int>, 4> moved(std::move(pointers));
+    TEST_ASSERT_TRUE(pointers.empty());
+    TEST_ASSERT_EQUAL(2, moved.size());
+    TEST_ASSERT_TRUE(moved.pop(pointer));
+    TEST_ASSERT_EQUAL(7, *pointer);
+
+    /*  full ring buffer doesn't move the item  */
+    for(i = 0; !strings.full(); i++)
+    {
+        TEST_ASSERT_TRUE(strings.emplace(static_cast<std::size_t>(i + 20), static_cast<char>('a' + i)));
+    }
+
+    text = "not moved";
+    TEST_ASSERT_FALSE(strings.push(std::move(text)));
+    TEST_ASSERT_TRUE(text == "not moved");
+
+    TEST_ASSERT_TRUE(strings.pop(text));
+    TEST_ASSERT_TRUE(text == std::string(20, 'a'));
+    TEST_ASSERT_TRUE(strings.push(std::string(30, 'z')));
+    TEST_ASSERT_TRUE(strings.back() == std::string(30, 'z'));
+}
+
+static void test_RingBufferCpp_item_lifetime(void)
+{
+    using Counted = test_RingBufferCpp_Counted_t;
+
+    Counted::live = 0;
+
+    {
+        RingBuffer<Counted, 5> ring_buffer;
+        RingBuffer<Counted> dynamic_ring_buffer(5);
+        Counted items [] = { Counted(1), Counted(2), Counted(3) };
+        Counted item(0);
+
+        TEST_ASSERT_EQUAL(4, Counted::live);
+
+        TEST_ASSERT_EQUAL(3, ring_buffer.push(items, LOCAL_ARRAY_LEN(items)));
+        TEST_ASSERT_TRUE(ring_buffer.emplace(4));
+        TEST_ASSERT_EQUAL(8, Counted::live);
+
+        TEST_ASSERT_TRUE(ring_buffer.pop(item));
+        TEST_ASSERT_EQUAL(1, item.value);
+        TEST_ASSERT_EQUAL(7, Counted::live);
+
+        TEST_ASSERT_TRUE(ring_buffer.pop());
+        TEST_ASSERT_EQUAL(6, Counted::live);
+
+        /*  copies  */
+        dynamic_ring_buffer.push(items[0]);
+        TEST_ASSERT_EQUAL(7, Counted::live);
+
+        RingBuffer<Counted, 5> copied(ring_buffer);
+        TEST_ASSERT_EQUAL(9, Counted::live);
+
+        copied = std::move(ring_buffer);
+        TEST_ASSERT_EQUAL(9 - 2, Counted::live);
+        TEST_ASSERT_EQUAL(3, copied.front().value);
+
+        TEST_ASSERT_EQUAL(2, copied.pop(items, LOCAL_ARRAY_LEN(items)));
+        TEST_ASSERT_EQUAL(4, items[1].value);
+        TEST_ASSERT_EQUAL(5, Counted::live);
+
+        /*  destroyed with the ring buffer  */
+        TEST_ASSERT_TRUE(copied.emplace(5));
+        TEST_ASSERT_EQUAL(6, Counted::live);
+    }
+
+    TEST_ASSERT_EQUAL(0, Counted::live);
+}
+
+static void test_RingBufferCpp_copy_throws(void)
+{
+    using Counted = test_RingBufferCpp_Counted_t;
+
+    Counted::live = 0;
+
+    {
+        RingBuffer<Counted, 5> ring_buffer;
+        RingBuffer<Counted> dynamic_ring_buffer(5);
+        bool thrown = false;
+
+        for(int i = 0; i < 4; i++)
+        {
+            TEST_ASSERT_TRUE(ring_buffer.emplace(i));
+            TEST_ASSERT_TRUE(dynamic_ring_buffer.emplace(i));
+        }
+
+        TEST_ASSERT_EQUAL(8, Counted::live);
+
+        /*  third copy throws, copied items are destroyed (and dynamic data freed)  */
+        Counted::copies_left = 2;
+
+        try
+        {
+            RingBuffer<Counted, 5> copied(ring_buffer);
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+
+        TEST_ASSERT_TRUE(thrown);
+        TEST_ASSERT_EQUAL(8, Counted::live);
+
+        Counted::copies_left = 2;
+        thrown = false;
+
+        try
+        {
+            RingBuffer<Counted> copied(dynamic_ring_buffer);
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+
+        TEST_ASSERT_TRUE(thrown);
+        TEST_ASSERT_EQUAL(8, Counted::live);
+
+        /*  throwing copy assignment leaves the ring buffer unchanged  */
+        RingBuffer<Counted> assigned(5);
+
+        TEST_ASSERT_TRUE(assigned.emplace(9));
+        Counted::copies_left = 2;
+        thrown = false;
+
+        try
+        {
+            assigned = dynamic_ring_buffer;
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+
+        Counted::copies_left = -1;
+
+        TEST_ASSERT_TRUE(thrown);
+        TEST_ASSERT_EQUAL(1, assigned.size());
+        TEST_ASSERT_EQUAL(9, assigned.front().value);
+        TEST_ASSERT_EQUAL(9, Counted::live);
+    }
+
+    TEST_ASSERT_EQUAL(0, Counted::live);
+}
+
+static void test_RingBufferCpp_iterators(void)
+{
+    RingBuffer<int, 8> ring_buffer;
+    RingBuffer<int, 8> const & const_ring_buffer = ring_buffer;
+    int const values [] = { 5, -3, 9, 0, 12, 7 };
+    std::size_t i;
+
+    /*  items around the end of ring buffer data  */
+    for(i = 0; i < ring_buffer.capacity() - 2; i++)
+    {
+        TEST_ASSERT_TRUE(ring_buffer.push(static_cast<int>(i)));
+    }
+
+    TEST_ASSERT_EQUAL(i, ring_buffer.skip(i));
+    TEST_ASSERT_EQUAL(6, ring_buffer.push(values, LOCAL_ARRAY_LEN(values)));
+    TEST_ASSERT_TRUE(ring_buffer.readable().second.size() > 0);
+
+    TEST_ASSERT_EQUAL(6, std::distance(ring_buffer.begin(), ring_buffer.end()));
+    TEST_ASSERT_EQUAL(30, std::accumulate(const_ring_buffer.begin(), const_ring_buffer.end(), 0));
+    TEST_ASSERT_EQUAL(4, std::find(ring_buffer.cbegin(), ring_buffer.cend(), 12) - ring_buffer.cbegin());
+    TEST_ASSERT_TRUE(std::equal(ring_buffer.begin(), ring_buffer.end(), values));
+
+    std::sort(ring_buffer.begin(), ring_buffer.end());
+
+    TEST_ASSERT_TRUE(std::is_sorted(ring_buffer.begin(), ring_buffer.end()));
+    TEST_ASSERT_EQUAL(-3, ring_buffer.front());
+    TEST_ASSERT_EQUAL(12, ring_buffer.back());
+    TEST_ASSERT_EQUAL(12, *std::make_reverse_iterator(ring_buffer.end()));
+
+    RingBuffer<int, 8>::const_iterator it = ring_buffer.begin();
+    it += 2;
+    TEST_ASSERT_EQUAL(5, *it);
+    TEST_ASSERT_EQUAL(9, it[2]);
+    TEST_ASSERT_EQUAL(0, *(it - 1));
+    TEST_ASSERT_TRUE((it - 2) == const_ring_buffer.begin());
+    TEST_ASSERT_TRUE(it < const_ring_buffer.end());
+}
+
+static void test_RingBufferCpp_spans(void)
+{
+    RingBuffer<uint16_t, 12> ring_buffer;
+    uint16_t items [16];
+    uint16_t read_items [16] = {0};
+    uint16_t i;
+
+    for(i = 0; i < LOCAL_ARRAY_LEN(items); i++)
+    {
+        items[i] = static_cast<uint16_t>(0x1000 + i);
+    }
+
+    TEST_ASSERT_EQUAL(8, ring_buffer.push(items, 8));
+    TEST_ASSERT_EQUAL(8, ring_buffer.pop(read_items, 8));
+
+    /*  free locations up to the end of ring buffer data, then from its start  */
+    auto [first_free, second_free] = ring_buffer.writable();
+    TEST_ASSERT_EQUAL(ring_buffer.capacity(), first_free.size() + second_free.size());
+    TEST_ASSERT_TRUE(second_free.size() > 0);
+
+    for(i = 0; i < first_free.size(); i++)
+    {
+        first_free[i] = items[i];
+    }
+
+    second_free[0] = items[i];
+    TEST_ASSERT_EQUAL(first_free.size() + 1, ring_buffer.commit(first_free.size() + 1));
+
+    /*  same items, in two spans  */
+    auto [first, second] = ring_buffer.readable();
+    TEST_ASSERT_EQUAL(first_free.size(), first.size());
+    TEST_ASSERT_EQUAL(1, second.size());
+    TEST_ASSERT_EQUAL_MEMORY(items, first.data(), first.size() * sizeof(uint16_t));
+    TEST_ASSERT_EQUAL(items[first.size()], second[0]);
+
+    /*  bulk copies wrap around, partial when full or empty  */
+    TEST_ASSERT_EQUAL(ring_buffer.capacity() - ring_buffer.size(), ring_buffer.push(items, LOCAL_ARRAY_LEN(items)));
+    TEST_ASSERT_TRUE(ring_buffer.full());
+    TEST_ASSERT_EQUAL(ring_buffer.capacity(), ring_buffer.pop(read_items, LOCAL_ARRAY_LEN(read_items)));
+    TEST_ASSERT_EQUAL_MEMORY(items, read_items, first.size() * sizeof(uint16_t));
+    TEST_ASSERT_EQUAL(0, ring_buffer.pop(read_items, 1));
+}
+
+static void test_RingBufferCpp_same_index_logic(void)
+{
+    RingBuffer_Item_t ring_buffer_data [RingBuffer_xSlotCount(20)] = {0};
+    RingBuffer_Item_t items [32];
+    RingBuffer_Item_t read_items [32];
+    RingBuffer_Item_t cpp_read_items [32];
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t acquired;
+    RingBuffer_t ring_buffer;
+    RingBuffer<RingBuffer_Item_t, 20> cpp_ring_buffer;
+    uint32_t round;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data)));
+    TEST_ASSERT_EQUAL(RingBuffer_uFreeCount(&ring_buffer), cpp_ring_buffer.capacity());
+
+    for(round = 0; round < 50; round++)
+    {
+        RingBuffer_Counter_t put_len = (RingBuffer_Counter_t)((round * 7) % 23);
+        RingBuffer_Counter_t get_len = (RingBuffer_Counter_t)((round * 5) % 19);
+
+        std::memset(items, (int)round, sizeof(items));
+
+        TEST_ASSERT_EQUAL(RingBuffer_uPutItems(&ring_buffer, items, put_len), cpp_ring_buffer.push(items, put_len));
+        TEST_ASSERT_EQUAL(RingBuffer_uItemCount(&ring_buffer), cpp_ring_buffer.size());
+
+        /*  same spans  */
+        if(RingBuffer_enAcquire(&ring_buffer, RingBuffer_uItemCount(&ring_buffer), &first, &second, &acquired) == RING_BUFFER_ERROR_NONE)
+        {
+            TEST_ASSERT_EQUAL(first.count, cpp_ring_buffer.readable().first.size());
+            TEST_ASSERT_EQUAL(second.count, cpp_ring_buffer.readable().second.size());
+        }
+        else
+        {
+            TEST_ASSERT_TRUE(cpp_ring_buffer.empty());
+        }
+
+        get_len = RingBuffer_uGetItems(&ring_buffer, read_items, get_len);
+        TEST_ASSERT_EQUAL(get_len, cpp_ring_buffer.pop(cpp_read_items, get_len));
+
+        if(get_len)
+        {
+            TEST_ASSERT_EQUAL_MEMORY(read_items, cpp_read_items, get_len * sizeof(RingBuffer_Item_t));
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_cpp(void)
+{
+    RUN_TEST(test_RingBufferCpp_static_capacity);
+    RUN_TEST(test_RingBufferCpp_dynamic_capacity);
+    RUN_TEST(test_RingBufferCpp_move_only_items);
+    RUN_TEST(test_RingBufferCpp_item_lifetime);
+    RUN_TEST(test_RingBufferCpp_copy_throws);
+    RUN_TEST(test_RingBufferCpp_iterators);
+    RUN_TEST(test_RingBufferCpp_spans);
+    RUN_TEST(test_RingBufferCpp_same_index_logic);
+}
@@ -0,0 +1,14 @@
+#ifndef _test_ring_buffer_cpp_H_
+#define _test_ring_buffer_cpp_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void test_ring_buffer_cpp(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _test_ring_buffer_cpp_H_    */
@@ -0,0 +1,228 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_define/ring_buffer_define.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_define.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  record wider than any register, copied as a whole  */
+typedef struct test_RingBufferDefine_Record_t {
+    uint32_t id;
+    uint8_t payload [60];
+} test_RingBufferDefine_Record_t;
+
+/*  power of 2 capacity (free running pointers)  */
+RING_BUFFER_DEFINE(TestBytes, uint8_t, uint32_t, 16)
+
+/*  other capacity, small counter type  */
+RING_BUFFER_DEFINE(TestSamples, uint32_t, uint16_t, 10)
+
+/*  wide items, smallest counter type  */
+RING_BUFFER_DEFINE(TestRecords, test_RingBufferDefine_Record_t, uint8_t, 3)
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------- Test RingBufferDefine ------------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferDefine_Invalid_param(void)
+{
+    RingBuffer_Error_t error;
+
+    error = TestBytes_enInit(NULL);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = TestSamples_enInit(NULL);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBufferDefine_layout(void)
+{
+    TestBytes_t bytes;
+    TestSamples_t samples;
+    TestRecords_t records;
+
+    /*  one location is always free when the capacity isn't a power of 2  */
+    TEST_ASSERT_EQUAL(16, LOCAL_ARRAY_LEN(bytes.data));
+    TEST_ASSERT_EQUAL(11, LOCAL_ARRAY_LEN(samples.data));
+    TEST_ASSERT_EQUAL(4, LOCAL_ARRAY_LEN(records.data));
+
+    TEST_ASSERT_EQUAL(sizeof(uint32_t), sizeof(samples.data[0]));
+    TEST_ASSERT_EQUAL(sizeof(uint16_t), sizeof(TestSamples_Counter_t));
+    TEST_ASSERT_EQUAL(64, sizeof(TestRecords_Item_t));
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestBytes_enInit(&bytes));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestSamples_enInit(&samples));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestRecords_enInit(&records));
+
+    TEST_ASSERT_EQUAL(0, TestBytes_uItemCount(&bytes));
+    TEST_ASSERT_EQUAL(16, TestBytes_uFreeCount(&bytes));
+    TEST_ASSERT_EQUAL(10, TestSamples_uFreeCount(&samples));
+    TEST_ASSERT_EQUAL(3, TestRecords_uFreeCount(&records));
+}
+
+static void test_RingBufferDefine_put_get_item(void)
+{
+    TestBytes_t ring_buffer;
+    uint8_t item;
+    uint32_t i;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestBytes_enInit(&ring_buffer));
+
+    TEST_ASSERT_EQUAL(0, TestBytes_uGetItem(&ring_buffer, &item));
+
+    /*  several times around the ring buffer  */
+    for(i = 0; i < 100; i++)
+    {
+        item = (uint8_t)i;
+        TEST_ASSERT_EQUAL(1, TestBytes_uPutItem(&ring_buffer, &item));
+        item = (uint8_t)(i + 1);
+        TEST_ASSERT_EQUAL(1, TestBytes_uPutItem(&ring_buffer, &item));
+
+        TEST_ASSERT_EQUAL(1, TestBytes_uGetItem(&ring_buffer, &item));
+        TEST_ASSERT_EQUAL((uint8_t)i, item);
+        TEST_ASSERT_EQUAL(1, TestBytes_uGetItem(&ring_buffer, &item));
+        TEST_ASSERT_EQUAL((uint8_t)(i + 1), item);
+    }
+
+    /*  full  */
+    for(i = 0; i < 16; i++)
+    {
+        item = (uint8_t)i;
+        TEST_ASSERT_EQUAL(1, TestBytes_uPutItem(&ring_buffer, &item));
+    }
+
+    TEST_ASSERT_EQUAL(0, TestBytes_uPutItem(&ring_buffer, &item));
+    TEST_ASSERT_EQUAL(16, TestBytes_uItemCount(&ring_buffer));
+    TEST_ASSERT_EQUAL(0, TestBytes_uFreeCount(&ring_buffer));
+
+    for(i = 0; i < 16; i++)
+    {
+        TEST_ASSERT_EQUAL(1, TestBytes_uGetItem(&ring_buffer, &item));
+        TEST_ASSERT_EQUAL(i, item);
+    }
+
+    TEST_ASSERT_EQUAL(0, TestBytes_uGetItem(&ring_buffer, &item));
+}
+
+static void test_RingBufferDefine_put_get_items_wrap(void)
+{
+    TestSamples_t ring_buffer;
+    uint32_t items [12];
+    uint32_t read_items [12] = {0};
+    uint32_t i;
+
+    for(i = 0; i < LOCAL_ARRAY_LEN(items); i++)
+    {
+        items[i] = 0x10000000UL + i;
+    }
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestSamples_enInit(&ring_buffer));
+
+    /*  partial put when full  */
+    TEST_ASSERT_EQUAL(10, TestSamples_uPutItems(&ring_buffer, items, 12));
+    TEST_ASSERT_EQUAL(0, TestSamples_uPutItems(&ring_buffer, items, 1));
+
+    TEST_ASSERT_EQUAL(7, TestSamples_uGetItems(&ring_buffer, read_items, 7));
+    TEST_ASSERT_EQUAL_MEMORY(items, read_items, 7 * sizeof(uint32_t));
+
+    /*  put and get around the end of ring buffer data  */
+    TEST_ASSERT_EQUAL(7, TestSamples_uPutItems(&ring_buffer, items, 12));
+    TEST_ASSERT_EQUAL(10, TestSamples_uItemCount(&ring_buffer));
+
+    /*  partial get when empty  */
+    TEST_ASSERT_EQUAL(10, TestSamples_uGetItems(&ring_buffer, read_items, 12));
+    TEST_ASSERT_EQUAL_MEMORY(&items[7], read_items, 3 * sizeof(uint32_t));
+    TEST_ASSERT_EQUAL_MEMORY(items, &read_items[3], 7 * sizeof(uint32_t));
+
+    TEST_ASSERT_EQUAL(0, TestSamples_uGetItems(&ring_buffer, read_items, 1));
+}
+
+static void test_RingBufferDefine_peek_skip_advance(void)
+{
+    TestSamples_t ring_buffer;
+    uint32_t items [10];
+    uint32_t read_items [10] = {0};
+    uint32_t i;
+
+    for(i = 0; i < LOCAL_ARRAY_LEN(items); i++)
+    {
+        items[i] = 100 + i;
+    }
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestSamples_enInit(&ring_buffer));
+
+    TEST_ASSERT_EQUAL(0, TestSamples_uPeekItems(&ring_buffer, read_items, 1, 0));
+
+    /*  items around the end of ring buffer data  */
+    TEST_ASSERT_EQUAL(8, TestSamples_uAdvance(&ring_buffer, 8));
+    TEST_ASSERT_EQUAL(8, TestSamples_uSkipItems(&ring_buffer, 8));
+    TEST_ASSERT_EQUAL(6, TestSamples_uPutItems(&ring_buffer, items, 6));
+
+    TEST_ASSERT_EQUAL(4, TestSamples_uPeekItems(&ring_buffer, read_items, 10, 2));
+    TEST_ASSERT_EQUAL_MEMORY(&items[2], read_items, 4 * sizeof(uint32_t));
+    TEST_ASSERT_EQUAL(0, TestSamples_uPeekItems(&ring_buffer, read_items, 1, 6));
+    TEST_ASSERT_EQUAL(6, TestSamples_uItemCount(&ring_buffer));
+
+    /*  partial skip and advance  */
+    TEST_ASSERT_EQUAL(4, TestSamples_uAdvance(&ring_buffer, 5));
+    TEST_ASSERT_EQUAL(10, TestSamples_uSkipItems(&ring_buffer, 11));
+    TEST_ASSERT_EQUAL(0, TestSamples_uSkipItems(&ring_buffer, 1));
+}
+
+static void test_RingBufferDefine_wide_items(void)
+{
+    TestRecords_t ring_buffer;
+    test_RingBufferDefine_Record_t records [3];
+    test_RingBufferDefine_Record_t read_record;
+    uint32_t i;
+    uint32_t round;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, TestRecords_enInit(&ring_buffer));
+
+    /*  uint8_t pointers wrap many times  */
+    for(round = 0; round < 200; round++)
+    {
+        for(i = 0; i < LOCAL_ARRAY_LEN(records); i++)
+        {
+            records[i].id = round * 3 + i;
+            memset(records[i].payload, (int)(round + i), sizeof(records[i].payload));
+        }
+
+        TEST_ASSERT_EQUAL(3, TestRecords_uPutItems(&ring_buffer, records, 3));
+        TEST_ASSERT_EQUAL(0, TestRecords_uPutItem(&ring_buffer, &records[0]));
+
+        TEST_ASSERT_EQUAL(1, TestRecords_uGetItem(&ring_buffer, &read_record));
+        TEST_ASSERT_EQUAL_MEMORY(&records[0], &read_record, sizeof(read_record));
+
+        TEST_ASSERT_EQUAL(2, TestRecords_uGetItems(&ring_buffer, records, 3));
+        TEST_ASSERT_EQUAL(round * 3 + 1, records[0].id);
+        TEST_ASSERT_EQUAL(round * 3 + 2, records[1].id);
+        TEST_ASSERT_EQUAL((uint8_t)(round + 2), records[1].payload[0]);
+        TEST_ASSERT_EQUAL((uint8_t)(round + 2), records[1].payload[sizeof(records[1].payload) - 1]);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_define(void)
+{
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferDefine_Invalid_param);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBufferDefine_layout);
+    RUN_TEST(test_RingBufferDefine_put_get_item);
+    RUN_TEST(test_RingBufferDefine_put_get_items_wrap);
+    RUN_TEST(test_RingBufferDefine_peek_skip_advance);
+    RUN_TEST(test_RingBufferDefine_wide_items);
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_define_H_
+#define _test_ring_buffer_define_H_
+
+void test_ring_buffer_define(void);
+
+#endif /* _test_ring_buffer_define_H_    */
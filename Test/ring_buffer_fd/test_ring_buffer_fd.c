@@ -0,0 +1,200 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_fd/ring_buffer_fd.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_fd.h"
+
+#if RING_BUFFER_FD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  move ring buffer pointers to @p index, ring buffer is empty  */
+static void test_RingBufferFd_xMoveTo(RingBuffer_t * ring_buffer, RingBuffer_Counter_t index)
+{
+    RingBuffer_Counter_t count;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enAdvance(ring_buffer, index, &count));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enSkipItems(ring_buffer, index, &count));
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBuffer_enReadFromFd() ---------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBuffer_enReadFromFd_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16];
+    RingBuffer_Item_t items_in [10];
+    RingBuffer_Item_t items_out [10];
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+    int fds [2];
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    TEST_ASSERT_EQUAL(0, pipe(fds));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    test_RingBufferFd_xMoveTo(&ring_buffer, 12);
+
+    TEST_ASSERT_EQUAL(sizeof(items_in), write(fds[1], items_in, sizeof(items_in)));
+
+    /*  free locations wrap, items are read in a single call  */
+    error = RingBuffer_enReadFromFd(&ring_buffer, fds[0], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+    error = RingBuffer_enGetItems(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+
+    /*  end of file  */
+    close(fds[1]);
+
+    error = RingBuffer_enReadFromFd(&ring_buffer, fds[0], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    close(fds[0]);
+}
+
+static void test_RingBuffer_enReadFromFd_full_and_nonblocking(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16];
+    RingBuffer_Item_t items_in [32] = {0};
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Error_t error;
+    int fds [2];
+
+    TEST_ASSERT_EQUAL(0, pipe(fds));
+    TEST_ASSERT_EQUAL(0, fcntl(fds[0], F_SETFL, O_NONBLOCK));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    if(sizeof(RingBuffer_Item_t) > 1)
+    {
+#ifdef DEBUG
+        /*  non blocking fds could cut multi byte items (rejected in debug builds)  */
+        TEST_ASSERT_EQUAL(0, fcntl(fds[1], F_SETFL, O_NONBLOCK));
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enPutItem(&ring_buffer, &items_in[0]));
+
+        error = RingBuffer_enReadFromFd(&ring_buffer, fds[0], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+        TEST_ASSERT_EQUAL(0, count);
+
+        error = RingBuffer_enWriteToFd(&ring_buffer, fds[1], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+        TEST_ASSERT_EQUAL(0, count);
+#endif /*  DEBUG  */
+
+        close(fds[0]);
+        close(fds[1]);
+        return;
+    }
+
+    /*  no data  */
+    error = RingBuffer_enReadFromFd(&ring_buffer, fds[0], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_SYSTEM, error);
+    TEST_ASSERT_EQUAL(EAGAIN, errno);
+    TEST_ASSERT_EQUAL(0, count);
+
+    /*  reads are limited to free locations  */
+    TEST_ASSERT_EQUAL(sizeof(items_in), write(fds[1], items_in, sizeof(items_in)));
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enReadFromFd(&ring_buffer, fds[0], LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(free_count, count);
+
+    error = RingBuffer_enReadFromFd(&ring_buffer, fds[0], LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+/* ------------------------------------------------------------------------- */
+/* -------------------- Test RingBuffer_enWriteToFd() ---------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBuffer_enWriteToFd_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16];
+    RingBuffer_Item_t items_in [10];
+    RingBuffer_Item_t items_out [10];
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+    int fds [2];
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    TEST_ASSERT_EQUAL(0, pipe(fds));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enWriteToFd(&ring_buffer, fds[1], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    test_RingBufferFd_xMoveTo(&ring_buffer, 12);
+
+    error = RingBuffer_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  items wrap, they're written in a single call  */
+    error = RingBuffer_enWriteToFd(&ring_buffer, fds[1], LOCAL_ARRAY_LEN(ring_buffer_data), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+    TEST_ASSERT_EQUAL(sizeof(items_out), read(fds[0], items_out, sizeof(items_out)));
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#endif /*  RING_BUFFER_FD  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_fd(void)
+{
+#if RING_BUFFER_FD
+    RUN_TEST(test_RingBuffer_enReadFromFd_wrap);
+    RUN_TEST(test_RingBuffer_enReadFromFd_full_and_nonblocking);
+    RUN_TEST(test_RingBuffer_enWriteToFd_wrap);
+#endif /*  RING_BUFFER_FD  */
+}
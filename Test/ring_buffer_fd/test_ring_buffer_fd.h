@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_fd_H_
+#define _test_ring_buffer_fd_H_
+
+void test_ring_buffer_fd(void);
+
+#endif /* _test_ring_buffer_fd_H_    */
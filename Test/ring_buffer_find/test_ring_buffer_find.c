@@ -0,0 +1,252 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_find/ring_buffer_find.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_find.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  move ring buffer pointers to @p index, ring buffer is empty  */
+static void test_RingBufferFind_xMoveTo(RingBuffer_t * ring_buffer, RingBuffer_Counter_t index)
+{
+    RingBuffer_Counter_t count;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enAdvance(ring_buffer, index, &count));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enSkipItems(ring_buffer, index, &count));
+}
+
+/*  reference search, position of @p pattern in @p items after @p offset, @p count when not found  */
+static RingBuffer_Counter_t test_RingBufferFind_xSearch(RingBuffer_Item_t const * items, RingBuffer_Counter_t count,
+                                                        RingBuffer_Item_t const * pattern, RingBuffer_Counter_t len, RingBuffer_Counter_t offset)
+{
+    for(RingBuffer_Counter_t i = offset; (i + len) <= count; i++)
+    {
+        if(memcmp(&items[i], pattern, len * sizeof(RingBuffer_Item_t)) == 0)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+/* ------------------------------------------------------------------------- */
+/* ---------------------- Test RingBuffer_enFindItem() --------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBuffer_enFindPattern_Invalid_param(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_Item_t pattern [2] = {0};
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t position;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFindItem(&ring_buffer, NULL, 0, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enFindPattern(&ring_buffer, pattern, LOCAL_ARRAY_LEN(pattern), 0, NULL);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBuffer_enFindPattern(&ring_buffer, pattern, 0, 0, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBuffer_enFindItem_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [128] = {0};
+    RingBuffer_Item_t items [80];
+    RingBuffer_Item_t item;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Counter_t position;
+    RingBuffer_Error_t error;
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items); i++)
+    {
+        items[i] = (RingBuffer_Item_t)(i % 40);
+    }
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    item = 0;
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 0, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+
+    /*  items wrap after 30 items  */
+    test_RingBufferFind_xMoveTo(&ring_buffer, 98);
+
+    error = RingBuffer_enPutItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  in the first span, past vector sizes  */
+    item = 25;
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 0, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(25, position);
+
+    /*  in the second span, after offset  */
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 26, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(65, position);
+
+    item = 35;
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 0, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(35, position);
+
+    /*  offset is the item itself  */
+    item = 39;
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 79, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(79, position);
+
+    /*  not found, search again from the next item added  */
+    item = 40;
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 10, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(80, position);
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFindItem(&ring_buffer, &item, position, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(80, position);
+
+    /*  offset past items  */
+    error = RingBuffer_enFindItem(&ring_buffer, &item, 90, &position);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(90, position);
+}
+
+/* ------------------------------------------------------------------------- */
+/* -------------------- Test RingBuffer_enFindPattern() -------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBuffer_enFindPattern_straddle(void)
+{
+    RingBuffer_Item_t ring_buffer_data [64] = {0};
+    RingBuffer_Item_t items [40];
+    RingBuffer_Item_t pattern [4] = {0xA5, 0x5A, 0xC3, 0x3C};
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Counter_t position;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  pattern @ 20, the end of ring buffer data at every item of the pattern, and around it  */
+    for(RingBuffer_Counter_t end = 17; end <= 25; end++)
+    {
+        memset(items, 0, sizeof(items));
+        memcpy(&items[20], pattern, sizeof(pattern));
+
+        /*  partial patterns before it  */
+        memcpy(&items[5], pattern, 3 * sizeof(RingBuffer_Item_t));
+        items[16] = pattern[0];
+        items[19] = pattern[3];
+
+        error = RingBuffer_enReset(&ring_buffer);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        test_RingBufferFind_xMoveTo(&ring_buffer, (RingBuffer_Counter_t)(LOCAL_ARRAY_LEN(ring_buffer_data) - end));
+
+        error = RingBuffer_enPutItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        error = RingBuffer_enFindPattern(&ring_buffer, pattern, LOCAL_ARRAY_LEN(pattern), 0, &position);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(20, position);
+
+        error = RingBuffer_enFindPattern(&ring_buffer, pattern, LOCAL_ARRAY_LEN(pattern), 21, &position);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items) - LOCAL_ARRAY_LEN(pattern) + 1, position);
+    }
+}
+
+static void test_RingBuffer_enFindPattern_reference(void)
+{
+    RingBuffer_Item_t ring_buffer_data [128] = {0};
+    RingBuffer_Item_t items [90];
+    RingBuffer_Item_t pattern [5];
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Counter_t position;
+    RingBuffer_Counter_t expected;
+    RingBuffer_Error_t error;
+    uint32_t seed = 12345;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  small alphabet, so that patterns match partially or fully in many places  */
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items); i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        items[i] = (RingBuffer_Item_t)((seed >> 16) % 3);
+    }
+
+    for(RingBuffer_Counter_t start = 3; start < LOCAL_ARRAY_LEN(ring_buffer_data); start += 7)
+    {
+        error = RingBuffer_enReset(&ring_buffer);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        test_RingBufferFind_xMoveTo(&ring_buffer, start);
+
+        error = RingBuffer_enPutItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        for(RingBuffer_Counter_t len = 1; len <= LOCAL_ARRAY_LEN(pattern); len++)
+        {
+            for(RingBuffer_Counter_t offset = 0; offset < LOCAL_ARRAY_LEN(items); offset += 11)
+            {
+                /*  patterns taken from items, or not found (3 isn't in items)  */
+                memcpy(pattern, &items[(offset * 7) % (LOCAL_ARRAY_LEN(items) - len)], len * sizeof(RingBuffer_Item_t));
+                pattern[len - 1] = (RingBuffer_Item_t)(((offset % 3) == 0) ? 3 : pattern[len - 1]);
+
+                expected = test_RingBufferFind_xSearch(items, LOCAL_ARRAY_LEN(items), pattern, len, offset);
+
+                error = RingBuffer_enFindPattern(&ring_buffer, pattern, len, offset, &position);
+
+                if(expected == LOCAL_ARRAY_LEN(items))
+                {
+                    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+                    TEST_ASSERT_EQUAL(MAX(offset, LOCAL_ARRAY_LEN(items) - len + 1), position);
+                }
+                else
+                {
+                    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+                    TEST_ASSERT_EQUAL(expected, position);
+                }
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_find(void)
+{
+#ifdef DEBUG
+    RUN_TEST(test_RingBuffer_enFindPattern_Invalid_param);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBuffer_enFindItem_wrap);
+    RUN_TEST(test_RingBuffer_enFindPattern_straddle);
+    RUN_TEST(test_RingBuffer_enFindPattern_reference);
+}
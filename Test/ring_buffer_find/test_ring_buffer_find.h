@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_find_H_
+#define _test_ring_buffer_find_H_
+
+void test_ring_buffer_find(void);
+
+#endif /* _test_ring_buffer_find_H_    */
@@ -0,0 +1,191 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_lossy/ring_buffer_lossy.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_lossy.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+#if RING_BUFFER_LOSSY
+
+/* ------------------------------------------------------------------------- */
+/* --------------------- Test RingBufferLossy_enInit() --------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferLossy_enInit_Not_power_of_2(void)
+{
+    RingBuffer_Item_t ring_buffer_data [12] = {0};
+    RingBufferLossy_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferLossy_enInit(&ring_buffer, ring_buffer_data, 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferLossy_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferLossy put/get items ------------------ */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferLossy_put_get_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferLossy_t ring_buffer;
+    RingBuffer_Item_t items [8];
+    RingBuffer_Item_t item;
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Counter_t lost;
+    RingBuffer_Error_t error;
+
+    error = RingBufferLossy_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferLossy_enGetItem(&ring_buffer, &item, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, lost);
+
+    for(uint32_t i = 0; i < 5; i++)
+    {
+        item = (RingBuffer_Item_t)i;
+
+        error = RingBufferLossy_enPutItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    error = RingBufferLossy_enItemCount(&ring_buffer, &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(5, item_count);
+    TEST_ASSERT_EQUAL(0, lost);
+
+    error = RingBufferLossy_enGetItem(&ring_buffer, &item, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, item);
+    TEST_ASSERT_EQUAL(0, lost);
+
+    /*  more than requested items  */
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(4, item_count);
+    TEST_ASSERT_EQUAL(0, lost);
+    TEST_ASSERT_EQUAL(1, items[0]);
+    TEST_ASSERT_EQUAL(4, items[3]);
+
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, item_count);
+}
+
+static void test_RingBufferLossy_overwrite_oldest(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferLossy_t ring_buffer;
+    RingBuffer_Item_t data [20];
+    RingBuffer_Item_t items [8];
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Counter_t lost;
+    RingBuffer_Error_t error;
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(data); i++)
+    {
+        data[i] = (RingBuffer_Item_t)i;
+    }
+
+    error = RingBufferLossy_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  the producer never stalls, across the end of data  */
+    error = RingBufferLossy_enPutItems(&ring_buffer, data, 5);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferLossy_enPutItems(&ring_buffer, &data[5], 7);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferLossy_enItemCount(&ring_buffer, &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(8, item_count);
+    TEST_ASSERT_EQUAL(4, lost);
+
+    /*  the newest 8 items are left, in order  */
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, 3, &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, item_count);
+    TEST_ASSERT_EQUAL(4, lost);
+    TEST_ASSERT_EQUAL_MEMORY(&data[4], items, 3 * sizeof(RingBuffer_Item_t));
+
+    /*  more items than size in a single put, only the last 8 are written  */
+    error = RingBufferLossy_enPutItems(&ring_buffer, data, LOCAL_ARRAY_LEN(data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(8, item_count);
+    TEST_ASSERT_EQUAL(5 + 12, lost);
+    TEST_ASSERT_EQUAL_MEMORY(&data[12], items, 8 * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, lost);
+}
+
+static void test_RingBufferLossy_torn_items_lost(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferLossy_t ring_buffer;
+    RingBuffer_Item_t data [8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    RingBuffer_Item_t items [8];
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Counter_t lost;
+    RingBuffer_Error_t error;
+
+    error = RingBufferLossy_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferLossy_enPutItems(&ring_buffer, data, LOCAL_ARRAY_LEN(data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  producer is overwriting the 3 oldest items (announced, not published yet)  */
+    ring_buffer.write = 8 + 3;
+
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, 4, &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(4, item_count);
+    TEST_ASSERT_EQUAL(3, lost);
+    TEST_ASSERT_EQUAL_MEMORY(&data[3], items, 4 * sizeof(RingBuffer_Item_t));
+
+    /*  producer is overwriting all items, nothing is returned until they're published  */
+    ring_buffer.write = 8 + 3 + 8;
+
+    error = RingBufferLossy_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, &lost);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, item_count);
+    TEST_ASSERT_EQUAL(1, lost);
+}
+
+#endif /*  RING_BUFFER_LOSSY  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_lossy(void)
+{
+#if RING_BUFFER_LOSSY
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferLossy_enInit_Not_power_of_2);
+#endif /*  DEBUG  */
+
+    RUN_TEST(test_RingBufferLossy_put_get_items);
+    RUN_TEST(test_RingBufferLossy_overwrite_oldest);
+    RUN_TEST(test_RingBufferLossy_torn_items_lost);
+#endif /*  RING_BUFFER_LOSSY  */
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_lossy_H_
+#define _test_ring_buffer_lossy_H_
+
+void test_ring_buffer_lossy(void);
+
+#endif /* _test_ring_buffer_lossy_H_    */
@@ -0,0 +1,215 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mirror/ring_buffer_mirror.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_mirror.h"
+
+#if RING_BUFFER_MIRROR && defined(__linux__)
+
+#include <unistd.h>
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  smallest power of 2 number of items that fills whole pages  */
+static RingBuffer_Counter_t test_RingBufferMirror_xSize(void)
+{
+    RingBuffer_Counter_t size = 1;
+
+    while(((size_t)size * sizeof(RingBuffer_Item_t)) % (size_t)sysconf(_SC_PAGESIZE))
+    {
+        size *= 2;
+    }
+
+    return size;
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferMirror_enCreate() -------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferMirror_enCreate_Not_page_size(void)
+{
+    RingBuffer_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMirror_enCreate(&ring_buffer, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferMirror_enCreate(&ring_buffer, (RingBuffer_Counter_t)(test_RingBufferMirror_xSize() / 2));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+static void test_RingBufferMirror_enCreate_mirrored_data(void)
+{
+    RingBuffer_Counter_t size = test_RingBufferMirror_xSize();
+    RingBuffer_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMirror_enCreate(&ring_buffer, size);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  both halves are the same locations  */
+    ring_buffer.data[3] = 0x5A;
+    TEST_ASSERT_EQUAL(0x5A, ring_buffer.data[size + 3]);
+
+    ring_buffer.data[size + 7] = 0x3C;
+    TEST_ASSERT_EQUAL(0x3C, ring_buffer.data[7]);
+
+    error = RingBufferMirror_enDestroy(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+static void test_RingBufferMirror_enReset_keeps_mirror(void)
+{
+    RingBuffer_Counter_t size = test_RingBufferMirror_xSize();
+    RingBuffer_Item_t item = 0x5A;
+    RingBuffer_Counter_t count;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMirror_enCreate(&ring_buffer, size);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enReset(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  ring buffer is empty, and still mirrored  */
+    error = RingBuffer_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+    TEST_ASSERT_EQUAL(1, ring_buffer.mirror);
+    TEST_ASSERT_EQUAL(size, ring_buffer.size);
+
+    error = RingBufferMirror_enDestroy(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------ Test mirrored ring buffer functions ------------------ */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferMirror_block_across_end(void)
+{
+    RingBuffer_Counter_t size = test_RingBufferMirror_xSize();
+    RingBuffer_Item_t items_in [64];
+    RingBuffer_Item_t items_out [64];
+    RingBuffer_Item_t * block;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t count;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    error = RingBufferMirror_enCreate(&ring_buffer, size);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  move pointers 32 locations before the end of data  */
+    error = RingBuffer_enAdvance(&ring_buffer, (RingBuffer_Counter_t)(size - 32), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enSkipItems(&ring_buffer, (RingBuffer_Counter_t)(size - 32), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  free locations are a single block, across the end of data  */
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enBlockWriteCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(free_count, count);
+
+    error = RingBuffer_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+    /*  items are a single block, across the end of data  */
+    error = RingBuffer_enBlockReadCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+    error = RingBuffer_enBlockReadAddress(&ring_buffer, &block);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(&ring_buffer.data[size - 32], block);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, block, LOCAL_ARRAY_LEN(items_in) * sizeof(RingBuffer_Item_t));
+
+    /*  wrapped items are in the first half too  */
+    TEST_ASSERT_EQUAL_MEMORY(&items_in[32], ring_buffer.data, 32 * sizeof(RingBuffer_Item_t));
+
+    error = RingBuffer_enPeekItems(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), 0, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, LOCAL_ARRAY_LEN(items_in) * sizeof(RingBuffer_Item_t));
+
+    memset(items_out, 0, sizeof(items_out));
+
+    error = RingBuffer_enGetItems(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, LOCAL_ARRAY_LEN(items_in) * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferMirror_enDestroy(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+static void test_RingBufferMirror_enAcquire_single_span(void)
+{
+    RingBuffer_Counter_t size = test_RingBufferMirror_xSize();
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t count;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMirror_enCreate(&ring_buffer, size);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enAdvance(&ring_buffer, (RingBuffer_Counter_t)(size - 8), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enSkipItems(&ring_buffer, (RingBuffer_Counter_t)(size - 8), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enReserve(&ring_buffer, 16, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(16, first.count);
+    TEST_ASSERT_EQUAL(0, second.count);
+
+    error = RingBuffer_enCommit(&ring_buffer, 16);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enAcquire(&ring_buffer, 16, &first, &second, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(16, first.count);
+    TEST_ASSERT_EQUAL(0, second.count);
+
+    error = RingBufferMirror_enDestroy(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+#endif /*  RING_BUFFER_MIRROR && __linux__  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_mirror(void)
+{
+#if RING_BUFFER_MIRROR && defined(__linux__)
+    RUN_TEST(test_RingBufferMirror_enCreate_Not_page_size);
+    RUN_TEST(test_RingBufferMirror_enCreate_mirrored_data);
+    RUN_TEST(test_RingBufferMirror_enReset_keeps_mirror);
+    RUN_TEST(test_RingBufferMirror_block_across_end);
+    RUN_TEST(test_RingBufferMirror_enAcquire_single_span);
+#endif /*  RING_BUFFER_MIRROR && __linux__  */
+}
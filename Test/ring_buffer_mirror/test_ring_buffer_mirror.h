@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_mirror_H_
+#define _test_ring_buffer_mirror_H_
+
+void test_ring_buffer_mirror(void);
+
+#endif /* _test_ring_buffer_mirror_H_    */
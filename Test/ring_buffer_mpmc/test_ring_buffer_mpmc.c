@@ -0,0 +1,181 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mpmc/ring_buffer_mpmc.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_mpmc.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*
+ * MPMC ring buffer needs atomic ring buffer counters,
+ * test cases are only built with -DRING_BUFFER_ATOMIC
+ * */
+#if RING_BUFFER_MPMC
+
+/* ------------------------------------------------------------------------- */
+/* --------------------- Test RingBufferMPMC_enInit() ---------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferMPMC_enInit_NULL_slots(void)
+{
+    RingBufferMPMC_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPMC_enInit(&ring_buffer, NULL, 8);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+}
+
+static void test_RingBufferMPMC_enInit_Not_power_of_two(void)
+{
+    RingBufferMPMC_Slot_t slots [10];
+    RingBufferMPMC_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPMC_enInit(&ring_buffer, slots, LOCAL_ARRAY_LEN(slots));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBufferMPMC_enInit_Success(void)
+{
+    RingBufferMPMC_Slot_t slots [8];
+    RingBufferMPMC_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Item_t item;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPMC_enInit(&ring_buffer, slots, LOCAL_ARRAY_LEN(slots));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(slots, ring_buffer.slots);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(slots), ring_buffer.size);
+
+    error = RingBufferMPMC_enItemCount(&ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBufferMPMC_enGetItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+}
+
+static void test_RingBufferMPMC_Slot_padding(void)
+{
+    /*  adjacent slots, and producers & consumers positions are on different cache lines  */
+    TEST_ASSERT_EQUAL(0, sizeof(RingBufferMPMC_Slot_t) % RING_BUFFER_MPMC_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL(TRUE, offsetof(RingBufferMPMC_t, dequeue) - offsetof(RingBufferMPMC_t, enqueue) >= RING_BUFFER_MPMC_CACHE_LINE_SIZE);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------- Test RingBufferMPMC_enPutItem/enGetItem() ----------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferMPMC_put_get_full_empty(void)
+{
+    RingBufferMPMC_Slot_t slots [8];
+    RingBufferMPMC_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Item_t item;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPMC_enInit(&ring_buffer, slots, LOCAL_ARRAY_LEN(slots));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  all `size` slots are usable, on every lap  */
+    for(uint32_t lap = 0; lap < 3; lap++)
+    {
+        for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(slots); i++)
+        {
+            item = (RingBuffer_Item_t)(i + lap + 1);
+            error = RingBufferMPMC_enPutItem(&ring_buffer, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        }
+
+        error = RingBufferMPMC_enPutItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+        error = RingBufferMPMC_enItemCount(&ring_buffer, &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(slots), count);
+
+        for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(slots); i++)
+        {
+            error = RingBufferMPMC_enGetItem(&ring_buffer, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(i + lap + 1, item);
+        }
+
+        error = RingBufferMPMC_enGetItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    }
+}
+
+static void test_RingBufferMPMC_put_get_interleaved(void)
+{
+    RingBufferMPMC_Slot_t slots [4];
+    RingBufferMPMC_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Item_t item;
+    RingBuffer_Item_t expected = 0;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPMC_enInit(&ring_buffer, slots, LOCAL_ARRAY_LEN(slots));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  put 2, get 1: positions wrap around 8-bit counters  */
+    for(uint32_t i = 0; i < 300; i++)
+    {
+        item = (RingBuffer_Item_t)(2 * i);
+        RingBufferMPMC_enPutItem(&ring_buffer, &item);
+        item = (RingBuffer_Item_t)(2 * i + 1);
+        RingBufferMPMC_enPutItem(&ring_buffer, &item);
+
+        error = RingBufferMPMC_enGetItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(expected, item);
+        expected++;
+
+        error = RingBufferMPMC_enItemCount(&ring_buffer, &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        if(count == (LOCAL_ARRAY_LEN(slots) - 1))
+        {
+            /*  drain before next put overflows  */
+            while(RingBufferMPMC_enGetItem(&ring_buffer, &item) == RING_BUFFER_ERROR_NONE)
+            {
+                TEST_ASSERT_EQUAL(expected, item);
+                expected++;
+            }
+
+            TEST_ASSERT_EQUAL((RingBuffer_Item_t)(2 * i + 2), expected);
+        }
+    }
+}
+
+#endif /*  RING_BUFFER_MPMC  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_mpmc(void)
+{
+#if RING_BUFFER_MPMC
+
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferMPMC_enInit_NULL_slots);
+    RUN_TEST(test_RingBufferMPMC_enInit_Not_power_of_two);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBufferMPMC_enInit_Success);
+    RUN_TEST(test_RingBufferMPMC_Slot_padding);
+
+    RUN_TEST(test_RingBufferMPMC_put_get_full_empty);
+    RUN_TEST(test_RingBufferMPMC_put_get_interleaved);
+
+#endif /*  RING_BUFFER_MPMC  */
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_mpmc_H_
+#define _test_ring_buffer_mpmc_H_
+
+void test_ring_buffer_mpmc(void);
+
+#endif /* _test_ring_buffer_mpmc_H_    */
@@ -0,0 +1,246 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_mpsc/ring_buffer_mpsc.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_mpsc.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*
+ * MPSC ring buffer needs atomic free running ring buffer pointers,
+ * test cases are only built with -DRING_BUFFER_ATOMIC -DRING_BUFFER_FREE_RUNNING
+ * */
+#if RING_BUFFER_MPSC
+
+/* ------------------------------------------------------------------------- */
+/* --------------------- Test RingBufferMPSC_enInit() ---------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferMPSC_enInit_NULL_commit(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, NULL, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+}
+
+static void test_RingBufferMPSC_enInit_Not_power_of_two(void)
+{
+    RingBuffer_Item_t ring_buffer_data [10] = {0};
+    RingBuffer_SharedCounter_t commit [10];
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, commit, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBufferMPSC_enInit_Success(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_SharedCounter_t commit [8];
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, commit, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL_PTR(commit, ring_buffer.commit);
+    TEST_ASSERT_EQUAL(0, ring_buffer.claim);
+
+    error = RingBuffer_enItemCount(&ring_buffer.ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    /*  no location is committed for the first lap  */
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(commit); i++)
+    {
+        TEST_ASSERT_EQUAL(FALSE, (commit[i] == i));
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferMPSC_enPutItem() --------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferMPSC_enPutItem_full(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_SharedCounter_t commit [8];
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Item_t item;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, commit, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  wrap around ring buffer size twice  */
+    for(uint32_t lap = 0; lap < 2; lap++)
+    {
+        for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(ring_buffer_data); i++)
+        {
+            item = (RingBuffer_Item_t)(i + lap + 1);
+            error = RingBufferMPSC_enPutItem(&ring_buffer, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        }
+
+        error = RingBufferMPSC_enPutItem(&ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+        for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(ring_buffer_data); i++)
+        {
+            error = RingBuffer_enGetItem(&ring_buffer.ring_buffer, &item);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(i + lap + 1, item);
+        }
+
+        error = RingBuffer_enGetItem(&ring_buffer.ring_buffer, &item);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferMPSC_enPutItems() -------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferMPSC_enPutItems_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_SharedCounter_t commit [8];
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Item_t items_in [6] = {1, 2, 3, 4, 5, 6};
+    RingBuffer_Item_t items_out [6] = {0};
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, commit, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  second and third batch are split at the end of ring buffer data  */
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        error = RingBufferMPSC_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+
+        error = RingBuffer_enGetItems(&ring_buffer.ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_out), count);
+        TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+    }
+}
+
+static void test_RingBufferMPSC_enPutItems_insufficient_space(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_SharedCounter_t commit [8];
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Item_t items_in [6] = {1, 2, 3, 4, 5, 6};
+    RingBuffer_Item_t items_out [8] = {0};
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, commit, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferMPSC_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(6, count);
+
+    error = RingBufferMPSC_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(2, count);
+
+    error = RingBufferMPSC_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBuffer_enGetItems(&ring_buffer.ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(8, count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+    TEST_ASSERT_EQUAL_MEMORY(items_in, &items_out[6], 2 * sizeof(RingBuffer_Item_t));
+}
+
+static void test_RingBufferMPSC_enPutItems_uncommitted_claim(void)
+{
+    RingBuffer_Item_t ring_buffer_data [8] = {0};
+    RingBuffer_SharedCounter_t commit [8];
+    RingBufferMPSC_t ring_buffer;
+    RingBuffer_Item_t items_in [3] = {4, 5, 6};
+    RingBuffer_Item_t items_out [8] = {0};
+    RingBuffer_Item_t item = 1;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferMPSC_enInit(&ring_buffer, ring_buffer_data, commit, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  a producer claims location 0, and is preempted before committing it  */
+    ring_buffer.claim = 1;
+
+    /*  items committed after an uncommitted location are not visible to the consumer  */
+    error = RingBufferMPSC_enPutItems(&ring_buffer, items_in, LOCAL_ARRAY_LEN(items_in), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, count);
+
+    error = RingBuffer_enItemCount(&ring_buffer.ring_buffer, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    error = RingBuffer_enGetItem(&ring_buffer.ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+
+    /*  preempted producer writes & commits location 0  */
+    ring_buffer_data[0] = 3;
+    commit[0] = 0;
+
+    /*  next put publishes all committed items  */
+    item = 7;
+    error = RingBufferMPSC_enPutItem(&ring_buffer, &item);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enGetItems(&ring_buffer.ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(5, count);
+
+    for(uint32_t i = 0; i < count; i++)
+    {
+        TEST_ASSERT_EQUAL(i + 3, items_out[i]);
+    }
+}
+
+#endif /*  RING_BUFFER_MPSC  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_mpsc(void)
+{
+#if RING_BUFFER_MPSC
+
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferMPSC_enInit_NULL_commit);
+    RUN_TEST(test_RingBufferMPSC_enInit_Not_power_of_two);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBufferMPSC_enInit_Success);
+
+    RUN_TEST(test_RingBufferMPSC_enPutItem_full);
+
+    RUN_TEST(test_RingBufferMPSC_enPutItems_wrap);
+    RUN_TEST(test_RingBufferMPSC_enPutItems_insufficient_space);
+    RUN_TEST(test_RingBufferMPSC_enPutItems_uncommitted_claim);
+
+#endif /*  RING_BUFFER_MPSC  */
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_mpsc_H_
+#define _test_ring_buffer_mpsc_H_
+
+void test_ring_buffer_mpsc(void);
+
+#endif /* _test_ring_buffer_mpsc_H_    */
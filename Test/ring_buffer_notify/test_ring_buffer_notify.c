@@ -0,0 +1,183 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_notify/ring_buffer_notify.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_notify.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+#if RING_BUFFER_NOTIFY
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/**
+ * @brief Wait up to @p timeout_ms for notifier eventfd in epoll set @p epoll_fd, return number of ready fds
+ */
+static int test_notify_wait(int epoll_fd, int timeout_ms)
+{
+    struct epoll_event event;
+
+    return epoll_wait(epoll_fd, &event, 1, timeout_ms);
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------- Test RingBufferNotify_enInit() -------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferNotify_enInit_Invalid_threshold(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    RingBufferNotify_t notify;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferNotify_enInit(&notify, &ring_buffer, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferNotify_enInit(&notify, &ring_buffer, (RingBuffer_Counter_t)(free_count + 1));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferNotify_enInit(&notify, &ring_buffer, free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferNotify_enDeinit(&notify);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferNotify epoll signals ----------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferNotify_empty_to_non_empty(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_Item_t items [4] = { 1, 2, 3, 4 };
+    RingBuffer_t ring_buffer;
+    RingBufferNotify_t notify;
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Error_t error;
+    struct epoll_event event = { .events = EPOLLIN };
+    uint64_t value = 0;
+    int epoll_fd;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferNotify_enInit(&notify, &ring_buffer, 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    epoll_fd = epoll_create1(0);
+    TEST_ASSERT_EQUAL(TRUE, epoll_fd >= 0);
+    TEST_ASSERT_EQUAL(0, epoll_ctl(epoll_fd, EPOLL_CTL_ADD, notify.fd, &event));
+
+    TEST_ASSERT_EQUAL(0, test_notify_wait(epoll_fd, 0));
+
+    /*  a burst of puts writes the eventfd once  */
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        error = RingBufferNotify_enPutItems(&notify, items, LOCAL_ARRAY_LEN(items), &item_count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    }
+
+    TEST_ASSERT_EQUAL(1, test_notify_wait(epoll_fd, 1000));
+
+    TEST_ASSERT_EQUAL(sizeof(value), read(notify.fd, &value, sizeof(value)));
+    TEST_ASSERT_EQUAL(1, value);
+
+    /*  consumer acknowledges, then gets items  */
+    error = RingBufferNotify_enAcknowledge(&notify);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(0, test_notify_wait(epoll_fd, 0));
+
+    error = RingBuffer_enGetItems(&ring_buffer, ring_buffer_data, 12, &item_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  next put signals again  */
+    error = RingBufferNotify_enPutItems(&notify, items, 1, &item_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(1, test_notify_wait(epoll_fd, 1000));
+
+    error = RingBufferNotify_enAcknowledge(&notify);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(0, test_notify_wait(epoll_fd, 0));
+
+    close(epoll_fd);
+
+    error = RingBufferNotify_enDeinit(&notify);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+static void test_RingBufferNotify_threshold(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_Item_t items [4] = { 1, 2, 3, 4 };
+    RingBuffer_t ring_buffer;
+    RingBufferNotify_t notify;
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Error_t error;
+    struct epoll_event event = { .events = EPOLLIN };
+    int epoll_fd;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferNotify_enInit(&notify, &ring_buffer, 6);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    epoll_fd = epoll_create1(0);
+    TEST_ASSERT_EQUAL(TRUE, epoll_fd >= 0);
+    TEST_ASSERT_EQUAL(0, epoll_ctl(epoll_fd, EPOLL_CTL_ADD, notify.fd, &event));
+
+    /*  below the threshold  */
+    error = RingBufferNotify_enPutItems(&notify, items, 4, &item_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(0, test_notify_wait(epoll_fd, 0));
+
+    /*  items added by other ring buffer functions  */
+    error = RingBuffer_enPutItem(&ring_buffer, items);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    error = RingBuffer_enPutItem(&ring_buffer, items);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferNotify_enSignal(&notify);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(1, test_notify_wait(epoll_fd, 1000));
+
+    close(epoll_fd);
+
+    error = RingBufferNotify_enDeinit(&notify);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+#endif /*  RING_BUFFER_NOTIFY  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_notify(void)
+{
+#if RING_BUFFER_NOTIFY
+    RUN_TEST(test_RingBufferNotify_enInit_Invalid_threshold);
+    RUN_TEST(test_RingBufferNotify_empty_to_non_empty);
+    RUN_TEST(test_RingBufferNotify_threshold);
+#endif /*  RING_BUFFER_NOTIFY  */
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_notify_H_
+#define _test_ring_buffer_notify_H_
+
+void test_ring_buffer_notify(void);
+
+#endif /* _test_ring_buffer_notify_H_    */
@@ -0,0 +1,237 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_reader/ring_buffer_reader.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_reader.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  put string @p text (without its null terminator) into @p ring_buffer  */
+static void test_RingBufferReader_xPut(RingBuffer_t * ring_buffer, char const * text)
+{
+    RingBuffer_Counter_t count;
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, RingBuffer_enPutItems(ring_buffer, (RingBuffer_Item_t const *)text, (RingBuffer_Counter_t)strlen(text), &count));
+}
+
+/*  check frame spans @p first and @p second hold string @p text  */
+static void test_RingBufferReader_xCheckFrame(RingBuffer_Span_t const * first, RingBuffer_Span_t const * second, RingBuffer_Counter_t frame_len, char const * text)
+{
+    TEST_ASSERT_EQUAL(strlen(text), frame_len);
+    TEST_ASSERT_EQUAL(frame_len, first->count + second->count);
+    TEST_ASSERT_EQUAL_MEMORY(text, first->data, first->count);
+
+    if(second->count)
+    {
+        TEST_ASSERT_EQUAL_MEMORY(&text[first->count], second->data, second->count);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* -------------------------- Test RingBufferReader ------------------------ */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferReader_Invalid_param(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_t ring_buffer;
+    RingBufferReader_t reader;
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t frame_len;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enInit(&reader, &ring_buffer, NULL, 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBufferReader_enInit(&reader, &ring_buffer, (RingBuffer_Item_t const *)"\n", 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferReader_enInit(&reader, &ring_buffer, (RingBuffer_Item_t const *)"\n", 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enNext(&reader, &first, NULL, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    error = RingBufferReader_enConsume(NULL, 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NULLPTR, error);
+
+    (void)second;
+}
+
+#endif /*  DEBUG  */
+
+static void test_RingBufferReader_lines(void)
+{
+    RingBuffer_Item_t ring_buffer_data [32] = {0};
+    RingBuffer_t ring_buffer;
+    RingBufferReader_t reader;
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t frame_len;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enInit(&reader, &ring_buffer, (RingBuffer_Item_t const *)"\n", 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, frame_len);
+
+    test_RingBufferReader_xPut(&ring_buffer, "ab\n\ncd");
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    test_RingBufferReader_xCheckFrame(&first, &second, frame_len, "ab\n");
+
+    /*  same frame until it's consumed  */
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    test_RingBufferReader_xCheckFrame(&first, &second, frame_len, "ab\n");
+
+    error = RingBufferReader_enConsume(&reader, frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  empty line  */
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    test_RingBufferReader_xCheckFrame(&first, &second, frame_len, "\n");
+
+    error = RingBufferReader_enConsume(&reader, frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  partial line stays in the ring buffer, its items are searched once  */
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(0, frame_len);
+    TEST_ASSERT_EQUAL(2, reader.scanned);
+
+    test_RingBufferReader_xPut(&ring_buffer, "ef\ng");
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    test_RingBufferReader_xCheckFrame(&first, &second, frame_len, "cdef\n");
+
+    error = RingBufferReader_enConsume(&reader, frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, reader.scanned);
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+}
+
+static void test_RingBufferReader_delimiter_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [32] = {0};
+    RingBuffer_t ring_buffer;
+    RingBufferReader_t reader;
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t frame_len;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enInit(&reader, &ring_buffer, (RingBuffer_Item_t const *)"\r\n", 2);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  end of ring buffer data between "\r" and "\n"  */
+    error = RingBuffer_enAdvance(&ring_buffer, 26, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    error = RingBuffer_enSkipItems(&ring_buffer, 26, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  "\r" alone isn't a delimiter  */
+    test_RingBufferReader_xPut(&ring_buffer, "hel\rlo\r");
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INSUFFICIENT_ITEMS, error);
+    TEST_ASSERT_EQUAL(6, reader.scanned);
+
+    test_RingBufferReader_xPut(&ring_buffer, "\nworld\r\n");
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(6, first.count);
+    test_RingBufferReader_xCheckFrame(&first, &second, frame_len, "hel\rlo\r\n");
+
+    error = RingBufferReader_enConsume(&reader, frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(0, second.count);
+    test_RingBufferReader_xCheckFrame(&first, &second, frame_len, "world\r\n");
+}
+
+static void test_RingBufferReader_frame_too_long(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_Item_t items [16];
+    RingBuffer_t ring_buffer;
+    RingBufferReader_t reader;
+    RingBuffer_Span_t first;
+    RingBuffer_Span_t second;
+    RingBuffer_Counter_t frame_len;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    memset(items, 'x', sizeof(items));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferReader_enInit(&reader, &ring_buffer, (RingBuffer_Item_t const *)"\n", 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enPutItems(&ring_buffer, items, free_count, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  no delimiter and no room for it  */
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+    TEST_ASSERT_EQUAL(free_count, reader.scanned);
+
+    /*  drop the start of the frame, the rest is searched again only from the new items  */
+    error = RingBufferReader_enConsume(&reader, 10);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(free_count - 10, reader.scanned);
+
+    test_RingBufferReader_xPut(&ring_buffer, "\n");
+
+    error = RingBufferReader_enNext(&reader, &first, &second, &frame_len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(free_count - 10 + 1, frame_len);
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_reader(void)
+{
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferReader_Invalid_param);
+#endif /*  DEBUG  */
+    RUN_TEST(test_RingBufferReader_lines);
+    RUN_TEST(test_RingBufferReader_delimiter_wrap);
+    RUN_TEST(test_RingBufferReader_frame_too_long);
+}
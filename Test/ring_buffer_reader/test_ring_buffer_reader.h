@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_reader_H_
+#define _test_ring_buffer_reader_H_
+
+void test_ring_buffer_reader(void);
+
+#endif /* _test_ring_buffer_reader_H_    */
@@ -0,0 +1,185 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_record/ring_buffer_record.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_record.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/* ------------------------------------------------------------------------- */
+/* -------------------- Test RingBufferRecord_enInit() --------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferRecord_enInit_Too_small(void)
+{
+    RingBuffer_Item_t ring_buffer_data [2 * RING_BUFFER_RECORD_ALIGN(RING_BUFFER_RECORD_HEADER_ITEMS + 1)] = {0};
+    RingBufferRecord_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferRecord_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data) - RING_BUFFER_RECORD_ALIGNMENT);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+static void test_RingBufferRecord_enPutRecord_Too_large(void)
+{
+    RingBuffer_Item_t ring_buffer_data [64] = {0};
+    RingBuffer_Item_t items [64] = {0};
+    RingBufferRecord_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferRecord_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    /*  record uses more than half of ring buffer data  */
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items, (32 - RING_BUFFER_RECORD_HEADER_ITEMS) + 1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items, (32 - RING_BUFFER_RECORD_HEADER_ITEMS));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+#endif /*  DEBUG  */
+
+/* ------------------------------------------------------------------------- */
+/* ---------------- Test RingBufferRecord put/get records ------------------ */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferRecord_put_get_record(void)
+{
+    RingBuffer_Item_t ring_buffer_data [64] = {0};
+    RingBuffer_Item_t items_in [] = {1, 2, 3, 4, 5};
+    RingBuffer_Item_t items_out [8] = {0};
+    RingBufferRecord_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferRecord_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enGetRecord(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+    TEST_ASSERT_EQUAL(0, count);
+
+    /*  records keep their boundaries  */
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items_in, 2);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enPutRecord(&ring_buffer, &items_in[2], 3);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enGetRecord(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(2, count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, 2 * sizeof(RingBuffer_Item_t));
+
+    /*  record doesn't fit in items, it's not removed  */
+    error = RingBufferRecord_enGetRecord(&ring_buffer, items_out, 2, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+    TEST_ASSERT_EQUAL(3, count);
+
+    error = RingBufferRecord_enGetRecord(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(3, count);
+    TEST_ASSERT_EQUAL_MEMORY(&items_in[2], items_out, 3 * sizeof(RingBuffer_Item_t));
+
+    error = RingBufferRecord_enSkipRecord(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+}
+
+static void test_RingBufferRecord_put_record_full(void)
+{
+    RingBuffer_Item_t ring_buffer_data [64] = {0};
+    RingBuffer_Item_t items_in [32] = {0};
+    RingBufferRecord_t ring_buffer;
+    RingBuffer_Counter_t len = 32 - RING_BUFFER_RECORD_HEADER_ITEMS - RING_BUFFER_RECORD_ALIGNMENT;
+    RingBuffer_Error_t error;
+
+    error = RingBufferRecord_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  2 records using (32 - alignment) items, a third record doesn't fit  */
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items_in, len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items_in, len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items_in, len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    /*  third record needs padding before it, it fits once both records are read  */
+    error = RingBufferRecord_enSkipRecord(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enSkipRecord(&ring_buffer);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferRecord_enPutRecord(&ring_buffer, items_in, len);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+}
+
+static void test_RingBufferRecord_peek_record_wrap(void)
+{
+    RingBuffer_Item_t ring_buffer_data [64] = {0};
+    RingBuffer_Item_t items_in [12];
+    RingBufferRecord_t ring_buffer;
+    RingBuffer_Item_t * record;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    error = RingBufferRecord_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  records of 1 to 12 items, over several laps: each record is contiguous in ring buffer data  */
+    for(uint32_t lap = 0; lap < 4; lap++)
+    {
+        for(RingBuffer_Counter_t len = 1; len <= LOCAL_ARRAY_LEN(items_in); len++)
+        {
+            error = RingBufferRecord_enPutRecord(&ring_buffer, items_in, len);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+            error = RingBufferRecord_enPeekRecord(&ring_buffer, &record, &count);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+            TEST_ASSERT_EQUAL(len, count);
+            TEST_ASSERT_EQUAL(TRUE, (record >= ring_buffer_data) && ((record + count) <= &ring_buffer_data[LOCAL_ARRAY_LEN(ring_buffer_data)]));
+            TEST_ASSERT_EQUAL(0, (size_t)(record - ring_buffer_data) % RING_BUFFER_RECORD_ALIGNMENT);
+            TEST_ASSERT_EQUAL_MEMORY(items_in, record, len * sizeof(RingBuffer_Item_t));
+
+            error = RingBufferRecord_enSkipRecord(&ring_buffer);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        }
+    }
+
+    error = RingBufferRecord_enPeekRecord(&ring_buffer, &record, &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+}
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_record(void)
+{
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferRecord_enInit_Too_small);
+    RUN_TEST(test_RingBufferRecord_enPutRecord_Too_large);
+#endif /*  DEBUG  */
+
+    RUN_TEST(test_RingBufferRecord_put_get_record);
+    RUN_TEST(test_RingBufferRecord_put_record_full);
+    RUN_TEST(test_RingBufferRecord_peek_record_wrap);
+}
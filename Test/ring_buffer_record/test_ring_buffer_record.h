@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_record_H_
+#define _test_ring_buffer_record_H_
+
+void test_ring_buffer_record(void);
+
+#endif /* _test_ring_buffer_record_H_    */
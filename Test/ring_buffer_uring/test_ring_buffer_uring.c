@@ -0,0 +1,250 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_uring/ring_buffer_uring.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_uring.h"
+
+#if RING_BUFFER_URING
+
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+/*  create an unlinked temporary file  */
+static int test_RingBufferUring_xTempFile(void)
+{
+    char path [] = "/tmp/test_ring_buffer_uring_XXXXXX";
+    int fd = mkstemp(path);
+
+    TEST_ASSERT_EQUAL(TRUE, fd >= 0);
+    TEST_ASSERT_EQUAL(0, unlink(path));
+
+    return fd;
+}
+
+/*  io_uring may be disabled (containers, io_uring_disabled sysctl)  */
+static uint8_t test_RingBufferUring_xAvailable(RingBufferUring_t * engine, RingBufferUring_Channel_t * channels, uint32_t channel_count)
+{
+    RingBuffer_Error_t error = RingBufferUring_enInit(engine, channels, channel_count);
+
+    if((error == RING_BUFFER_ERROR_SYSTEM) && ((errno == ENOSYS) || (errno == EPERM)))
+    {
+        TEST_IGNORE_MESSAGE("io_uring is not available");
+    }
+
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------ Test io_uring channels ------------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferUring_read_channel(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16];
+    RingBuffer_Item_t items_in [100];
+    RingBuffer_Item_t items_out [100];
+    RingBufferUring_Channel_t channel;
+    RingBufferUring_t engine;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+    uint32_t complete_count;
+    uint32_t read_count = 0;
+    int fd;
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    fd = test_RingBufferUring_xTempFile();
+    TEST_ASSERT_EQUAL(sizeof(items_in), write(fd, items_in, sizeof(items_in)));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferUring_enChannelInit(&channel, &ring_buffer, fd, RING_BUFFER_URING_READ, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    test_RingBufferUring_xAvailable(&engine, &channel, 1);
+
+    /*  file is read through a ring buffer smaller than the file, across the end of ring buffer data  */
+    while(!channel.eof)
+    {
+        error = RingBufferUring_enSubmit(&engine);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        error = RingBufferUring_enComplete(&engine, 1, &complete_count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(1, complete_count);
+        TEST_ASSERT_EQUAL(0, channel.error);
+
+        error = RingBuffer_enGetItems(&ring_buffer, &items_out[read_count], 5, &count);
+        TEST_ASSERT_EQUAL(TRUE, (error == RING_BUFFER_ERROR_NONE) || (error == RING_BUFFER_ERROR_INSUFFICIENT_ITEMS) || (error == RING_BUFFER_ERROR_EMPTY));
+        read_count += count;
+    }
+
+    while(RingBuffer_enGetItems(&ring_buffer, &items_out[read_count], 5, &count) != RING_BUFFER_ERROR_EMPTY)
+    {
+        read_count += count;
+    }
+
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), read_count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+
+    error = RingBufferUring_enDeinit(&engine);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    close(fd);
+}
+
+static void test_RingBufferUring_stream_partial_items(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBuffer_Item_t items_in [8];
+    RingBuffer_Item_t items_out [8] = {0};
+    RingBufferUring_Channel_t channel;
+    RingBufferUring_t engine;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+    uint32_t complete_count;
+    size_t written = 0;
+    int fds [2];
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)(i + 1);
+    }
+
+    TEST_ASSERT_EQUAL(0, pipe(fds));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferUring_enChannelInit(&channel, &ring_buffer, fds[0], RING_BUFFER_URING_READ, -1);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    test_RingBufferUring_xAvailable(&engine, &channel, 1);
+
+    /*  stream delivers 3 bytes at a time, items larger than a byte end up split across requests  */
+    while(written < sizeof(items_in))
+    {
+        size_t len = MIN(3, sizeof(items_in) - written);
+
+        TEST_ASSERT_EQUAL(len, write(fds[1], (uint8_t *)items_in + written, len));
+        written += len;
+
+        error = RingBufferUring_enSubmit(&engine);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        error = RingBufferUring_enComplete(&engine, 1, &complete_count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(1, complete_count);
+        TEST_ASSERT_EQUAL(0, channel.error);
+    }
+
+    close(fds[1]);
+
+    error = RingBufferUring_enSubmit(&engine);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferUring_enComplete(&engine, 1, &complete_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(1, channel.eof);
+
+    /*  no bytes are lost or duplicated  */
+    error = RingBuffer_enGetItems(&ring_buffer, items_out, LOCAL_ARRAY_LEN(items_out), &count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(LOCAL_ARRAY_LEN(items_in), count);
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+
+    error = RingBufferUring_enDeinit(&engine);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    close(fds[0]);
+}
+
+static void test_RingBufferUring_copy_channels(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16];
+    RingBuffer_Item_t items_in [1000];
+    RingBuffer_Item_t items_out [1000];
+    RingBufferUring_Channel_t channels [2];
+    RingBufferUring_t engine;
+    RingBuffer_t ring_buffer;
+    RingBuffer_Counter_t count;
+    RingBuffer_Error_t error;
+    uint32_t complete_count;
+    int fd_in;
+    int fd_out;
+
+    for(uint32_t i = 0; i < LOCAL_ARRAY_LEN(items_in); i++)
+    {
+        items_in[i] = (RingBuffer_Item_t)((i * 7) + 3);
+    }
+
+    fd_in = test_RingBufferUring_xTempFile();
+    fd_out = test_RingBufferUring_xTempFile();
+    TEST_ASSERT_EQUAL(sizeof(items_in), write(fd_in, items_in, sizeof(items_in)));
+
+    error = RingBuffer_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data));
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  one ring buffer, fed by a read channel and drained by a write channel  */
+    error = RingBufferUring_enChannelInit(&channels[0], &ring_buffer, fd_in, RING_BUFFER_URING_READ, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBufferUring_enChannelInit(&channels[1], &ring_buffer, fd_out, RING_BUFFER_URING_WRITE, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    test_RingBufferUring_xAvailable(&engine, channels, LOCAL_ARRAY_LEN(channels));
+
+    do
+    {
+        error = RingBufferUring_enSubmit(&engine);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        error = RingBufferUring_enComplete(&engine, 1, &complete_count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(0, channels[0].error);
+        TEST_ASSERT_EQUAL(0, channels[1].error);
+
+        error = RingBuffer_enItemCount(&ring_buffer, &count);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    } while(!channels[0].eof || count || engine.in_flight);
+
+    error = RingBufferUring_enDeinit(&engine);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    TEST_ASSERT_EQUAL(sizeof(items_out), pread(fd_out, items_out, sizeof(items_out), 0));
+    TEST_ASSERT_EQUAL_MEMORY(items_in, items_out, sizeof(items_in));
+
+    close(fd_in);
+    close(fd_out);
+}
+
+#endif /*  RING_BUFFER_URING  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_uring(void)
+{
+#if RING_BUFFER_URING
+    RUN_TEST(test_RingBufferUring_read_channel);
+    RUN_TEST(test_RingBufferUring_stream_partial_items);
+    RUN_TEST(test_RingBufferUring_copy_channels);
+#endif /*  RING_BUFFER_URING  */
+}
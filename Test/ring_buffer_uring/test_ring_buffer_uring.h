@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_uring_H_
+#define _test_ring_buffer_uring_H_
+
+void test_ring_buffer_uring(void);
+
+#endif /* _test_ring_buffer_uring_H_    */
@@ -0,0 +1,202 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer_wait/ring_buffer_wait.h"
+#include "utils/utils.h"
+#include "unity.h"
+#include "test_ring_buffer_wait.h"
+
+
+#define LOCAL_ARRAY_LEN(data)   (sizeof((data)) / sizeof((data)[0]))
+
+#if RING_BUFFER_WAIT
+
+#include <pthread.h>
+#include <time.h>
+
+#define TEST_WAIT_TIMEOUT_NS    2000000ULL
+#define TEST_WAIT_ITEMS         5000
+
+/**
+ * @brief Get monotonic time in nanoseconds
+ */
+static uint64_t test_wait_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/* ------------------------------------------------------------------------- */
+/* ---------------------- Test RingBufferWait_enInit() --------------------- */
+/* ------------------------------------------------------------------------- */
+#ifdef DEBUG
+
+static void test_RingBufferWait_enInit_Invalid_strategy(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBufferWait_t ring_buffer;
+    RingBuffer_Error_t error;
+
+    error = RingBufferWait_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), (RingBufferWait_Strategy_t)(RING_BUFFER_WAIT_PARK + 1), 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_INVALID_PARAM, error);
+}
+
+#endif /*  DEBUG  */
+
+/* ------------------------------------------------------------------------- */
+/* ---------------------- Test RingBufferWait timeouts --------------------- */
+/* ------------------------------------------------------------------------- */
+
+static void test_RingBufferWait_enGetItem_Timeout(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBufferWait_t ring_buffer;
+    RingBuffer_Item_t item;
+    RingBuffer_Error_t error;
+    uint64_t start;
+
+    for(RingBufferWait_Strategy_t strategy = RING_BUFFER_WAIT_SPIN; strategy <= RING_BUFFER_WAIT_PARK; strategy++)
+    {
+        error = RingBufferWait_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), strategy, 10);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        /*  no wait  */
+        error = RingBufferWait_enGetItem(&ring_buffer, &item, 0);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+
+        start = test_wait_now();
+
+        error = RingBufferWait_enGetItem(&ring_buffer, &item, TEST_WAIT_TIMEOUT_NS);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_EMPTY, error);
+        TEST_ASSERT_EQUAL(TRUE, (test_wait_now() - start) >= TEST_WAIT_TIMEOUT_NS);
+
+        /*  available item is returned right away  */
+        item = 0x5A;
+
+        error = RingBufferWait_enPutItem(&ring_buffer, &item, 0);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        item = 0;
+
+        error = RingBufferWait_enGetItem(&ring_buffer, &item, RING_BUFFER_WAIT_FOREVER);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+        TEST_ASSERT_EQUAL(0x5A, item);
+    }
+}
+
+static void test_RingBufferWait_enPutItems_Timeout(void)
+{
+    RingBuffer_Item_t ring_buffer_data [16] = {0};
+    RingBufferWait_t ring_buffer;
+    RingBuffer_Item_t items [32] = {0};
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Counter_t free_count;
+    RingBuffer_Error_t error;
+
+    error = RingBufferWait_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), RING_BUFFER_WAIT_PARK, 10);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    error = RingBuffer_enFreeCount(&ring_buffer.ring_buffer, &free_count);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+    /*  items that fit are added, then the put times out  */
+    error = RingBufferWait_enPutItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, TEST_WAIT_TIMEOUT_NS);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+    TEST_ASSERT_EQUAL(free_count, item_count);
+
+    error = RingBufferWait_enPutItem(&ring_buffer, items, TEST_WAIT_TIMEOUT_NS);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_FULL, error);
+
+    error = RingBufferWait_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, 0);
+    TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+    TEST_ASSERT_EQUAL(free_count, item_count);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------- Test RingBufferWait producer thread ----------------- */
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Producer thread, puts #TEST_WAIT_ITEMS numbered items in blocks of 1 to 7 items
+ */
+static void * test_wait_producer(void * arg)
+{
+    RingBufferWait_t * ring_buffer = (RingBufferWait_t *)arg;
+    RingBuffer_Item_t items [7];
+    RingBuffer_Counter_t item_count;
+    uint32_t put = 0;
+
+    while(put < TEST_WAIT_ITEMS)
+    {
+        RingBuffer_Counter_t len = (RingBuffer_Counter_t)MIN((put % 7) + 1, TEST_WAIT_ITEMS - put);
+
+        for(RingBuffer_Counter_t i = 0; i < len; i++)
+        {
+            items[i] = (RingBuffer_Item_t)(put + i);
+        }
+
+        (void)RingBufferWait_enPutItems(ring_buffer, items, len, &item_count, RING_BUFFER_WAIT_FOREVER);
+        put += item_count;
+    }
+
+    return NULL;
+}
+
+static void test_RingBufferWait_producer_thread(void)
+{
+    static RingBuffer_Item_t ring_buffer_data [16];
+    static RingBufferWait_t ring_buffer;
+    RingBuffer_Item_t items [5];
+    RingBuffer_Counter_t item_count;
+    RingBuffer_Error_t error;
+    pthread_t producer;
+
+    for(RingBufferWait_Strategy_t strategy = RING_BUFFER_WAIT_YIELD; strategy <= RING_BUFFER_WAIT_PARK; strategy++)
+    {
+        uint32_t get = 0;
+
+        /*  no spinning, so both sides park or yield  */
+        error = RingBufferWait_enInit(&ring_buffer, ring_buffer_data, LOCAL_ARRAY_LEN(ring_buffer_data), strategy, 0);
+        TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+        TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, test_wait_producer, &ring_buffer));
+
+        while(get < TEST_WAIT_ITEMS)
+        {
+            error = RingBufferWait_enGetItems(&ring_buffer, items, LOCAL_ARRAY_LEN(items), &item_count, RING_BUFFER_WAIT_FOREVER);
+            TEST_ASSERT_EQUAL(RING_BUFFER_ERROR_NONE, error);
+
+            for(RingBuffer_Counter_t i = 0; i < item_count; i++)
+            {
+                TEST_ASSERT_EQUAL((RingBuffer_Item_t)get, items[i]);
+                get++;
+            }
+        }
+
+        pthread_join(producer, NULL);
+    }
+}
+
+#endif /*  RING_BUFFER_WAIT  */
+
+/* ------------------------------------------------------------------------- */
+/* --------------------------- End of test cases --------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void test_ring_buffer_wait(void)
+{
+#if RING_BUFFER_WAIT
+#ifdef DEBUG
+    RUN_TEST(test_RingBufferWait_enInit_Invalid_strategy);
+#endif /*  DEBUG  */
+
+    RUN_TEST(test_RingBufferWait_enGetItem_Timeout);
+    RUN_TEST(test_RingBufferWait_enPutItems_Timeout);
+    RUN_TEST(test_RingBufferWait_producer_thread);
+#endif /*  RING_BUFFER_WAIT  */
+}
@@ -0,0 +1,6 @@
+#ifndef _test_ring_buffer_wait_H_
+#define _test_ring_buffer_wait_H_
+
+void test_ring_buffer_wait(void);
+
+#endif /* _test_ring_buffer_wait_H_    */